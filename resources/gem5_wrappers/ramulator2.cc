@@ -1,5 +1,10 @@
 #include "mem/ramulator2.hh"
 
+#include <algorithm>
+#include <limits>
+#include <span>
+#include <vector>
+
 #include "base/callback.hh"
 #include "base/trace.hh"
 #include "debug/Ramulator2.hh"
@@ -27,14 +32,17 @@ Ramulator2::Ramulator2(const Params &p) :
     port(name() + ".port", *this),
     config_path(p.config_path),
     output_path(p.output_path),
-    retryReq(false), retryResp(false), startTick(0),
-    nbrOutstandingReads(0), nbrOutstandingWrites(0),
+    retryReq(false), retryResp(false), startTick(0), memoryPeriod(0),
+    nbrOutstandingReads(0),
     sendResponseEvent([this]{ sendResponse(); }, name()),
     tickEvent([this]{ tick(); }, name())
 {
     DPRINTF(Ramulator2, "Instantiated Ramulator2 \n");
 
     registerExitCallback([this]() { 
+        // Account for the idle cycles since the last tick
+        if (memoryPeriod != 0)
+            catchUp();
         ramulator2_frontend->finalize();
         ramulator2_memorysystem->finalize();
     });
@@ -69,9 +77,9 @@ void
 Ramulator2::startup()
 {
     startTick = curTick();
+    memoryPeriod = ramulator2_memorysystem->get_tCK() * sim_clock::as_float::ns;
 
-    // kick off the clock ticks
-    schedule(tickEvent, clockEdge());
+    // The clock ticks are scheduled once there is work to do
 }
 
 void
@@ -91,9 +99,8 @@ Ramulator2::sendResponse()
     if (success) {
         responseQueue.pop_front();
 
-        DPRINTF(Ramulator2, "Have %d read, %d write, %d responses outstanding\n",
-                nbrOutstandingReads, nbrOutstandingWrites,
-                responseQueue.size());
+        DPRINTF(Ramulator2, "Have %d read, %d responses outstanding\n",
+                nbrOutstandingReads, responseQueue.size());
 
         if (!responseQueue.empty() && !sendResponseEvent.scheduled())
             schedule(sendResponseEvent, curTick());
@@ -112,26 +119,86 @@ Ramulator2::sendResponse()
 unsigned int
 Ramulator2::nbrOutstanding() const
 {
-    return nbrOutstandingReads + nbrOutstandingWrites + responseQueue.size();
+    return nbrOutstandingReads + responseQueue.size();
+}
+
+int64_t
+Ramulator2::memoryCycle() const
+{
+    // The first clock edge is at startTick
+    return (curTick() - startTick) / memoryPeriod + 1;
+}
+
+void
+Ramulator2::catchUp()
+{
+    ramulator2_memorysystem->tick_until(memoryCycle());
+}
+
+void
+Ramulator2::handleCompletions()
+{
+    std::vector<Ramulator::Request> completions;
+    ramulator2_memorysystem->drain_completions(completions);
+    for (auto& req : completions) {
+        // Writes are responded to when they are accepted
+        if (req.type_id != Ramulator::Request::Type::Read)
+            continue;
+
+        DPRINTF(Ramulator2, "Read to %ld completed.\n", req.addr);
+        auto& pkt_q = outstandingReads.find(req.addr)->second;
+        PacketPtr pkt = pkt_q.front();
+        pkt_q.pop_front();
+        if (!pkt_q.size())
+            outstandingReads.erase(req.addr);
+
+        // added counter to track requests in flight
+        --nbrOutstandingReads;
+
+        accessAndRespond(pkt);
+    }
+}
+
+void
+Ramulator2::scheduleTick()
+{
+    // Nothing to do until the next request arrives, the idle cycles
+    // (e.g., refreshes) are simulated when catching up
+    if (nbrOutstandingReads == 0 && !retryReq &&
+        ramulator2_memorysystem->is_finished())
+        return;
+
+    int64_t next_cycle = std::max(
+        ramulator2_memorysystem->get_next_event_clk(),
+        ramulator2_memorysystem->get_clk() + 1);
+    if (next_cycle == std::numeric_limits<int64_t>::max())
+        return;
+
+    Tick when = startTick + (next_cycle - 1) * memoryPeriod;
+    if (!tickEvent.scheduled())
+        schedule(tickEvent, when);
+    else if (tickEvent.when() > when)
+        reschedule(tickEvent, when);
 }
 
 void
 Ramulator2::tick()
 {
     // Only tick when it's timing mode
-    if (system()->isTimingMode()) {
-        ramulator2_memorysystem->tick();
-
-        // is the connected port waiting for a retry, if so check the
-        // state and send a retry if conditions have changed
-        if (retryReq) {
-            retryReq = false;
-            port.sendRetryReq();
-        }
+    if (!system()->isTimingMode())
+        return;
+
+    catchUp();
+    handleCompletions();
+
+    // is the connected port waiting for a retry, if so check the
+    // state and send a retry if conditions have changed
+    if (retryReq) {
+        retryReq = false;
+        port.sendRetryReq();
     }
 
-    schedule(tickEvent,
-        curTick() + ramulator2_memorysystem->get_tCK() * sim_clock::as_float::ns);
+    scheduleTick();
 }
 
 Tick
@@ -175,76 +242,43 @@ Ramulator2::recvTimingReq(PacketPtr pkt)
     if (retryReq)
         return false;
 
-    bool enqueue_success = false;
-    if (pkt->isRead()) 
-    {
-        // Generate ramulator READ request and try to send to ramulator's memory system
-        enqueue_success = ramulator2_frontend->
-            receive_external_requests(0, pkt->getAddr(), 0, 
-            [this](Ramulator::Request& req) {
-                DPRINTF(Ramulator2, "Read to %ld completed.\n", req.addr);
-                auto& pkt_q = outstandingReads.find(req.addr)->second;
-                PacketPtr pkt = pkt_q.front();
-                pkt_q.pop_front();
-                if (!pkt_q.size())
-                    outstandingReads.erase(req.addr);
-
-                // added counter to track requests in flight
-                --nbrOutstandingReads;
-
-                accessAndRespond(pkt);
-            });
-
-        if (enqueue_success) 
-        {
+    if (!(pkt->isRead() || pkt->isWrite())) {
+        // keep it simple and just respond if necessary
+        accessAndRespond(pkt);
+        return true;
+    }
+
+    // The request arrives at the current cycle of Ramulator2
+    catchUp();
+
+    // Generate ramulator READ/WRITE request and try to send to ramulator's
+    // memory system. It completes into the completion queue of the memory
+    // system, which is drained on the next tick.
+    Ramulator::Request req(pkt->getAddr(),
+        pkt->isRead() ? Ramulator::Request::Type::Read
+                      : Ramulator::Request::Type::Write,
+        0, nullptr);
+    bool enqueue_success =
+        ramulator2_memorysystem->send(std::span<Ramulator::Request>(&req, 1)) == 1;
+
+    if (enqueue_success) {
+        if (pkt->isRead()) {
             outstandingReads[pkt->getAddr()].push_back(pkt);
 
             // we count a transaction as outstanding until it has left the
             // queue in the controller, and the response has been sent
             // back, note that this will differ for reads and writes
             ++nbrOutstandingReads;
-        } 
-        else 
-        {
-            retryReq = true;
-        }
-    } else if (pkt->isWrite()) {
-        // Generate ramulator WRITE request and try to send to ramulator's memory system
-        enqueue_success = ramulator2_frontend->
-            receive_external_requests(1, pkt->getAddr(), 0, 
-            [this](Ramulator::Request& req) {
-                DPRINTF(Ramulator2, "Write to %ld completed.\n", req.addr);
-                auto& pkt_q = outstandingWrites.find(req.addr)->second;
-                PacketPtr pkt = pkt_q.front();
-                pkt_q.pop_front();
-                if (!pkt_q.size())
-                    outstandingWrites.erase(req.addr);
-
-                // added counter to track requests in flight
-                --nbrOutstandingWrites;
-
-                accessAndRespond(pkt);
-            });
-
-        if (enqueue_success) 
-        {
-            outstandingWrites[pkt->getAddr()].push_back(pkt);
-
-            ++nbrOutstandingWrites;
-
+        } else {
             // perform the access for writes
             accessAndRespond(pkt);
-        } 
-        else 
-        {
-            retryReq = true;
         }
     } else {
-        // keep it simple and just respond if necessary
-        accessAndRespond(pkt);
-        return true;
+        retryReq = true;
     }
 
+    scheduleTick();
+
     return enqueue_success;
 }
 
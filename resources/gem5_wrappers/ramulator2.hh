@@ -61,16 +61,16 @@ class Ramulator2 : public AbstractMemory
     bool retryReq;
     bool retryResp;
     Tick startTick;
+    Tick memoryPeriod;
     std::unordered_map<Addr, std::deque<PacketPtr>> outstandingReads;
-    std::unordered_map<Addr, std::deque<PacketPtr>> outstandingWrites;
 
     /**
      * Count the number of outstanding transactions so that we can
      * block any further requests until there is space in Ramulator2 and
-     * the sending queue we need to buffer the response packets.
+     * the sending queue we need to buffer the response packets. Writes
+     * are responded to as soon as Ramulator2 accepts them.
      */
     unsigned int nbrOutstandingReads;
-    unsigned int nbrOutstandingWrites;
 
     /**
      * Queue to hold response packets until we can send them
@@ -99,15 +99,40 @@ class Ramulator2 : public AbstractMemory
     EventFunctionWrapper sendResponseEvent;
 
     /**
-     * Progress the controller one clock cycle.
+     * Progress Ramulator2 to the current tick and handle the completed
+     * requests, then schedule the next tick if there is work pending.
      */
     void tick();
 
     /**
-     * Event to schedule clock ticks
+     * Event to schedule clock ticks. It is only scheduled while
+     * Ramulator2 has work to do, the idle cycles in between are
+     * skipped when Ramulator2 is caught up with the current tick.
      */
     EventFunctionWrapper tickEvent;
 
+    /**
+     * The Ramulator2 cycle that corresponds to the current tick, i.e.,
+     * the number of its clock edges up to and including curTick().
+     */
+    int64_t memoryCycle() const;
+
+    /**
+     * Advance Ramulator2 to the current tick.
+     */
+    void catchUp();
+
+    /**
+     * Respond to the reads that Ramulator2 has completed.
+     */
+    void handleCompletions();
+
+    /**
+     * Schedule the tick event at the next cycle in which Ramulator2 has
+     * work to do, unless it is idle.
+     */
+    void scheduleTick();
+
     /**
      * Upstream caches need this packet until true is returned, so
      * hold it for deletion until a subsequent call
@@ -39,11 +39,10 @@ class LinearMapperBase : public IAddrMapper {
       m_tx_offset = calc_log2(tx_bytes);
 
       // Determine where are the row and col bits for ChRaBaRoCo and RoBaRaCoCh
-      try {
-        m_row_bits_idx = m_dram->m_levels("row");
-      } catch (const std::out_of_range& r) {
+      if (!m_dram->m_ids.level.row.exists()) {
         throw std::runtime_error(fmt::format("Organization \"row\" not found in the spec, cannot use linear mapping!"));
       }
+      m_row_bits_idx = m_dram->m_ids.level.row;
 
       // Assume column is always the last level
       m_col_bits_idx = m_num_levels - 1;
@@ -58,6 +57,8 @@ class ChRaBaRoCo final : public LinearMapperBase, public Implementation {
   public:
     void init() override { };
 
+    void serialize(Archive& ar) override { };
+
     void setup(IFrontEnd* frontend, IMemorySystem* memory_system) override {
       LinearMapperBase::setup(frontend, memory_system);
     }
@@ -79,6 +80,8 @@ class RoBaRaCoCh final : public LinearMapperBase, public Implementation {
   public:
     void init() override { };
 
+    void serialize(Archive& ar) override { };
+
     void setup(IFrontEnd* frontend, IMemorySystem* memory_system) override {
       LinearMapperBase::setup(frontend, memory_system);
     }
@@ -106,6 +109,8 @@ class RoBaCoRaCh final : public LinearMapperBase, public Implementation {
   public:
     void init() override { };
 
+    void serialize(Archive& ar) override { };
+
     void setup(IFrontEnd* frontend, IMemorySystem* memory_system) override {
       LinearMapperBase::setup(frontend, memory_system);
     }
@@ -138,6 +143,8 @@ class RoCoBaRaCh final : public LinearMapperBase, public Implementation {
   public:
     void init() override { };
 
+    void serialize(Archive& ar) override { };
+
     void setup(IFrontEnd* frontend, IMemorySystem* memory_system) override {
       LinearMapperBase::setup(frontend, memory_system);
     }
@@ -170,6 +177,8 @@ class RoCoRaBaCh final : public LinearMapperBase, public Implementation {
   public:
     void init() override { };
 
+    void serialize(Archive& ar) override { };
+
     void setup(IFrontEnd* frontend, IMemorySystem* memory_system) override {
       LinearMapperBase::setup(frontend, memory_system);
     }
@@ -202,6 +211,8 @@ class RoRaCoBaCh final : public LinearMapperBase, public Implementation {
   public:
     void init() override { };
 
+    void serialize(Archive& ar) override { };
+
     void setup(IFrontEnd* frontend, IMemorySystem* memory_system) override {
       LinearMapperBase::setup(frontend, memory_system);
     }
@@ -234,6 +245,8 @@ class RoRaBaCoCh final : public LinearMapperBase, public Implementation {
   public:
     void init() override { };
 
+    void serialize(Archive& ar) override { };
+
     void setup(IFrontEnd* frontend, IMemorySystem* memory_system) override {
       LinearMapperBase::setup(frontend, memory_system);
     }
@@ -266,6 +279,8 @@ class BhRoBlBgCoRaCh final : public LinearMapperBase, public Implementation {
   public:
     void init() override { };
 
+    void serialize(Archive& ar) override { };
+
     void setup(IFrontEnd* frontend, IMemorySystem* memory_system) override {
       LinearMapperBase::setup(frontend, memory_system);
 
@@ -309,6 +324,8 @@ class RoBaRaCoPcCh final : public LinearMapperBase, public Implementation {
   public:
     void init() override { };
 
+    void serialize(Archive& ar) override { };
+
     void setup(IFrontEnd* frontend, IMemorySystem* memory_system) override {
       LinearMapperBase::setup(frontend, memory_system);
     }
@@ -339,6 +356,8 @@ class RoCoBaRaPcCh final : public LinearMapperBase, public Implementation {
   public:
     void init() override { };
 
+    void serialize(Archive& ar) override { };
+
     void setup(IFrontEnd* frontend, IMemorySystem* memory_system) override {
       LinearMapperBase::setup(frontend, memory_system);
     }
@@ -384,6 +403,8 @@ class RoRaCoBaPcCh final : public LinearMapperBase, public Implementation {
   public:
     void init() override { };
 
+    void serialize(Archive& ar) override { };
+
     void setup(IFrontEnd* frontend, IMemorySystem* memory_system) override {
       LinearMapperBase::setup(frontend, memory_system);
     }
@@ -421,6 +442,8 @@ class RoRabkCoBgPcCh final : public LinearMapperBase, public Implementation {
   public:
     void init() override { };
 
+    void serialize(Archive& ar) override { };
+
     void setup(IFrontEnd* frontend, IMemorySystem* memory_system) override {
       LinearMapperBase::setup(frontend, memory_system);
     }
@@ -457,6 +480,8 @@ class BkRoCoBgRaPcCh final : public LinearMapperBase, public Implementation {
   public:
     void init() override { };
 
+    void serialize(Archive& ar) override { };
+
     void setup(IFrontEnd* frontend, IMemorySystem* memory_system) override {
       LinearMapperBase::setup(frontend, memory_system);
     }
@@ -493,6 +518,8 @@ class RoRaBkBgCoPcCh final : public LinearMapperBase, public Implementation {
   public:
     void init() override { };
 
+    void serialize(Archive& ar) override { };
+
     void setup(IFrontEnd* frontend, IMemorySystem* memory_system) override {
       LinearMapperBase::setup(frontend, memory_system);
     }
@@ -531,6 +558,8 @@ class BhRoRaBlBgCoPcCh final : public LinearMapperBase, public Implementation {
   public:
     void init() override { };
 
+    void serialize(Archive& ar) override { };
+
     void setup(IFrontEnd* frontend, IMemorySystem* memory_system) override {
       LinearMapperBase::setup(frontend, memory_system);
       if(m_addr_bits[6] != 2) {
@@ -571,6 +600,8 @@ class MOP4CLXOR final : public LinearMapperBase, public Implementation {
   public:
     void init() override { };
 
+    void serialize(Archive& ar) override { };
+
     void setup(IFrontEnd* frontend, IMemorySystem* memory_system) override {
       LinearMapperBase::setup(frontend, memory_system);
     }
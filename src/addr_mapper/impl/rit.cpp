@@ -20,11 +20,10 @@ void LinearMapperBase_with_rit::setup(IFrontEnd* frontend, IMemorySystem* memory
   m_tx_offset = calc_log2(tx_bytes);
 
   // Determine where are the row and col bits for ChRaBaRoCo and RoBaRaCoCh
-  try {
-    m_row_bits_idx = m_dram->m_levels("row");
-  } catch (const std::out_of_range& r) {
+  if (!m_dram->m_ids.level.row.exists()) {
     throw std::runtime_error(fmt::format("Organization \"row\" not found in the spec, cannot use linear mapping!"));
   }
+  m_row_bits_idx = m_dram->m_ids.level.row;
 
   // Assume column is always the last level
   m_col_bits_idx = m_num_levels - 1;
@@ -33,9 +32,9 @@ void LinearMapperBase_with_rit::setup(IFrontEnd* frontend, IMemorySystem* memory
 // initialize RIT
 void LinearMapperBase_with_rit::init_rit(int num_banks, int num_rit_entries){
   m_num_rit_entries = num_rit_entries;
-  m_rank_level = m_dram->m_levels("rank");
-  m_bank_level = m_dram->m_levels("bank");
-  m_row_level = m_dram->m_levels("row");
+  m_rank_level = m_dram->m_ids.level.rank.required();
+  m_bank_level = m_dram->m_ids.level.bank.required();
+  m_row_level = m_dram->m_ids.level.row.required();
 
   // setup RIT
   for (int i = 0; i < num_banks; i++) {
@@ -153,6 +152,10 @@ class ChRaBaRoCo_with_rit final : public LinearMapperBase_with_rit, public Imple
   public:
     void init() override { };
 
+    void serialize(Archive& ar) override {
+      ar & m_row_indirection_table;
+    };
+
     void setup(IFrontEnd* frontend, IMemorySystem* memory_system) override {
       LinearMapperBase_with_rit::setup(frontend, memory_system);
     }
@@ -175,6 +178,10 @@ class RoBaRaCoCh_with_rit final : public LinearMapperBase_with_rit, public Imple
   public:
     void init() override { };
 
+    void serialize(Archive& ar) override {
+      ar & m_row_indirection_table;
+    };
+
     void setup(IFrontEnd* frontend, IMemorySystem* memory_system) override {
       LinearMapperBase_with_rit::setup(frontend, memory_system);
     }
@@ -199,6 +206,10 @@ class MOP4CLXOR_with_rit final : public LinearMapperBase_with_rit, public Implem
   public:
     void init() override { };
 
+    void serialize(Archive& ar) override {
+      ar & m_row_indirection_table;
+    };
+
     void setup(IFrontEnd* frontend, IMemorySystem* memory_system) override {
       LinearMapperBase_with_rit::setup(frontend, memory_system);
     }
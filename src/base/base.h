@@ -4,6 +4,7 @@
 #include <string>
 #include <vector>
 #include <queue>
+#include <limits>
 #include <unordered_map>
 #include <functional>
 #include <iostream>
@@ -21,6 +22,8 @@
 #include "base/request.h"
 #include "base/utils.h"
 #include "base/stats.h"
+#include "base/serialization.h"
+#include "base/profiler.h"
 
 
 #ifndef uint
@@ -61,6 +64,8 @@ class Implementation {
     Params m_params;          // The parameters of the implementation
     Stats m_stats;            // All statistics of the implementation are held here.
     Logger_t m_logger;        // Pointer to an pdlog logger.
+    ProfileCounter m_profile; // Time spent in the functions profiled with RAMULATOR_PROFILE_SCOPE()
+    std::ostream* m_report_stream = nullptr;  // Where the end-of-simulation reports go (stdout if not set)
 
 
   public:
@@ -103,6 +108,18 @@ class Implementation {
      */
     virtual void finalize() { return; };
 
+    /**
+     * @brief     Saves (or loads) the state that changes during the simulation to (or from) a checkpoint.
+     * 
+     * @details
+     * The registered statistics are saved for all implementations. Implementations that have no other
+     * state override this with an empty function, the rest cannot be checkpointed.
+     * 
+     */
+    virtual void serialize(Archive& ar) { 
+      throw ConfigurationError("Implementation {} of {} does not support checkpointing!", get_name(), get_ifce_name()); 
+    };
+
 
     template<class Interface_t>
     Interface_t* cast_parent() {
@@ -157,7 +174,7 @@ class Implementation {
     StatWrapper<T>& register_stat(T& val) { StatWrapper<T>* s = new StatWrapper<T>(val, *this, m_stats); return *s; };
     template <typename T>
     StatWrapper<T>& register_stat(std::vector<T>& val) { StatWrapper<T>* s = new StatWrapper<T>(val, *this, m_stats); return *s; };
-    bool has_stats() { return !m_stats.is_empty(); };
+    bool has_stats() { return !m_stats.is_empty() || m_profile.num_calls > 0; };
     /**
      * @brief    Recursively print the stats of myself and all my childs
      * 
@@ -178,6 +195,7 @@ class Implementation {
 
         // Print all my stats
         emitter << m_stats;
+        Profiler::emit_to(emitter, m_profile);
         // Print all my children
         for (auto child_impl : m_children) {
           if (child_impl->has_stats()) {
@@ -197,7 +215,20 @@ class Implementation {
     void set_parent(Implementation* parent) { m_parent = parent; };
     void add_child(Implementation* child) { m_children.push_back(child); };
 
+    /**
+     * @brief    Writes the human-readable reports printed in finalize() to the given stream instead of stdout.
+     * 
+     */
+    void set_report_stream(std::ostream* report_stream) { m_report_stream = report_stream; };
+    std::ostream& report_stream() const { return m_report_stream ? *m_report_stream : std::cout; };
+
   private:
+    void checkpoint(Archive& ar) {
+      ar.tag(fmt::format("{}::{}::{}", get_ifce_name(), get_name(), get_id()));
+      m_stats.serialize(ar);
+      serialize(ar);
+    };
+
     template<class Interface_t>
     Interface_t* create_child(const YAML::Node& config, std::string desired_impl_name) {
       std::string ifce_name = Interface_t::get_name();
@@ -305,6 +336,18 @@ class TopLevel {
       }
     }
 
+    /**
+     * @brief    Saves (or loads) the state of myself and all my components to (or from) a checkpoint.
+     * 
+     */
+    void serialize_components(Archive& ar) {
+      T* derived = static_cast<T*>(this);
+      dynamic_cast<Implementation*>(derived)->checkpoint(ar);
+      for (auto component : m_components) {
+        component->checkpoint(ar);
+      }
+    }
+
     template <class Ifce_t> 
     Ifce_t* get_ifce(std::string desired_id = "") {
       for (auto component : m_components) {
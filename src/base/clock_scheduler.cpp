@@ -0,0 +1,130 @@
+#include <algorithm>
+
+#include "base/clock_scheduler.h"
+#include "base/exception.h"
+
+namespace Ramulator {
+
+void ClockScheduler::add_domain(Domain domain) {
+  if (domain.period == 0) {
+    throw ConfigurationError("Clock domain {} must have a nonzero period!", domain.name);
+  }
+  domain.order = m_num_entries++;
+  m_domains.push_back(std::move(domain));
+}
+
+void ClockScheduler::add_stop_condition(std::function<bool()> is_met) {
+  m_stop_conditions.push_back({m_num_entries++, std::move(is_met)});
+}
+
+void ClockScheduler::rebuild_heap() {
+  m_heap.clear();
+  for (int i = 0; i < (int)m_domains.size(); i++) {
+    m_heap.push_back(i);
+  }
+  std::make_heap(m_heap.begin(), m_heap.end(), heap_greater());
+}
+
+bool ClockScheduler::check_stop_conditions(size_t& next_condition, int before_order) {
+  for (; next_condition < m_stop_conditions.size(); next_condition++) {
+    if (m_stop_conditions[next_condition].order > before_order) {
+      break;
+    }
+    if (m_stop_conditions[next_condition].is_met()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+uint64_t ClockScheduler::get_next_event_time() {
+  uint64_t next_time = NEVER;
+  for (auto& domain : m_domains) {
+    if (!domain.next_event_clk) {
+      next_time = std::min(next_time, domain.next_edge);
+      continue;
+    }
+    // The tick() of the i-th cycle (counting from 1) happens on the (i-1)-th edge
+    Clk_t clk = domain.next_event_clk();
+    if (clk == std::numeric_limits<Clk_t>::max()) {
+      continue;
+    }
+    next_time = std::min(next_time, clk <= 0 ? 0 : (uint64_t)(clk - 1) * domain.period);
+  }
+  return next_time;
+}
+
+bool ClockScheduler::skip_idle_edges(uint64_t time, uint64_t stop_time) {
+  uint64_t next_time = std::min(get_next_event_time(), stop_time);
+  if (next_time <= time || next_time == NEVER) {
+    return false;
+  }
+  fast_forward(next_time);
+  return true;
+}
+
+void ClockScheduler::fast_forward(uint64_t time) {
+  for (auto& domain : m_domains) {
+    // The number of edges before the given time
+    uint64_t num_ticks = (time + domain.period - 1) / domain.period;
+    if (domain.fast_forward) {
+      domain.fast_forward(num_ticks);
+    }
+    domain.next_edge = num_ticks * domain.period;
+  }
+  rebuild_heap();
+}
+
+bool ClockScheduler::run_until(uint64_t& time, uint64_t stop_time) {
+  if (m_domains.empty()) {
+    throw ConfigurationError("No clock domain to run!");
+  }
+  for (auto& domain : m_domains) {
+    domain.next_edge = (time + domain.period - 1) / domain.period * domain.period;
+  }
+  rebuild_heap();
+
+  while (true) {
+    uint64_t edge = m_domains[m_heap.front()].next_edge;
+    if (edge >= stop_time) {
+      time = stop_time;
+      return false;
+    }
+    time = edge;
+
+    // Tick all domains on this edge, checking the stop conditions in between. Once all stop
+    // conditions are checked, try to skip the idle edges (including the rest of this one).
+    size_t next_condition = 0;
+    bool is_skip_checked = false;
+    bool is_skipped = false;
+    while (m_domains[m_heap.front()].next_edge == edge) {
+      Domain& domain = m_domains[m_heap.front()];
+      if (check_stop_conditions(next_condition, domain.order)) {
+        return true;
+      }
+      if (!is_skip_checked && next_condition == m_stop_conditions.size()) {
+        is_skip_checked = true;
+        if ((is_skipped = skip_idle_edges(edge, stop_time))) {
+          break;
+        }
+      }
+
+      std::pop_heap(m_heap.begin(), m_heap.end(), heap_greater());
+      domain.tick();
+      domain.next_edge += domain.period;
+      std::push_heap(m_heap.begin(), m_heap.end(), heap_greater());
+    }
+    if (is_skipped) {
+      continue;
+    }
+
+    if (check_stop_conditions(next_condition, m_num_entries)) {
+      return true;
+    }
+    if (!is_skip_checked) {
+      skip_idle_edges(edge, stop_time);
+    }
+  }
+}
+
+}        // namespace Ramulator
@@ -0,0 +1,144 @@
+#ifndef     RAMULATOR_BASE_CLOCK_SCHEDULER_H
+#define     RAMULATOR_BASE_CLOCK_SCHEDULER_H
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "base/type.h"
+
+namespace Ramulator {
+
+/**
+ * @brief    Ticks a set of clocked objects, each in its own clock domain
+ *
+ * @details
+ * Time is counted in base time units. Every domain has an integer period in base time units
+ * and ticks on multiples of its period, i.e., a rational frequency ratio p:q between two domains
+ * becomes the periods q:p. The domains are kept in a min-heap of their next clock edges, so each
+ * domain is visited only on its own edges. Domains that share an edge tick in registration order.
+ *
+ * Stop conditions registered with add_stop_condition() are checked on every edge, between the
+ * domains registered before and after them.
+ *
+ * If every domain can tell when it has work to do next (get_next_event_clk() and fast_forward()),
+ * the edges in which none of them has anything to do are skipped.
+ *
+ * Only the frontend and the memory system are domains. A unit that ticks in the middle of the cycle of
+ * its domain cannot be a domain of its own, so it still divides the clock of its domain itself
+ * (i.e., the NDP units of DDR5-pCH, at 1/4 of the DRAM clock). The AsyncDIMM NMA controllers and the
+ * HSNC logic of the ndpDRAM system run at the memory-system clock.
+ *
+ */
+class ClockScheduler {
+  public:
+    static constexpr uint64_t NEVER = std::numeric_limits<uint64_t>::max();
+
+  private:
+    struct Domain {
+      std::string name;
+      uint64_t period;
+      uint64_t next_edge = 0;
+      int order = 0;
+
+      std::function<void()> tick;
+      std::function<Clk_t()> next_event_clk;     // Not set if the domain cannot be skipped
+      std::function<void(Clk_t)> fast_forward;
+    };
+
+    struct StopCondition {
+      int order;
+      std::function<bool()> is_met;
+    };
+
+    std::vector<Domain> m_domains;
+    std::vector<StopCondition> m_stop_conditions;
+    std::vector<int> m_heap;                      // Min-heap of the domain indices by (next_edge, order)
+
+    int m_num_entries = 0;                        // Domains and stop conditions, in registration order
+
+  public:
+    /**
+     * @brief    Registers a clocked object (anything with tick()) as a clock domain.
+     *
+     * @param    name           The name of the domain (for error messages).
+     * @param    clocked        The object to tick.
+     * @param    period         The clock period in base time units.
+     */
+    template<class T>
+    void add_domain(std::string name, T* clocked, uint64_t period) {
+      Domain domain;
+      domain.name = name;
+      domain.period = period;
+      domain.tick = [clocked] { clocked->tick(); };
+      if constexpr (requires { clocked->get_next_event_clk(); clocked->fast_forward(Clk_t(0)); }) {
+        domain.next_event_clk = [clocked] { return clocked->get_next_event_clk(); };
+        domain.fast_forward = [clocked](Clk_t clk) { clocked->fast_forward(clk); };
+      }
+      add_domain(std::move(domain));
+    };
+
+    /**
+     * @brief    Registers a condition that stops the run once it is met.
+     *
+     */
+    void add_stop_condition(std::function<bool()> is_met);
+
+    /**
+     * @brief    Runs the domains from the given time until a stop condition is met or stop_time is reached.
+     *
+     * @details
+     * Each domain has ticked once for every edge before the start time, i.e., the run resumes
+     * where a previous run_until() returned.
+     *
+     * @param    time           The time to start from. Updated to the time to resume from.
+     * @param    stop_time      The time before which to stop.
+     * @return   true           A stop condition is met.
+     * @return   false          Stopped at stop_time.
+     */
+    bool run_until(uint64_t& time, uint64_t stop_time = NEVER);
+
+  private:
+    void add_domain(Domain domain);
+
+    // The std heap algorithms build max-heaps, so the heap is ordered by the reverse of (next_edge, order)
+    auto heap_greater() const {
+      return [this](int a, int b) {
+        const Domain& x = m_domains[a];
+        const Domain& y = m_domains[b];
+        return x.next_edge != y.next_edge ? x.next_edge > y.next_edge : x.order > y.order;
+      };
+    };
+
+    void rebuild_heap();
+
+    /**
+     * @brief    Checks the stop conditions from next_condition on that are registered before the given order.
+     *
+     */
+    bool check_stop_conditions(size_t& next_condition, int before_order);
+
+    /**
+     * @brief    Returns the earliest time at which any domain may do any work (NEVER if none of them will).
+     *
+     */
+    uint64_t get_next_event_time();
+
+    /**
+     * @brief    Skips the idle edges from the given time on. Returns true if anything is skipped.
+     *
+     */
+    bool skip_idle_edges(uint64_t time, uint64_t stop_time);
+
+    /**
+     * @brief    Advances all domains to the given time as if all their edges before it were idle.
+     *
+     */
+    void fast_forward(uint64_t time);
+};
+
+}        // namespace Ramulator
+
+#endif   // RAMULATOR_BASE_CLOCK_SCHEDULER_H
@@ -143,6 +143,9 @@ IFrontEnd* Factory::create_frontend(const YAML::Node& config) {
     throw InitializationError("Error creating the frontend!"); 
     return nullptr;  
   }
+  if (impl->m_config["sampling"] && !frontend->supports_sampling()) {
+    throw ConfigurationError("Frontend {} does not support sampled simulation!", impl->get_name());
+  }
 
   frontend->gather_components();
 
@@ -21,7 +21,7 @@ class Logging {
 
   public:
     /**
-     * @brief       Create an spdlog logger.
+     * @brief       Create an spdlog logger (or return the existing logger with the same name).
      * 
      * @param name  The name of the logger
      * @return Logger_t 
@@ -0,0 +1,59 @@
+#include <chrono>
+
+#include "base/profiler.h"
+#include "base/exception.h"
+
+namespace Ramulator {
+
+namespace {
+
+uint64_t get_wall_clock_ns() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+}        // namespace
+
+void Profiler::configure(const YAML::Node& config) {
+  const YAML::Node& profiler_config = config["Profiler"];
+  s_enabled = profiler_config && profiler_config["enable"].as<bool>(true);
+  if (!s_enabled) {
+    return;
+  }
+
+  s_sample_period = profiler_config["sample_period"].as<uint64_t>(1);
+  if (s_sample_period == 0) {
+    throw ConfigurationError("Profiler sample_period must be positive!");
+  }
+  s_start_tsc = read_tsc();
+  s_start_ns = get_wall_clock_ns();
+}
+
+double Profiler::get_ns_per_tsc() {
+  uint64_t elapsed_tsc = read_tsc() - s_start_tsc;
+  uint64_t elapsed_ns = get_wall_clock_ns() - s_start_ns;
+  return elapsed_tsc == 0 ? 0.0 : (double)elapsed_ns / elapsed_tsc;
+}
+
+void Profiler::emit_to(YAML::Emitter& emitter, const ProfileCounter& counter) {
+  if (counter.num_calls == 0) {
+    return;
+  }
+
+  // Scale the sampled calls up to all calls
+  double scale = counter.num_sampled_calls == 0 ? 0.0 : get_ns_per_tsc() * counter.num_calls / counter.num_sampled_calls;
+  double total_ns = counter.total_tsc * scale;
+  double self_ns = counter.self_tsc * scale;
+
+  emitter << YAML::Key << "profile";
+  emitter << YAML::Value << YAML::BeginMap;
+    emitter << YAML::Key << "calls" << YAML::Value << counter.num_calls;
+    emitter << YAML::Key << "sampled_calls" << YAML::Value << counter.num_sampled_calls;
+    emitter << YAML::Key << "total_ns" << YAML::Value << (uint64_t)total_ns;
+    emitter << YAML::Comment("Including the profiled functions of other components");
+    emitter << YAML::Key << "self_ns" << YAML::Value << (uint64_t)self_ns;
+    emitter << YAML::Key << "ns_per_cycle" << YAML::Value << total_ns / counter.num_calls;
+    emitter << YAML::Comment("Total time per call, i.e., per simulated (not skipped) cycle for tick()");
+  emitter << YAML::EndMap;
+}
+
+}        // namespace Ramulator
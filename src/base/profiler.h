@@ -0,0 +1,157 @@
+#ifndef     RAMULATOR_BASE_PROFILER_H
+#define     RAMULATOR_BASE_PROFILER_H
+
+#include <cstdint>
+
+#include <yaml-cpp/yaml.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#include <chrono>
+#endif
+
+namespace Ramulator {
+
+/**
+ * @brief    The (sampled) time spent in the profiled function of one component, in timestamp counter ticks
+ *
+ */
+struct ProfileCounter {
+  uint64_t num_calls = 0;           // All calls, including the ones that are not sampled
+  uint64_t num_sampled_calls = 0;
+  uint64_t total_tsc = 0;           // Including the time spent in the profiled functions of other components
+  uint64_t self_tsc = 0;            // Excluding the time spent in the profiled functions of other components
+};
+
+
+/**
+ * @brief    Opt-in wall-clock profiler of the components' tick()
+ *
+ * @details
+ * Enabled by the top-level "Profiler" group of the configuration:
+ *
+ *   Profiler:
+ *     enable: true         # Default: true if the group exists
+ *     sample_period: 16    # Time one in every sample_period calls (default: 1, i.e., all calls)
+ *
+ * Only the outermost profiled call on a thread (e.g., the memory system's tick()) decides whether
+ * it is sampled, the calls it makes to other profiled functions follow its decision, so the self
+ * time of a component never includes unsampled time of others. The decision is random (with a
+ * probability of 1/sample_period), so that it does not alias with periodic behavior of the simulated
+ * system. The times are read from the timestamp counter and converted to nanoseconds with the ratio
+ * of elapsed wall-clock time to elapsed ticks. The time of a sampled call includes the overhead of
+ * timing the profiled calls it makes.
+ *
+ */
+class Profiler {
+  friend class ProfileScope;
+
+  private:
+    inline static bool s_enabled = false;
+    inline static uint64_t s_sample_period = 1;
+    inline static uint64_t s_start_tsc = 0;
+    inline static uint64_t s_start_ns = 0;
+
+  public:
+    /**
+     * @brief    Enables (or disables) the profiler according to the "Profiler" group of the configuration.
+     *
+     */
+    static void configure(const YAML::Node& config);
+
+    static bool is_enabled() { return s_enabled; };
+
+    /**
+     * @brief    Returns whether to sample the next outermost profiled call.
+     *
+     */
+    static bool sample_next() {
+      if (s_sample_period == 1) {
+        return true;
+      }
+      // xorshift64
+      static thread_local uint64_t state = 0x9E3779B97F4A7C15ull;
+      state ^= state << 13;
+      state ^= state >> 7;
+      state ^= state << 17;
+      return state % s_sample_period == 0;
+    };
+
+    static uint64_t read_tsc() {
+#if defined(__x86_64__) || defined(__i386__)
+      return __rdtsc();
+#else
+      return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+    };
+
+    /**
+     * @brief    Emits the estimated times of the counter (if it has been called).
+     *
+     */
+    static void emit_to(YAML::Emitter& emitter, const ProfileCounter& counter);
+
+  private:
+    static double get_ns_per_tsc();
+};
+
+
+/**
+ * @brief    Times the enclosing scope into the given counter if the profiler is enabled
+ *
+ */
+class ProfileScope {
+  private:
+    inline static thread_local ProfileScope* s_current = nullptr;
+
+    ProfileCounter* m_counter = nullptr;    // nullptr if the profiler is disabled
+    ProfileScope* m_parent = nullptr;
+    bool m_is_sampled = false;
+    uint64_t m_start_tsc = 0;
+    uint64_t m_children_tsc = 0;
+
+  public:
+    ProfileScope(ProfileCounter& counter) {
+      if (!Profiler::s_enabled) {
+        return;
+      }
+      m_counter = &counter;
+      m_parent = s_current;
+      s_current = this;
+      m_is_sampled = m_parent ? m_parent->m_is_sampled : Profiler::sample_next();
+      counter.num_calls++;
+      if (m_is_sampled) {
+        m_start_tsc = Profiler::read_tsc();
+      }
+    };
+
+    ~ProfileScope() {
+      if (!m_counter) {
+        return;
+      }
+      if (m_is_sampled) {
+        uint64_t total_tsc = Profiler::read_tsc() - m_start_tsc;
+        m_counter->num_sampled_calls++;
+        m_counter->total_tsc += total_tsc;
+        m_counter->self_tsc += total_tsc - m_children_tsc;
+        if (m_parent) {
+          m_parent->m_children_tsc += total_tsc;
+        }
+      }
+      s_current = m_parent;
+    };
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+};
+
+}        // namespace Ramulator
+
+/**
+ * @brief    Profiles the rest of the enclosing function of an Implementation (e.g., its tick()).
+ *
+ */
+#define RAMULATOR_PROFILE_SCOPE() Ramulator::ProfileScope _ramulator_profile_scope(m_profile)
+
+#endif   // RAMULATOR_BASE_PROFILER_H
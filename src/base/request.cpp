@@ -9,5 +9,18 @@ Request::Request(AddrVec_t addr_vec, int type): addr_vec(addr_vec), type_id(type
 Request::Request(Addr_t addr, int type, int source_id, std::function<void(Request&)> callback):
 addr(addr), type_id(type), source_id(source_id), callback(callback) {};
 
+void Request::serialize(Archive& ar) {
+  ar & addr & addr_vec & type_id & source_id & callback_id;
+  ar & command & final_command & is_stat_updated & is_db_cmd & is_actived;
+  ar & is_ndp_req & ndp_id & is_trace_core_req & is_host_req;
+  ar & arrive & depart & scratchpad & m_payload;
+
+  bool has_callback = (bool)callback;
+  ar & has_callback;
+  if (ar.is_loading()) {
+    callback = has_callback ? ar.restore_callback(*this) : nullptr;
+  }
+}
+
 }        // namespace Ramulator
 
@@ -5,8 +5,11 @@
 #include <list>
 #include <string>
 #include <memory>
+#include <cstdint>
 
 #include "base/base.h"
+#include "base/serialization.h"
+#include "base/slot_arena.h"
 
 namespace Ramulator {
 
@@ -25,6 +28,7 @@ struct Request {
 
   int type_id = -1;    // An identifier for the type of the request
   int source_id = -1;  // An identifier for where the request is coming from (e.g., which core)
+  int callback_id = -1; // An identifier the source uses to recreate the callback (e.g., when restoring a checkpoint)
 
   int command = -1;             // The command that need to be issued to progress the request
   int final_command = -1;       // The final command that is needed to finish the request
@@ -39,6 +43,11 @@ struct Request {
   Clk_t arrive = -1;   // Clock cycle when the request arrive at the memory controller
   Clk_t depart = -1;   // Clock cycle when the request depart the memory controller
 
+  // The ready clock of `command` cached by IDRAM::check_ready() (not saved in checkpoints, i.e., recomputed after a restore)
+  int ready_command = -1;
+  uint64_t ready_epoch = 0;
+  Clk_t ready_clk = -1;
+
   std::array<int, 4> scratchpad = { 0 };    // A scratchpad for the request
 
   std::function<void(Request&)> callback;
@@ -47,36 +56,170 @@ struct Request {
   // std::vector based payload variable 
   std::vector<uint64_t> m_payload; 
   
+  Request() = default;
   Request(Addr_t addr, int type);
   Request(AddrVec_t addr_vec, int type);
   Request(Addr_t addr, int type, int source_id, std::function<void(Request&)> callback);
+
+  void serialize(Archive& ar);
+};
+
+
+/**
+ * @brief     The slots of the request buffers of one owner (e.g., a controller)
+ *
+ * @details
+ * The requests live in the slab slots of the arena, and the buffers are queues of slot indices into it,
+ * so once the owner reaches its peak occupancy the buffers neither allocate nor free request nodes.
+ * The payloads of removed requests are kept in a side pool and handed to the next enqueued request
+ * with a payload, so that copying it into its slot reuses their capacity instead of allocating.
+ *
+ */
+struct ReqNodePool {
+  SlotArena<Request> slots;
+  std::vector<std::vector<uint64_t>> payloads;     // Cleared payloads of removed requests
 };
 
 
+/**
+ * @brief     A queue of requests
+ *
+ * @details
+ * The owner of the buffers sets a shared node pool so that move_to() can move a request between its
+ * buffers by relinking its slot, i.e., without copying the request. A buffer without a node pool
+ * uses a pool of its own, and moving a request from it to another buffer moves the request instead.
+ * enqueue() copies the request into a reused slot, and the rvalue overload moves it there instead.
+ *
+ */
 struct ReqBuffer {
-  std::list<Request> buffer;
+  using iterator = SlotQueue<Request>::iterator;
+
   size_t max_size = 32;
 
+  private:
+    SlotQueue<Request> m_queue;
+    ReqNodePool* m_pool = nullptr;                // Not owned, set by the owner of the buffer
+    std::unique_ptr<ReqNodePool> m_own_pool;      // Only used without a shared pool
+
+  public:
+    ReqBuffer() = default;
+    ReqBuffer(const ReqBuffer& other) : max_size(other.max_size) {
+      // A pool of the other buffer's own is not shared
+      if (!other.m_own_pool && other.m_pool) {
+        set_node_pool(other.m_pool);
+      }
+      for (const Request& request : other) {
+        push(request);
+      }
+    };
+    ReqBuffer(ReqBuffer&&) = default;
+    ReqBuffer& operator=(const ReqBuffer& other) {
+      if (this != &other) {
+        *this = ReqBuffer(other);
+      }
+      return *this;
+    };
+    ReqBuffer& operator=(ReqBuffer&&) = default;
+
+    /**
+     * @brief     Uses the slots of the given pool. Must be called before anything is enqueued.
+     */
+    void set_node_pool(ReqNodePool* pool) {
+      m_pool = pool;
+      m_queue.bind(&pool->slots);
+    };
 
-  using iterator = std::list<Request>::iterator;
-  iterator begin() { return buffer.begin(); };
-  iterator end() { return buffer.end(); };
+    iterator begin() const { return m_queue.begin(); };
+    iterator end() const { return m_queue.end(); };
 
+    size_t size() const { return m_queue.size(); }
 
-  size_t size() const { return buffer.size(); }
+    bool enqueue(const Request& request) {
+      if (m_queue.size() > max_size) {
+        return false;
+      }
+      push(request);
+      return true;
+    }
 
-  bool enqueue(const Request& request) {
-    if (buffer.size() <= max_size) {
-      buffer.push_back(request);
+    bool enqueue(Request&& request) {
+      if (m_queue.size() > max_size) {
+        return false;
+      }
+      push(std::move(request));
       return true;
-    } else {
-      return false;
     }
-  }
 
-  void remove(iterator it) {
-    buffer.erase(it);
-  }
+    /**
+     * @brief     Moves the request to the end of another buffer (if it has space). The iterator stays valid and points into dst
+     *            if both buffers share the node pool.
+     */
+    bool move_to(iterator it, ReqBuffer& dst) {
+      if (dst.m_queue.size() > dst.max_size) {
+        return false;
+      }
+      if (&pool() == &dst.pool()) {
+        dst.m_queue.splice_back(it, m_queue);
+      } else {
+        dst.push(std::move(*it));
+        remove(it);
+      }
+      return true;
+    }
+
+    void remove(iterator it) {
+      // Release what the request holds onto now instead of when the slot is reused
+      it->callback = nullptr;
+      if (it->m_payload.capacity() > 0) {
+        pool().payloads.push_back(std::move(it->m_payload));
+        pool().payloads.back().clear();
+        it->m_payload.clear();
+      }
+      m_queue.erase(it);
+    }
+
+    void serialize(Archive& ar) {
+      uint64_t size = m_queue.size();
+      ar & size;
+      if (ar.is_loading()) {
+        while (m_queue.size() > 0) {
+          remove(begin());
+        }
+        for (uint64_t i = 0; i < size; i++) {
+          Request request;
+          ar & request;
+          push(std::move(request));
+        }
+      } else {
+        for (Request& request : *this) {
+          ar & request;
+        }
+      }
+    }
+
+  private:
+    ReqNodePool& pool() {
+      if (!m_pool) {
+        m_own_pool = std::make_unique<ReqNodePool>();
+        set_node_pool(m_own_pool.get());
+      }
+      return *m_pool;
+    };
+
+    void push(const Request& request) {
+      ReqNodePool& nodes = pool();
+      Request& slot = m_queue.emplace_back();
+      if (!request.m_payload.empty() && !nodes.payloads.empty()) {
+        slot.m_payload = std::move(nodes.payloads.back());
+        nodes.payloads.pop_back();
+      }
+      slot = request;
+    };
+
+    void push(Request&& request) {
+      pool();
+      m_queue.emplace_back() = std::move(request);
+    };
 };
 
 struct Inst_Slot {
@@ -342,4 +485,4 @@ struct NMAInst_Slot {
 }        // namespace Ramulator
 
 
-#endif   // RAMULATOR_BASE_REQUEST_H
\ No newline at end of file
+#endif   // RAMULATOR_BASE_REQUEST_H
\ No newline at end of file
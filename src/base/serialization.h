@@ -1,7 +1,24 @@
 #ifndef     RAMULATOR_BASE_SERIALIZATION_H
 #define     RAMULATOR_BASE_SERIALIZATION_H
 
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <istream>
+#include <list>
+#include <map>
+#include <optional>
+#include <ostream>
+#include <set>
+#include <stdexcept>
 #include <string>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 
 namespace Ramulator {
@@ -29,6 +46,237 @@ class Serializable {
 };  
 
 
+struct Request;
+class Archive;
+
+// Overloads for the standard containers. They are declared before Archive::operator& so that 
+// containers of containers (e.g., std::vector<std::deque<Clk_t>>) resolve to them as well.
+template<typename T> void serialize(Archive& ar, T& value);
+inline void serialize(Archive& ar, std::string& value);
+inline void serialize(Archive& ar, std::vector<bool>& value);
+template<typename T, typename A> void serialize(Archive& ar, std::vector<T, A>& value);
+template<typename T, typename A> void serialize(Archive& ar, std::deque<T, A>& value);
+template<typename T, typename A> void serialize(Archive& ar, std::list<T, A>& value);
+template<typename T, size_t N> void serialize(Archive& ar, std::array<T, N>& value);
+template<typename T1, typename T2> void serialize(Archive& ar, std::pair<T1, T2>& value);
+template<typename... Ts> void serialize(Archive& ar, std::tuple<Ts...>& value);
+template<typename T> void serialize(Archive& ar, std::optional<T>& value);
+template<typename K, typename V, typename... Args> void serialize(Archive& ar, std::map<K, V, Args...>& value);
+template<typename K, typename V, typename... Args> void serialize(Archive& ar, std::unordered_map<K, V, Args...>& value);
+template<typename K, typename... Args> void serialize(Archive& ar, std::set<K, Args...>& value);
+template<typename K, typename... Args> void serialize(Archive& ar, std::unordered_set<K, Args...>& value);
+
+
+/**
+ * @brief    A binary archive that either saves the state of the simulation to a checkpoint or loads it back.
+ * 
+ * @details
+ * The same code saves and loads the state, e.g., "ar & m_clk & m_buffer;". 
+ * Trivially-copyable values are copied as raw bytes, standard containers element by element, 
+ * and any other class can take part by providing a "void serialize(Archive& ar)" member.
+ * 
+ */
+class Archive {
+  public:
+    using CallbackRestorer_t = std::function<std::function<void(Request&)>(const Request&)>;
+
+  private:
+    std::ostream* m_out = nullptr;
+    std::istream* m_in = nullptr;
+    CallbackRestorer_t m_callback_restorer;
+
+  public:
+    explicit Archive(std::ostream& out) : m_out(&out) {};
+    explicit Archive(std::istream& in) : m_in(&in) {};
+
+    bool is_loading() const { return m_in != nullptr; };
+
+    template<typename T>
+    Archive& operator&(T& value) {
+      serialize(*this, value);
+      return *this;
+    };
+
+    void bytes(void* data, size_t size) {
+      if (is_loading()) {
+        if (!m_in->read(static_cast<char*>(data), size)) {
+          throw std::runtime_error("The checkpoint is truncated!");
+        }
+      } else {
+        m_out->write(static_cast<const char*>(data), size);
+      }
+    };
+
+    /**
+     * @brief    Saves a tag, or checks that the same tag is loaded back (i.e., the checkpoint matches the simulated system).
+     * 
+     */
+    void tag(std::string tag) {
+      std::string saved_tag = tag;
+      *this & saved_tag;
+      if (saved_tag != tag) {
+        throw std::runtime_error("The checkpoint does not match the simulated system (expected \"" + tag + "\", found \"" + saved_tag + "\")!");
+      }
+    };
+
+    /**
+     * @brief    Callbacks cannot be saved. When loading, the callback of an in-flight request is asked from the restorer.
+     * 
+     */
+    void set_callback_restorer(CallbackRestorer_t restorer) { m_callback_restorer = std::move(restorer); };
+    std::function<void(Request&)> restore_callback(const Request& req) {
+      if (!m_callback_restorer) {
+        throw std::runtime_error("The checkpoint has a request with a callback, but no one can restore it!");
+      }
+      return m_callback_restorer(req);
+    };
+};
+
+
+template<typename T>
+void serialize(Archive& ar, T& value) {
+  if constexpr (requires { value.serialize(ar); }) {
+    value.serialize(ar);
+  } else {
+    static_assert(std::is_trivially_copyable_v<T> && !std::is_pointer_v<T>, "The type is not serializable!");
+    ar.bytes(&value, sizeof(T));
+  }
+}
+
+inline void serialize(Archive& ar, std::string& value) {
+  uint64_t size = value.size();
+  ar & size;
+  value.resize(size);
+  ar.bytes(value.data(), size);
+}
+
+inline void serialize(Archive& ar, std::vector<bool>& value) {
+  uint64_t size = value.size();
+  ar & size;
+  value.resize(size);
+  for (size_t i = 0; i < size; i++) {
+    bool bit = value[i];
+    ar & bit;
+    value[i] = bit;
+  }
+}
+
+template<typename T, typename A>
+void serialize(Archive& ar, std::vector<T, A>& value) {
+  uint64_t size = value.size();
+  ar & size;
+  if (ar.is_loading()) {
+    value.clear();
+    value.resize(size);
+  }
+  if constexpr (std::is_arithmetic_v<T>) {
+    ar.bytes(value.data(), size * sizeof(T));
+  } else {
+    for (auto& element : value) {
+      ar & element;
+    }
+  }
+}
+
+template<typename T, typename A>
+void serialize(Archive& ar, std::deque<T, A>& value) {
+  uint64_t size = value.size();
+  ar & size;
+  if (ar.is_loading()) {
+    value.clear();
+    value.resize(size);
+  }
+  for (auto& element : value) {
+    ar & element;
+  }
+}
+
+template<typename T, typename A>
+void serialize(Archive& ar, std::list<T, A>& value) {
+  uint64_t size = value.size();
+  ar & size;
+  if (ar.is_loading()) {
+    value.clear();
+    value.resize(size);
+  }
+  for (auto& element : value) {
+    ar & element;
+  }
+}
+
+template<typename T, size_t N>
+void serialize(Archive& ar, std::array<T, N>& value) {
+  for (auto& element : value) {
+    ar & element;
+  }
+}
+
+template<typename T1, typename T2>
+void serialize(Archive& ar, std::pair<T1, T2>& value) {
+  ar & value.first & value.second;
+}
+
+template<typename... Ts>
+void serialize(Archive& ar, std::tuple<Ts...>& value) {
+  std::apply([&ar](auto&... elements) { (ar & ... & elements); }, value);
+}
+
+template<typename T>
+void serialize(Archive& ar, std::optional<T>& value) {
+  bool has_value = value.has_value();
+  ar & has_value;
+  if (ar.is_loading()) {
+    value.reset();
+    if (has_value) {
+      value.emplace();
+    }
+  }
+  if (has_value) {
+    ar & *value;
+  }
+}
+
+// Saves the elements of an associative container, or loads them into the (cleared) container
+template<typename C, typename K, typename V>
+void serialize_associative(Archive& ar, C& container) {
+  uint64_t size = container.size();
+  ar & size;
+  if (ar.is_loading()) {
+    container.clear();
+    for (uint64_t i = 0; i < size; i++) {
+      K key{};
+      ar & key;
+      if constexpr (std::is_void_v<V>) {
+        container.insert(std::move(key));
+      } else {
+        V mapped{};
+        ar & mapped;
+        container.emplace(std::move(key), std::move(mapped));
+      }
+    }
+  } else {
+    for (auto& element : container) {
+      if constexpr (std::is_void_v<V>) {
+        K key = element;
+        ar & key;
+      } else {
+        K key = element.first;
+        ar & key & element.second;
+      }
+    }
+  }
+}
+
+template<typename K, typename V, typename... Args>
+void serialize(Archive& ar, std::map<K, V, Args...>& value) { serialize_associative<std::map<K, V, Args...>, K, V>(ar, value); }
+template<typename K, typename V, typename... Args>
+void serialize(Archive& ar, std::unordered_map<K, V, Args...>& value) { serialize_associative<std::unordered_map<K, V, Args...>, K, V>(ar, value); }
+template<typename K, typename... Args>
+void serialize(Archive& ar, std::set<K, Args...>& value) { serialize_associative<std::set<K, Args...>, K, void>(ar, value); }
+template<typename K, typename... Args>
+void serialize(Archive& ar, std::unordered_set<K, Args...>& value) { serialize_associative<std::unordered_set<K, Args...>, K, void>(ar, value); }
+
+
 }        // namespace Ramulator
 
 
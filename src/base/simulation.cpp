@@ -0,0 +1,64 @@
+#include <fstream>
+
+#include "base/simulation.h"
+#include "base/clock_scheduler.h"
+#include "frontend/frontend.h"
+#include "memory_system/memory_system.h"
+
+namespace Ramulator {
+
+void Simulation::run(IFrontEnd* frontend, IMemorySystem* memory_system) {
+  uint64_t step = 0;
+  run_until(frontend, memory_system, step);
+}
+
+bool Simulation::run_until(IFrontEnd* frontend, IMemorySystem* memory_system, uint64_t& step, uint64_t stop_step) {
+  // The clock ratios of the frontend and the memory system give the period of the other one, 
+  // i.e., the frontend ticks on every mem_tick-th step and the memory system on every frontend_tick-th step.
+  int frontend_tick = frontend->get_clock_ratio();
+  int mem_tick = memory_system->get_clock_ratio();
+
+  ClockScheduler scheduler;
+  scheduler.add_domain("Frontend", frontend, mem_tick);
+  scheduler.add_stop_condition([frontend, memory_system] { 
+    return frontend->is_finished() || memory_system->is_host_stall_terminated() || memory_system->is_converged(); 
+  });
+  scheduler.add_domain("MemorySystem", memory_system, frontend_tick);
+
+  return scheduler.run_until(step, stop_step);
+}
+
+void Checkpoint::serialize_system(Archive& ar) {
+  ar.tag("Ramulator 2.0 checkpoint v1");
+  ar & m_step;
+  // The frontend goes first, as it recreates the callbacks of the in-flight requests in the memory system
+  m_frontend->serialize_components(ar);
+  m_memory_system->serialize_components(ar);
+  ar.tag("End of checkpoint");
+}
+
+void Checkpoint::serialize() {
+  std::ofstream out(m_path, std::ios::binary);
+  if (!out) {
+    throw ConfigurationError("Checkpoint {} cannot be created!", m_path);
+  }
+  Archive ar(out);
+  serialize_system(ar);
+}
+
+void Checkpoint::deserialize() {
+  std::ifstream in(m_path, std::ios::binary);
+  if (!in) {
+    throw ConfigurationError("Checkpoint {} cannot be opened!", m_path);
+  }
+  Archive ar(in);
+  ar.set_callback_restorer([this](const Request& req) {
+    if (auto callback = m_memory_system->restore_callback(req)) {
+      return callback;
+    }
+    return m_frontend->restore_callback(req);
+  });
+  serialize_system(ar);
+}
+
+}        // namespace Ramulator
@@ -0,0 +1,83 @@
+#ifndef RAMULATOR_BASE_SIMULATION_H
+#define RAMULATOR_BASE_SIMULATION_H
+
+#include <cstdint>
+#include <limits>
+#include <string>
+
+#include "base/serialization.h"
+
+namespace Ramulator {
+
+class IFrontEnd;
+class IMemorySystem;
+
+namespace Simulation {
+
+inline constexpr uint64_t NEVER = std::numeric_limits<uint64_t>::max();
+
+/**
+ * @brief    Tick the (connected) frontend and memory system until the frontend is finished.
+ * 
+ * @details
+ * The frontend and the memory system are the two clock domains of a ClockScheduler. The frontend ticks 
+ * on every mem_tick-th step and the memory system on every frontend_tick-th step, where frontend_tick and 
+ * mem_tick are the clock ratios of the frontend and the memory system.
+ * Steps in which neither of them has anything to do are skipped. Slower units inside the memory system
+ * (e.g., the DDR5-pCH NDP units) are still ticked from the memory-system domain.
+ *
+ * @param    frontend       The frontend that drives the simulation.
+ * @param    memory_system  The memory system.
+ */
+void run(IFrontEnd* frontend, IMemorySystem* memory_system);
+
+/**
+ * @brief    Same as run(), but starts from the given step and stops before stop_step.
+ *
+ * @param    step           The step to start from. Updated to the step to resume from.
+ * @param    stop_step      The step before which to stop.
+ * @return   true           The frontend is finished.
+ * @return   false          Stopped at stop_step.
+ */
+bool run_until(IFrontEnd* frontend, IMemorySystem* memory_system, uint64_t& step, uint64_t stop_step = NEVER);
+
+}    // namespace Simulation
+
+
+/**
+ * @brief    A checkpoint of the whole simulated system, i.e., the frontend, the memory system, and the simulation step.
+ * 
+ * @details
+ * A checkpoint can only be restored into a system created from the same configuration 
+ * (parameters that do not change the components, e.g., timings or thresholds, may differ).
+ * 
+ */
+class Checkpoint : public Serializable<Checkpoint> {
+  private:
+    std::string m_path;
+    IFrontEnd* m_frontend;
+    IMemorySystem* m_memory_system;
+    uint64_t& m_step;
+
+  public:
+    Checkpoint(std::string path, IFrontEnd* frontend, IMemorySystem* memory_system, uint64_t& step):
+    m_path(path), m_frontend(frontend), m_memory_system(memory_system), m_step(step) {};
+
+    /**
+     * @brief    Saves the system to the checkpoint file.
+     * 
+     */
+    void serialize() override;
+
+    /**
+     * @brief    Restores the system from the checkpoint file.
+     * 
+     */
+    void deserialize() override;
+
+  private:
+    void serialize_system(Archive& ar);
+};
+}    // namespace Ramulator
+
+#endif   // RAMULATOR_BASE_SIMULATION_H
@@ -0,0 +1,271 @@
+#ifndef     RAMULATOR_BASE_SLOT_ARENA_H
+#define     RAMULATOR_BASE_SLOT_ARENA_H
+
+#include <cstdint>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "base/serialization.h"
+
+namespace Ramulator {
+
+/**
+ * @brief     Slab storage for the elements of the SlotQueues of one owner (e.g., a controller)
+ *
+ * @details
+ * Elements live in slots of fixed-size slabs that are never moved or freed, so references and
+ * iterators stay valid until the element is removed. A slot is named by its index, and the queues
+ * chain their slots through the prev/next indices stored next to the element. Released slots are
+ * chained into a free list and reused by the next push into any queue of the arena, so the arena
+ * stops allocating once the owner reaches its peak occupancy. A released slot keeps its element
+ * (the next push assigns over it), so the owner should release what the element holds onto first.
+ *
+ * An arena is not thread-safe, i.e., all its queues must be used by the same thread.
+ *
+ */
+template<typename T>
+class SlotArena {
+  public:
+    static constexpr int32_t NONE = -1;
+
+    struct Slot {
+      T value {};
+      int32_t prev = NONE;
+      int32_t next = NONE;
+    };
+
+  private:
+    static constexpr size_t SLAB_SIZE = 256;
+
+    std::vector<std::unique_ptr<Slot[]>> m_slabs;
+    int32_t m_free = NONE;                    // Head of the free list (chained through Slot::next)
+
+  public:
+    SlotArena() = default;
+    SlotArena(const SlotArena&) = delete;
+    SlotArena& operator=(const SlotArena&) = delete;
+
+    Slot& operator[](int32_t id) { return m_slabs[id / SLAB_SIZE][id % SLAB_SIZE]; };
+    const Slot& operator[](int32_t id) const { return m_slabs[id / SLAB_SIZE][id % SLAB_SIZE]; };
+
+    int32_t acquire() {
+      if (m_free == NONE) {
+        int32_t first = m_slabs.size() * SLAB_SIZE;
+        m_slabs.push_back(std::make_unique<Slot[]>(SLAB_SIZE));
+        for (size_t i = 0; i < SLAB_SIZE; i++) {
+          m_slabs.back()[i].next = (i + 1 < SLAB_SIZE) ? first + i + 1 : NONE;
+        }
+        m_free = first;
+      }
+      int32_t id = m_free;
+      m_free = (*this)[id].next;
+      return id;
+    };
+
+    void release(int32_t id) {
+      (*this)[id].next = m_free;
+      m_free = id;
+    };
+
+    size_t capacity() const { return m_slabs.size() * SLAB_SIZE; };
+};
+
+
+/**
+ * @brief     A FIFO queue whose elements live in a SlotArena
+ *
+ * @details
+ * Elements can be removed from anywhere in the queue, and splice_back() moves an element to the end
+ * of another queue of the same arena by relinking its slot, i.e., without copying it. An iterator
+ * stays valid (and follows the element into the other queue) until the element is removed.
+ * The queue must be bound to an arena before elements are pushed into it. Destroying a queue does not
+ * touch the arena (which may already be gone), i.e., the queues and their arena belong to the same owner.
+ *
+ */
+template<typename T>
+class SlotQueue {
+  public:
+    using Arena = SlotArena<T>;
+    static constexpr int32_t NONE = Arena::NONE;
+
+    class iterator {
+      friend class SlotQueue;
+
+      private:
+        Arena* m_arena = nullptr;
+        int32_t m_id = NONE;
+
+        iterator(Arena* arena, int32_t id) : m_arena(arena), m_id(id) {};
+
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T*;
+        using reference = T&;
+
+        iterator() = default;
+
+        T& operator*() const { return (*m_arena)[m_id].value; };
+        T* operator->() const { return &(*m_arena)[m_id].value; };
+        // Incrementing end() stays at end() (e.g., std::next(begin()) of an empty queue), as with the end of an empty std::list
+        iterator& operator++() {
+          if (m_id != NONE) {
+            m_id = (*m_arena)[m_id].next;
+          }
+          return *this;
+        };
+        iterator operator++(int) { iterator it = *this; ++(*this); return it; };
+        bool operator==(const iterator& other) const { return m_id == other.m_id; };
+        bool operator!=(const iterator& other) const { return m_id != other.m_id; };
+    };
+
+  private:
+    Arena* m_arena = nullptr;   // Not owned
+    int32_t m_head = NONE;
+    int32_t m_tail = NONE;
+    size_t m_size = 0;
+
+  public:
+    SlotQueue() = default;
+    explicit SlotQueue(Arena* arena) : m_arena(arena) {};
+
+    SlotQueue(const SlotQueue& other) : m_arena(other.m_arena) {
+      for (const T& value : other) {
+        push_back(value);
+      }
+    };
+
+    SlotQueue(SlotQueue&& other) noexcept :
+      m_arena(other.m_arena), m_head(other.m_head), m_tail(other.m_tail), m_size(other.m_size) {
+      other.m_head = other.m_tail = NONE;
+      other.m_size = 0;
+    };
+
+    SlotQueue& operator=(const SlotQueue& other) {
+      if (this != &other) {
+        clear();
+        if (!m_arena) {
+          m_arena = other.m_arena;
+        }
+        for (const T& value : other) {
+          push_back(value);
+        }
+      }
+      return *this;
+    };
+
+    SlotQueue& operator=(SlotQueue&& other) noexcept {
+      if (this != &other) {
+        clear();
+        m_arena = other.m_arena;
+        m_head = other.m_head;
+        m_tail = other.m_tail;
+        m_size = other.m_size;
+        other.m_head = other.m_tail = NONE;
+        other.m_size = 0;
+      }
+      return *this;
+    };
+
+    /**
+     * @brief     Binds the (empty) queue to an arena
+     */
+    void bind(Arena* arena) { m_arena = arena; };
+    Arena* arena() const { return m_arena; };
+
+    iterator begin() const { return iterator(m_arena, m_head); };
+    iterator end() const { return iterator(m_arena, NONE); };
+
+    size_t size() const { return m_size; };
+    bool empty() const { return m_size == 0; };
+
+    T& front() { return (*m_arena)[m_head].value; };
+    const T& front() const { return (*m_arena)[m_head].value; };
+
+    /**
+     * @brief     Appends a slot and returns its element to be assigned to (it holds whatever the slot held before)
+     */
+    T& emplace_back() {
+      int32_t id = m_arena->acquire();
+      link_back(id);
+      return (*m_arena)[id].value;
+    };
+
+    void push_back(const T& value) { emplace_back() = value; };
+    void push_back(T&& value) { emplace_back() = std::move(value); };
+
+    void erase(iterator it) {
+      unlink(it.m_id);
+      m_arena->release(it.m_id);
+    };
+
+    void pop_front() { erase(begin()); };
+
+    void clear() {
+      while (m_size > 0) {
+        pop_front();
+      }
+    };
+
+    /**
+     * @brief     Moves the element of another queue of the same arena to the end of this queue
+     */
+    void splice_back(iterator it, SlotQueue& src) {
+      src.unlink(it.m_id);
+      link_back(it.m_id);
+    };
+
+    void serialize(Archive& ar) {
+      uint64_t size = m_size;
+      ar & size;
+      if (ar.is_loading()) {
+        clear();
+        for (uint64_t i = 0; i < size; i++) {
+          T value;
+          ar & value;
+          push_back(std::move(value));
+        }
+      } else {
+        for (T& value : *this) {
+          ar & value;
+        }
+      }
+    };
+
+  private:
+    void link_back(int32_t id) {
+      auto& slot = (*m_arena)[id];
+      slot.prev = m_tail;
+      slot.next = NONE;
+      if (m_tail == NONE) {
+        m_head = id;
+      } else {
+        (*m_arena)[m_tail].next = id;
+      }
+      m_tail = id;
+      m_size++;
+    };
+
+    void unlink(int32_t id) {
+      auto& slot = (*m_arena)[id];
+      if (slot.prev == NONE) {
+        m_head = slot.next;
+      } else {
+        (*m_arena)[slot.prev].next = slot.next;
+      }
+      if (slot.next == NONE) {
+        m_tail = slot.prev;
+      } else {
+        (*m_arena)[slot.next].prev = slot.prev;
+      }
+      m_size--;
+    };
+};
+
+}        // namespace Ramulator
+
+#endif   // RAMULATOR_BASE_SLOT_ARENA_H
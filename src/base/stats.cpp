@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "base/stats.h"
 
 namespace Ramulator {
@@ -9,4 +11,18 @@ YAML::Emitter& operator << (YAML::Emitter& emitter, const Stats& s) {
 	return emitter;
 }
 
+void Stats::serialize(Archive& ar) {
+  // In name order, since the order of the registry depends on its history
+  std::vector<std::string> stat_names;
+  for (const auto& [stat_name, stat_ptr] : _registry) {
+    stat_names.push_back(stat_name);
+  }
+  std::sort(stat_names.begin(), stat_names.end());
+
+  for (const auto& stat_name : stat_names) {
+    ar.tag(stat_name);
+    _registry.at(stat_name)->serialize(ar);
+  }
+}
+
 }        // namespace Ramulator
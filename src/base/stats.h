@@ -10,6 +10,7 @@
 
 #include "base/type.h"
 #include "base/exception.h"
+#include "base/serialization.h"
 
 
 namespace Ramulator {
@@ -18,6 +19,7 @@ class Implementation;
 class StatWrapperBase {
   public:
     virtual void emit_to(YAML::Emitter& emitter) = 0;
+    virtual void serialize(Archive& ar) = 0;
 };
 
 template<typename T>
@@ -35,6 +37,12 @@ class Stats {
     bool is_empty() {
       return _registry.size() == 0;
     }
+
+    /**
+     * @brief    Saves (or loads) the values of all registered statistics to (or from) a checkpoint.
+     * 
+     */
+    void serialize(Archive& ar);
 };
 
 
@@ -89,6 +97,14 @@ class StatWrapper : public StatWrapperBase {
       }
 
     };
+
+    void serialize(Archive& ar) override {
+      if (std::holds_alternative<T*>(_ref)) {
+        ar & *(std::get<T*>(_ref));
+      } else {
+        ar & *(std::get<std::vector<T>*>(_ref));
+      }
+    };
 };
 
 }        // namespace Ramulator
@@ -1,17 +1,113 @@
 #ifndef     RAMULATOR_BASE_TYPE_H
 #define     RAMULATOR_BASE_TYPE_H
 
+#include <array>
 #include <vector>
 #include <unordered_map>
 #include <string>
+#include <stdexcept>
 #include <type_traits>
+#include <initializer_list>
 
 
 namespace Ramulator {
 
+/**
+ * @brief    A vector with a fixed capacity whose elements are stored inline (i.e., it never allocates)
+ * 
+ */
+template<typename T, size_t N>
+class FixedVector {
+  private:
+    std::array<T, N> m_data{};
+    size_t m_size = 0;
+
+  public:
+    using value_type = T;
+    using size_type = size_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    FixedVector() = default;
+    explicit FixedVector(size_t size, const T& value = T()) { resize(size, value); };
+    FixedVector(std::initializer_list<T> values) { assign(values.begin(), values.end()); };
+    FixedVector(const std::vector<T>& values) { assign(values.begin(), values.end()); };
+
+    static constexpr size_t capacity() { return N; };
+    size_t size() const { return m_size; };
+    bool empty() const { return m_size == 0; };
+
+    T& operator[](size_t i) { return m_data[i]; };
+    const T& operator[](size_t i) const { return m_data[i]; };
+    T& front() { return m_data[0]; };
+    const T& front() const { return m_data[0]; };
+    T& back() { return m_data[m_size - 1]; };
+    const T& back() const { return m_data[m_size - 1]; };
+    T* data() { return m_data.data(); };
+    const T* data() const { return m_data.data(); };
+
+    iterator begin() { return m_data.data(); };
+    iterator end() { return m_data.data() + m_size; };
+    const_iterator begin() const { return m_data.data(); };
+    const_iterator end() const { return m_data.data() + m_size; };
+
+    void clear() { m_size = 0; };
+
+    void resize(size_t size, const T& value = T()) {
+      check_capacity(size);
+      for (size_t i = m_size; i < size; i++) {
+        m_data[i] = value;
+      }
+      m_size = size;
+    };
+
+    void assign(size_t size, const T& value) {
+      clear();
+      resize(size, value);
+    };
+
+    template<typename It>
+    void assign(It first, It last) {
+      clear();
+      for (; first != last; first++) {
+        push_back(*first);
+      }
+    };
+
+    void push_back(const T& value) {
+      check_capacity(m_size + 1);
+      m_data[m_size++] = value;
+    };
+
+    void pop_back() { m_size--; };
+
+    bool operator==(const FixedVector& other) const {
+      if (m_size != other.m_size) {
+        return false;
+      }
+      for (size_t i = 0; i < m_size; i++) {
+        if (m_data[i] != other.m_data[i]) {
+          return false;
+        }
+      }
+      return true;
+    };
+
+  private:
+    static void check_capacity(size_t size) {
+      if (size > N) {
+        throw std::length_error("FixedVector capacity (" + std::to_string(N) + ") exceeded!");
+      }
+    };
+};
+
+inline constexpr size_t MAX_ADDR_LEVELS = 12;   // The most organization levels of any standard (e.g., DDR5-pCH has 9)
+
 using Clk_t     = int64_t;            // Clock cycle
 using Addr_t    = int64_t;            // Plain address as seen by the OS
-using AddrVec_t = std::vector<int>;   // Device address vector as is sent to the device from the controller
+using AddrVec_t = FixedVector<int, MAX_ADDR_LEVELS>;   // Device address vector as is sent to the device from the controller
 
 template<typename T>
 using Registry_t = std::unordered_map<std::string, T>;
@@ -0,0 +1,451 @@
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <random>
+
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <argparse/argparse.hpp>
+#include <spdlog/spdlog.h>
+
+#include "base/base.h"
+#include "base/config.h"
+#include "base/simulation.h"
+#include "frontend/frontend.h"
+#include "memory_system/memory_system.h"
+
+namespace Ramulator {
+
+/**
+ * @brief    Synthetic traffic of ramulator-bench: num_requests requests (80% reads) with at most max_outstanding reads in flight
+ *
+ */
+class BenchTraffic final : public IFrontEnd, public Implementation {
+  RAMULATOR_REGISTER_IMPLEMENTATION(IFrontEnd, BenchTraffic, "BenchTraffic", "Synthetic traffic of ramulator-bench.")
+
+  private:
+    static constexpr Addr_t m_addr_mask = (Addr_t(1) << 30) - 1;
+    static constexpr Addr_t m_line_size = 64;
+
+    uint64_t m_num_requests = 0;
+    int m_max_outstanding = 0;
+    bool m_is_stream = false;
+    uint64_t m_max_cycles = 0;
+
+    std::mt19937_64 m_rng{42};
+    Addr_t m_stream_addr = 0;
+
+    // The next request to issue (kept until the memory system accepts it)
+    bool m_is_write = false;
+    Addr_t m_addr = 0;
+
+    Clk_t m_clk = 0;
+    uint64_t m_num_issued = 0;
+    uint64_t m_num_completed = 0;
+    int m_num_outstanding = 0;
+
+  public:
+    void init() override {
+      m_clock_ratio = param<uint>("clock_ratio").default_val(1);
+      m_num_requests = param<uint64_t>("num_requests").required();
+      m_max_outstanding = param<int>("max_outstanding").required();
+      m_is_stream = param<bool>("is_stream").default_val(false);
+      m_max_cycles = m_num_requests * 1000;
+      generate();
+    };
+
+    void tick() override {
+      m_clk++;
+      while (m_num_issued < m_num_requests && m_num_outstanding < m_max_outstanding) {
+        Request req(m_addr, m_is_write ? Request::Type::Write : Request::Type::Read);
+        if (!m_is_write) {
+          req.callback = [this](Request&) { m_num_outstanding--; m_num_completed++; };
+        }
+        if (!m_memory_system->send(req)) {
+          break;
+        }
+        m_num_issued++;
+        if (m_is_write) {
+          m_num_completed++;
+        } else {
+          m_num_outstanding++;
+        }
+        generate();
+      }
+
+      if (uint64_t(m_clk) > m_max_cycles) {
+        throw std::runtime_error(fmt::format("No progress after {} cycles ({} of {} requests completed)!", m_max_cycles, m_num_completed, m_num_requests));
+      }
+    };
+
+    bool is_finished() override { return m_num_completed >= m_num_requests; };
+
+    uint64_t get_num_completed() const { return m_num_completed; };
+
+  private:
+    void generate() {
+      m_is_write = (m_rng() % 5) == 0;
+      if (m_is_stream) {
+        m_addr = m_stream_addr;
+        m_stream_addr = (m_stream_addr + m_line_size) & m_addr_mask;
+      } else {
+        m_addr = (m_rng() & m_addr_mask) & ~(m_line_size - 1);
+      }
+    };
+};
+
+}        // namespace Ramulator
+
+/**
+ * @brief    A fixed benchmark scenario: a memory system driven by synthetic traffic generated in-process
+ *
+ */
+struct Scenario {
+  std::string name;
+  std::string desc;
+  std::string memory_system;    // The "MemorySystem" part of the configuration
+  bool is_stream;               // Sequential (instead of uniformly random) addresses
+};
+
+const std::string ddr5_generic_config = R"(
+  impl: GenericDRAM
+  clock_ratio: 1
+  DRAM:
+    impl: DDR5
+    org:
+      preset: DDR5_16Gb_x4
+      channel: 2
+      rank: 4
+    timing:
+      preset: DDR5_4800B
+    RFM:
+      BRC: 0
+    drampower_enable: true
+    voltage:
+      preset: Default
+    current:
+      preset: DDR5_4800x4
+  Controller:
+    impl: Generic
+    Scheduler:
+      impl: FRFCFS
+    RefreshManager:
+      impl: AllBank
+    RowPolicy:
+      impl: ClosedRowPolicy
+      cap: 128
+    plugins:
+  AddrMapper:
+    impl: RoBaCoRaCh
+)";
+
+const std::string ddr5_rowhammer_config = R"(
+  impl: GenericDRAM
+  clock_ratio: 1
+  DRAM:
+    impl: DDR5
+    org:
+      preset: DDR5_16Gb_x4
+      channel: 2
+      rank: 4
+    timing:
+      preset: DDR5_4800B
+    RFM:
+      BRC: 2
+    drampower_enable: true
+    voltage:
+      preset: Default
+    current:
+      preset: DDR5_4800x4
+  Controller:
+    impl: Generic
+    Scheduler:
+      impl: FRFCFS
+    RefreshManager:
+      impl: AllBank
+    RowPolicy:
+      impl: ClosedRowPolicy
+      cap: 128
+    plugins:
+      - ControllerPlugin:
+          impl: RFMManager
+          rfm_thresh: 16
+      - ControllerPlugin:
+          impl: CommandCounter
+          path: /dev/null
+          commands_to_count: [ACT, PRE, RD, WR, RFMab]
+  AddrMapper:
+    impl: RoBaCoRaCh
+)";
+
+const std::string ddr5_pch_ndp_config = R"(
+  impl: ndpDRAM
+  clock_ratio: 1
+  trace_core_enable: false
+  DRAM:
+    impl: DDR5-pCH
+    org:
+      preset: DDR5_16Gb_DBX_x4
+      channel: 2
+      pseudochannel: 4
+      rank: 1
+      dq: 4
+      real_dq: 4
+      io_boost: 1
+    timing:
+      preset: DDR5_4800B
+    RFM:
+      BRC: 0
+    drampower_enable: true
+    use_db_fetch: true
+    ndp_inst_slot: 8
+    voltage:
+      preset: Default
+    current:
+      preset: DDR5_4800x4
+  Controller:
+    impl: ndpDRAMCtrl
+    Scheduler:
+      impl: NDPFRFCFS
+    RefreshManager:
+      impl: DR5CHAllBank
+    RowPolicy:
+      impl: ClosedRowPolicyPch
+      cap: 128
+    plugins:
+  AddrMapper:
+    impl: RoRaBkBgCoPcCh
+)";
+
+const std::string asyncdimm_concurrent_config = R"(
+  impl: AsyncDIMM
+  clock_ratio: 1
+  concurrent_mode_enable: true
+  trace_core_enable: false
+  DRAM:
+    impl: DDR5-AsyncDIMM
+    org:
+      preset: DDR5_16Gb_x4
+      channel: 2
+      rank: 4
+      dq: 4
+    timing:
+      preset: DDR5_4800B
+    RFM:
+      BRC: 0
+    drampower_enable: true
+    voltage:
+      preset: Default
+    current:
+      preset: DDR5_4800x4
+  Controller:
+    impl: AsyncDIMMHost
+    Scheduler:
+      impl: FRFCFS
+    RefreshManager:
+      impl: AllBank
+    RowPolicy:
+      impl: ClosedRowPolicy
+      cap: 128
+    plugins:
+  AddrMapper:
+    impl: RoBaCoRaCh
+)";
+
+const std::vector<Scenario> scenarios = {
+  {"ddr5_generic_frfcfs_random", "DDR5, Generic controller, FRFCFS, random traffic",                  ddr5_generic_config,         false},
+  {"ddr5_generic_frfcfs_stream", "DDR5, Generic controller, FRFCFS, streaming traffic",               ddr5_generic_config,         true },
+  {"ddr5_pch_ndp",               "DDR5-pCH, NDP controller, random host traffic",                     ddr5_pch_ndp_config,         false},
+  {"asyncdimm_concurrent",       "DDR5-AsyncDIMM, host controller in concurrent mode, random traffic", asyncdimm_concurrent_config, false},
+  {"ddr5_rowhammer_rfm",         "DDR5, Generic controller, RFMManager + CommandCounter plugins",     ddr5_rowhammer_config,       false},
+};
+
+
+struct BenchResult {
+  uint64_t num_requests = 0;
+  uint64_t num_cycles = 0;
+  double wall_time_s = 0.0;
+  long peak_rss_kb = 0;
+};
+
+/**
+ * @brief    Simulates num_requests requests (80% reads) of the scenario with at most max_outstanding reads in flight.
+ *
+ */
+BenchResult run_scenario(const Scenario& scenario, uint64_t num_requests, int max_outstanding) {
+  YAML::Node config;
+  config["Frontend"]["impl"] = "BenchTraffic";
+  config["Frontend"]["clock_ratio"] = 1;
+  config["Frontend"]["num_requests"] = num_requests;
+  config["Frontend"]["max_outstanding"] = max_outstanding;
+  config["Frontend"]["is_stream"] = scenario.is_stream;
+  config["MemorySystem"] = YAML::Load(scenario.memory_system);
+
+  auto frontend = Ramulator::Factory::create_frontend(config);
+  auto memory_system = Ramulator::Factory::create_memory_system(config);
+  frontend->connect_memory_system(memory_system);
+  memory_system->connect_frontend(frontend);
+
+  // Driven by the same loop as ramulator2, so that the benchmark includes the skipping of idle cycles
+  BenchResult result;
+  uint64_t step = 0;
+  auto start = std::chrono::steady_clock::now();
+  Ramulator::Simulation::run_until(frontend, memory_system, step);
+  auto end = std::chrono::steady_clock::now();
+
+  result.num_requests = static_cast<Ramulator::BenchTraffic*>(frontend)->get_num_completed();
+  result.num_cycles = step;
+  result.wall_time_s = std::chrono::duration<double>(end - start).count();
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  result.peak_rss_kb = usage.ru_maxrss;
+  return result;
+}
+
+/**
+ * @brief    Runs the scenario in a child process (so that the peak RSS is its own) and returns its result as a JSON object.
+ *
+ */
+std::string run_scenario_isolated(const Scenario& scenario, uint64_t num_requests, int max_outstanding) {
+  int fds[2];
+  if (pipe(fds) != 0) {
+    throw std::runtime_error("Cannot create a pipe!");
+  }
+
+  pid_t pid = fork();
+  if (pid < 0) {
+    throw std::runtime_error("Cannot fork!");
+  }
+  if (pid == 0) {
+    // Keep the components' console output out of the results
+    close(fds[0]);
+    int dev_null = open("/dev/null", O_WRONLY);
+    dup2(dev_null, STDOUT_FILENO);
+
+    std::string json;
+    try {
+      BenchResult r = run_scenario(scenario, num_requests, max_outstanding);
+      json = fmt::format(
+        "{{\"scenario\": \"{}\", \"requests\": {}, \"cycles\": {}, \"wall_time_s\": {:.6f}, "
+        "\"cycles_per_s\": {:.1f}, \"requests_per_s\": {:.1f}, \"peak_rss_kb\": {}}}",
+        scenario.name, r.num_requests, r.num_cycles, r.wall_time_s,
+        r.num_cycles / r.wall_time_s, r.num_requests / r.wall_time_s, r.peak_rss_kb
+      );
+    } catch (const std::exception& e) {
+      std::string error = e.what();
+      std::replace(error.begin(), error.end(), '"', '\'');
+      json = fmt::format("{{\"scenario\": \"{}\", \"error\": \"{}\"}}", scenario.name, error);
+    }
+    // The parent reports an empty result as a failure, so a failed write only needs a distinct exit status
+    size_t written = 0;
+    while (written < json.size()) {
+      ssize_t n = write(fds[1], json.data() + written, json.size() - written);
+      if (n < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        _exit(1);
+      }
+      written += n;
+    }
+    close(fds[1]);
+    _exit(0);
+  }
+
+  close(fds[1]);
+  std::string json;
+  char buffer[4096];
+  ssize_t n;
+  while ((n = read(fds[0], buffer, sizeof(buffer))) > 0) {
+    json.append(buffer, n);
+  }
+  close(fds[0]);
+
+  int status = 0;
+  waitpid(pid, &status, 0);
+  if (json.empty()) {
+    json = fmt::format("{{\"scenario\": \"{}\", \"error\": \"Terminated with status {}\"}}", scenario.name, status);
+  }
+  return json;
+}
+
+int main(int argc, char* argv[]) {
+  // Parse command line arguments
+  argparse::ArgumentParser program("Ramulator-Bench", "2.0");
+  program.add_argument("-s", "--scenario").metavar("NAME")
+    .append()
+    .help("Scenario to run. Repeat this option to run multiple scenarios (default: all).");
+  program.add_argument("-n", "--requests").metavar("N")
+    .scan<'i', int>()
+    .default_value(200000)
+    .help("Number of requests simulated per scenario.");
+  program.add_argument("-m", "--max_outstanding").metavar("N")
+    .scan<'i', int>()
+    .default_value(64)
+    .help("Maximum number of reads in flight.");
+  program.add_argument("-o", "--output").metavar("path-to-output-file")
+    .help("File to append the results to (one JSON object per scenario and line) instead of stdout.");
+  program.add_argument("-l", "--list")
+    .default_value(false).implicit_value(true)
+    .help("List the scenarios and exit.");
+
+  try {
+    program.parse_args(argc, argv);
+  }
+  catch (const std::runtime_error& err) {
+    spdlog::error(err.what());
+    std::cerr << program;
+    std::exit(1);
+  }
+
+  if (program.get<bool>("--list")) {
+    for (const auto& scenario : scenarios) {
+      std::cout << fmt::format("{:<28} {}", scenario.name, scenario.desc) << std::endl;
+    }
+    return 0;
+  }
+
+  std::vector<const Scenario*> selected;
+  if (auto arg = program.present<std::vector<std::string>>("-s")) {
+    for (const auto& name : *arg) {
+      auto it = std::find_if(scenarios.begin(), scenarios.end(), [&](const Scenario& s) { return s.name == name; });
+      if (it == scenarios.end()) {
+        spdlog::error("Unknown scenario {}!", name);
+        std::exit(1);
+      }
+      selected.push_back(&(*it));
+    }
+  } else {
+    for (const auto& scenario : scenarios) {
+      selected.push_back(&scenario);
+    }
+  }
+
+  std::ofstream output_file;
+  if (auto arg = program.present<std::string>("-o")) {
+    output_file.open(*arg, std::ios::app);
+    if (!output_file) {
+      spdlog::error("Cannot open {}!", *arg);
+      std::exit(1);
+    }
+  }
+  std::ostream& output = output_file.is_open() ? output_file : std::cout;
+
+  uint64_t num_requests = program.get<int>("-n");
+  int max_outstanding = program.get<int>("-m");
+  bool has_error = false;
+  for (const auto* scenario : selected) {
+    std::string json = run_scenario_isolated(*scenario, num_requests, max_outstanding);
+    has_error |= json.find("\"error\"") != std::string::npos;
+    output << json << std::endl;
+  }
+
+  return has_error ? 1 : 0;
+}
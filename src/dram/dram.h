@@ -4,11 +4,16 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <algorithm>
 #include <functional>
+#include <memory>
 
 #include "base/base.h"
 #include "dram/spec.h"
+#include "dram/spec_ids.h"
 #include "dram/node.h"
+#include "dram/future_actions.h"
+#include "dram/energy_trace.h"
 
 namespace Ramulator {
 
@@ -38,8 +43,11 @@ class IDRAM : public Clocked<IDRAM> {
     SpecDef m_requests;                                     // The definition of all requests supported
     SpecLUT<Command_t> m_request_translations{m_requests};  // A LUT of the final DRAM commands needed by every request
 
-    // TODO: make this a priority queue
-    std::vector<FutureAction> m_future_actions;  // A vector of requests that requires future state changes
+    // Bumped on every change to the timing of a channel's nodes (e.g., a command is issued), see check_ready(Request&)
+    std::vector<uint64_t> m_ready_clk_epochs;
+
+    FutureActionWheel m_future_actions;  // The future state changes (e.g., refresh-end) of the issued commands
+    std::vector<std::vector<FutureAction>> m_staged_future_actions;  // Per-channel future actions while the channels are ticked in parallel
 
   /************************************************
    *                Node States
@@ -56,6 +64,8 @@ class IDRAM : public Clocked<IDRAM> {
     SpecDef m_timings;                      // The names of the timing constraints
     SpecLUT<int> m_timing_vals{m_timings};  // The LUT of the values for each timing constraints
 
+    SpecIds m_ids;                      // The ids of the commands, levels, timings, and requests the controllers use
+
     TimingCons m_timing_cons;           // The actual timing constraints used by Ramulator's DRAM model
 
     Clk_t m_read_latency = -1;          // Number of cycles needed between issuing RD command and receiving data.
@@ -75,6 +85,8 @@ class IDRAM : public Clocked<IDRAM> {
 
     bool m_power_debug = false;
 
+    std::unique_ptr<EnergyTrace> m_energy_trace;  // The per-epoch energy trace of the ranks (if enabled)
+
     double s_total_background_energy = 0; // (nJ) Total background energy consumed by the device
     double s_total_cmd_energy = 0;        // (nJ) Total command energy consumed by the device
     double s_total_energy = 0;            // (nJ) Total energy consumed by the device
@@ -92,11 +104,38 @@ class IDRAM : public Clocked<IDRAM> {
     /**
      * @brief   Issues a command with its address to the device.
      * @details
-     * Issues the given command with its address to the device. This function should then update
-     * the states of involved nodes in the device hierarchy and their timing information.
+     * Invalidates the ready clocks cached for the channel (see check_ready(Request&)) and
+     * lets the standard update the device (see issue_device_command()).
+     * 
+     */
+    void issue_command(int command, const AddrVec_t& addr_vec) {
+      invalidate_ready_clks(addr_vec[0]);
+      issue_device_command(command, addr_vec);
+    };
+
+    /**
+     * @brief   Updates the device for a command issued with its address.
+     * @details
+     * The standard should update the states of involved nodes in the device hierarchy and their timing information.
+     * 
+     */
+    virtual void issue_device_command(int command, const AddrVec_t& addr_vec) = 0;
+
+    /**
+     * @brief   Applies only the state changes (e.g., opening a row) of a command, without timing, power, or future actions.
+     * 
+     */
+    virtual void functional_issue_command(int command, const AddrVec_t& addr_vec) {
+      throw ConfigurationError("DRAM {} does not support functional accesses!", m_impl->get_name());
+    };
+
+    /**
+     * @brief   Throws a ConfigurationError if the standard does not support functional accesses.
      * 
      */
-    virtual void issue_command(int command, const AddrVec_t& addr_vec) = 0;
+    virtual void check_functional_access() {
+      throw ConfigurationError("DRAM {} does not support functional accesses!", m_impl->get_name());
+    };
 
     /**
      * @brief    Returns the prequisite command of the given command and address
@@ -118,6 +157,36 @@ class IDRAM : public Clocked<IDRAM> {
      */
     virtual bool check_ready(int command, const AddrVec_t& addr_vec) = 0;
 
+    /**
+     * @brief     Returns the earliest cycle at which the device may accept the given command.
+     * @details
+     * check_ready() fails before this cycle until the timing of the channel changes (see invalidate_ready_clks()).
+     * Standards with a node tree return the latest ready clock of the command along the path of the address,
+     * the default can only tell whether the command is ready in the current cycle.
+     * 
+     */
+    virtual Clk_t get_ready_clk(int command, const AddrVec_t& addr_vec) {
+      return check_ready(command, addr_vec) ? m_clk : m_clk + 1;
+    };
+
+    /**
+     * @brief     Checks whether the device is ready to accept the current command of the request.
+     * @details
+     * Caches the ready clock of the command in the request, so a request that is blocked (e.g., on tRCD or tFAW)
+     * is skipped without walking the nodes until its ready clock, or until its command or the timing of its channel changes.
+     * 
+     */
+    bool check_ready(Request& req) {
+      uint64_t epoch = ready_clk_epoch(req.addr_vec[0]);
+      if (req.ready_command == req.command && req.ready_epoch == epoch && m_clk < req.ready_clk) {
+        return false;
+      }
+      req.ready_command = req.command;
+      req.ready_epoch = epoch;
+      req.ready_clk = get_ready_clk(req.command, req.addr_vec);
+      return m_clk >= req.ready_clk;
+    };
+
     /**
      * @brief     Checks whether the command will result in a rowbuffer hit
      * @details
@@ -143,6 +212,100 @@ class IDRAM : public Clocked<IDRAM> {
      */
     virtual void notify(std::string_view key, uint64_t value) {};
 
+    /**
+     * @brief     Returns the earliest cycle at which tick() changes any device state
+     * @details
+     * The default covers standards whose tick() only resolves m_future_actions (and samples
+     * m_energy_trace). Standards
+     * that do per-cycle work in tick() must override this (e.g., return m_clk + 1).
+     * 
+     */
+    virtual Clk_t get_next_event_clk() {
+      Clk_t next_clk = m_future_actions.next_clk();
+      if (m_energy_trace) {
+        next_clk = std::min(next_clk, m_energy_trace->next_clk());
+      }
+      return next_clk;
+    };
+
+    /**
+     * @brief     Advances the device to the given cycle, assuming no future action is due in between
+     */
+    virtual void fast_forward(Clk_t clk) { m_clk = clk; };
+
+    /**
+     * @brief     Records a state change of the device that happens at a future clock cycle
+     * @details
+     * While the channels are ticked in parallel, future actions are staged per channel and
+     * appended by commit_future_actions() in channel order, i.e., in the same order as a serial run.
+     * An action at or before the current cycle is dropped, as its cycle has already been ticked.
+     * 
+     */
+    void add_future_action(int command, const AddrVec_t& addr_vec, Clk_t clk) {
+      if (clk <= m_clk) {
+        return;
+      }
+      if (m_staged_future_actions.empty()) {
+        m_future_actions.push({command, addr_vec, clk});
+      } else {
+        m_staged_future_actions[addr_vec[0]].push_back({command, addr_vec, clk});
+      }
+    };
+
+    /**
+     * @brief     Invalidates the ready clocks cached in the requests to the channel
+     * @details
+     * Every command updates the timing of some node on the path of every address in its channel (e.g., the
+     * sibling timing of the ranks), so issue_command() calls this for every issued command. Standards call
+     * it for the other changes that affect the ready clocks.
+     * 
+     */
+    void invalidate_ready_clks(int channel_id) {
+      ready_clk_epoch(channel_id)++;
+    };
+
+    void set_channel_parallel(bool enable) {
+      // Size the epochs before the channels are ticked from several threads
+      ready_clk_epoch(0);
+      m_staged_future_actions.clear();
+      if (enable) {
+        m_staged_future_actions.resize(m_organization.count[0]);
+      }
+    };
+
+    /**
+     * @brief     Returns the ready clock epoch of the channel
+     * @details
+     * The epochs are sized on the first use, as the number of channels is only known once the standard is initialized.
+     * 
+     */
+    uint64_t& ready_clk_epoch(int channel_id) {
+      if (m_ready_clk_epochs.empty()) {
+        m_ready_clk_epochs.resize(m_organization.count[0], 0);
+      }
+      return m_ready_clk_epochs[channel_id];
+    };
+
+    void commit_future_actions() {
+      for (auto& staged_actions : m_staged_future_actions) {
+        for (auto& action : staged_actions) {
+          m_future_actions.push(action);
+        }
+        staged_actions.clear();
+      }
+    };
+
+    /**
+     * @brief     Saves/loads the device states common to all standards (the node states are saved by the implementation)
+     */
+    void serialize_device(Archive& ar) {
+      ar & m_clk & m_future_actions & m_power_stats;
+      ar & s_total_background_energy & s_total_cmd_energy & s_total_energy & s_total_dq_energy;
+      if (m_energy_trace) {
+        ar & *m_energy_trace;
+      }
+    };
+
     /**
      * @brief     
     */
@@ -208,6 +371,7 @@ class IDRAM : public Clocked<IDRAM> {
   IDRAM::m_timings = m_timings; \
   IDRAM::m_voltages = m_voltages; \
   IDRAM::m_currents = m_currents; \
+  IDRAM::m_ids.resolve(IDRAM::m_commands, IDRAM::m_levels, IDRAM::m_timings, IDRAM::m_requests); \
 
 }        // namespace Ramulator
 
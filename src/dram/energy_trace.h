@@ -0,0 +1,287 @@
+#ifndef RAMULATOR_DRAM_ENERGY_TRACE_H
+#define RAMULATOR_DRAM_ENERGY_TRACE_H
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <fstream>
+#include <filesystem>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <iterator>
+
+#include <spdlog/spdlog.h>
+
+#include "base/type.h"
+#include "base/serialization.h"
+#include "base/exception.h"
+#include "dram/spec.h"
+
+namespace Ramulator {
+
+/**
+ * @brief     Writes text to a file from a background thread
+ *
+ * @details
+ * The simulation appends to an in-memory buffer, and a full buffer is handed over to the writer thread.
+ * The simulation only waits if the writer falls behind by more than MAX_PENDING buffers.
+ * The file is opened when the first buffer is handed over, so it can still be switched to continue
+ * the existing file at a given size (e.g., when restoring a checkpoint) instead of overwriting it.
+ *
+ */
+class BufferedFileWriter {
+  private:
+    static constexpr size_t BUFFER_SIZE = 1 << 20;
+    static constexpr size_t MAX_PENDING = 8;
+
+    std::string m_path;
+    std::ios::openmode m_mode = std::ios::binary | std::ios::trunc;
+    bool m_is_opened = false;                 // Only used by the simulation (the writer thread may be using m_file)
+    uint64_t m_size = 0;                      // The number of bytes handed over to the writer thread
+    std::ofstream m_file;
+    std::string m_buffer;                     // The buffer being filled by the simulation
+    std::deque<std::string> m_pending;        // The full buffers waiting for the writer thread
+    std::mutex m_mutex;
+    std::condition_variable m_pending_cv;     // Wakes up the writer thread (a pending buffer or closing)
+    std::condition_variable m_written_cv;     // Wakes up the simulation waiting for the writer thread
+    bool m_writing = false;
+    bool m_closing = false;
+    std::thread m_thread;
+
+  public:
+    BufferedFileWriter(const std::string& path) : m_path(path) {
+      // Only check that the file can be written, without truncating it yet
+      if (!std::ofstream(path, std::ios::binary | std::ios::app).is_open()) {
+        throw ConfigurationError("Cannot open {} for writing!", path);
+      }
+      m_buffer.reserve(BUFFER_SIZE);
+      m_thread = std::thread([this] { write_pending(); });
+    };
+
+    ~BufferedFileWriter() { close(); };
+
+    /**
+     * @brief     Returns the buffer to append to. Call commit() after appending.
+     */
+    std::string& buffer() { return m_buffer; };
+
+    /**
+     * @brief     Returns the size of the file once everything handed over is written (e.g., after flush())
+     */
+    uint64_t size() const { return m_size; };
+
+    /**
+     * @brief     Continues the existing file from the given size instead of overwriting it. Anything after
+     *            that size (e.g., written by a run that continued after the checkpoint) is discarded.
+     *            Must be called before anything is handed over.
+     */
+    void continue_file(uint64_t size) {
+      std::error_code ec;
+      uint64_t file_size = std::filesystem::file_size(m_path, ec);
+      if (ec || file_size < size) {
+        throw ConfigurationError("Cannot continue {} at byte {}: the file is missing or shorter!", m_path, size);
+      }
+      std::filesystem::resize_file(m_path, size);
+      m_mode = std::ios::binary | std::ios::app;
+      m_size = size;
+    };
+
+    void commit() {
+      if (m_buffer.size() >= BUFFER_SIZE) {
+        hand_over();
+      }
+    };
+
+    /**
+     * @brief     Writes everything appended so far to the file and waits until it is written (e.g., for a checkpoint)
+     */
+    void flush() {
+      hand_over();
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_written_cv.wait(lock, [this] { return m_pending.empty() && !m_writing; });
+      if (m_file.is_open()) {
+        m_file.flush();
+      }
+    };
+
+    /**
+     * @brief     Writes everything appended so far and closes the file
+     */
+    void close() {
+      if (!m_thread.joinable()) {
+        return;
+      }
+      hand_over();
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_closing = true;
+      }
+      m_pending_cv.notify_one();
+      m_thread.join();
+      if (m_file.is_open()) {
+        m_file.close();
+      }
+    };
+
+  private:
+    void hand_over() {
+      if (m_buffer.empty()) {
+        return;
+      }
+      if (!m_is_opened) {
+        // The writer thread only touches the file after it receives the first buffer
+        m_is_opened = true;
+        m_file.open(m_path, m_mode);
+        if (!m_file.is_open()) {
+          throw ConfigurationError("Cannot open {} for writing!", m_path);
+        }
+      }
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_written_cv.wait(lock, [this] { return m_pending.size() < MAX_PENDING; });
+        m_size += m_buffer.size();
+        m_pending.push_back(std::move(m_buffer));
+      }
+      m_pending_cv.notify_one();
+      m_buffer = std::string();
+      m_buffer.reserve(BUFFER_SIZE);
+    };
+
+    void write_pending() {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      while (true) {
+        m_pending_cv.wait(lock, [this] { return !m_pending.empty() || m_closing; });
+        if (m_pending.empty()) {
+          // Closing and everything is written
+          return;
+        }
+        std::string buffer = std::move(m_pending.front());
+        m_pending.pop_front();
+        m_writing = true;
+        lock.unlock();
+        m_file.write(buffer.data(), buffer.size());
+        lock.lock();
+        m_writing = false;
+        m_written_cv.notify_all();
+      }
+    };
+};
+
+
+/**
+ * @brief     Samples the energy of every rank of a device every epoch into a CSV trace
+ *
+ * @details
+ * Each epoch adds one line per rank with the cycle the epoch ends at, the flat rank id, the background
+ * energy with open banks (act_background) and with all banks precharged (pre_background), and the energy
+ * of each command class, all in nJ over the epoch. The standard computes the energy of one device from
+ * the increments of the command counters and of the active/idle cycles of the rank over the epoch
+ * (the same computation as its final power report), which is then scaled to all devices of the rank.
+ * A run restored from a checkpoint continues the trace from where it was at the checkpoint.
+ *
+ */
+class EnergyTrace {
+  private:
+    struct RankSnapshot {
+      std::vector<size_t> cmd_counters;
+      Clk_t active_cycles = 0;
+      Clk_t idle_cycles = 0;
+
+      void serialize(Archive& ar) {
+        ar & cmd_counters & active_cycles & idle_cycles;
+      };
+    };
+
+    Clk_t m_epoch;
+    Clk_t m_next_clk;
+    double m_num_devices;                     // The number of devices per rank
+    std::vector<RankSnapshot> m_last;         // The counters of each rank at the end of the last epoch
+    std::vector<size_t> m_epoch_cmd_counters;
+    BufferedFileWriter m_writer;
+
+  public:
+    EnergyTrace(const std::string& path, Clk_t epoch, const std::vector<PowerStats>& power_stats, int num_devices) :
+      m_epoch(epoch), m_next_clk(epoch), m_num_devices(num_devices), m_writer(path) {
+      if (m_epoch <= 0) {
+        throw ConfigurationError("The energy trace epoch must be positive!");
+      }
+      for (const auto& stats : power_stats) {
+        m_last.push_back({std::vector<size_t>(stats.cmd_counters.size(), 0)});
+      }
+      m_writer.buffer() += "clk,rank,act_background,pre_background,act,pre,rd,wr,ref,rfm\n";
+    };
+
+    /**
+     * @brief     Returns the cycle at which the current epoch ends
+     */
+    Clk_t next_clk() const { return m_next_clk; };
+
+    /**
+     * @brief     Writes the energy of every rank since the last sample and starts the next epoch
+     *
+     * @param     get_device_energy   Computes the RankEnergy of one device from (cmd_counters, active_cycles, idle_cycles)
+     */
+    template<typename EnergyFunc_t>
+    void sample(Clk_t clk, const std::vector<PowerStats>& power_stats, EnergyFunc_t&& get_device_energy) {
+      auto out = std::back_inserter(m_writer.buffer());
+      // Scales the energy of one device to the rank. An unused command class can come out as -0 (a zero
+      // count times a negative current difference), which {:.6g} would print as "-0", so zeros are normalized.
+      auto rank_nj = [this](double device_nj) {
+        double nj = device_nj * m_num_devices;
+        return nj == 0.0 ? 0.0 : nj;
+      };
+      for (size_t i = 0; i < power_stats.size(); i++) {
+        const PowerStats& stats = power_stats[i];
+        RankSnapshot& last = m_last[i];
+
+        m_epoch_cmd_counters.resize(stats.cmd_counters.size());
+        for (size_t cmd = 0; cmd < stats.cmd_counters.size(); cmd++) {
+          m_epoch_cmd_counters[cmd] = stats.cmd_counters[cmd] - last.cmd_counters[cmd];
+          last.cmd_counters[cmd] = stats.cmd_counters[cmd];
+        }
+        Clk_t active_cycles = stats.get_active_cycles(clk);
+        Clk_t idle_cycles = stats.get_idle_cycles(clk);
+        RankEnergy energy = get_device_energy(m_epoch_cmd_counters, active_cycles - last.active_cycles, idle_cycles - last.idle_cycles);
+        last.active_cycles = active_cycles;
+        last.idle_cycles = idle_cycles;
+
+        fmt::format_to(out, "{},{},{:.6g},{:.6g},{:.6g},{:.6g},{:.6g},{:.6g},{:.6g},{:.6g}\n", clk, stats.rank_id,
+                       rank_nj(energy.act_background), rank_nj(energy.pre_background), rank_nj(energy.act),
+                       rank_nj(energy.pre), rank_nj(energy.rd), rank_nj(energy.wr), rank_nj(energy.ref), rank_nj(energy.rfm));
+      }
+      m_writer.commit();
+      m_next_clk = clk + m_epoch;
+    };
+
+    /**
+     * @brief     Writes the last (partial) epoch and closes the trace
+     */
+    template<typename EnergyFunc_t>
+    void close(Clk_t clk, const std::vector<PowerStats>& power_stats, EnergyFunc_t&& get_device_energy) {
+      if (clk > m_next_clk - m_epoch) {
+        sample(clk, power_stats, get_device_energy);
+      }
+      m_writer.close();
+    };
+
+    void serialize(Archive& ar) {
+      uint64_t file_size = 0;
+      if (!ar.is_loading()) {
+        // The trace up to the checkpoint is complete even if the run stops after it
+        m_writer.flush();
+        file_size = m_writer.size();
+      }
+      ar & file_size & m_next_clk & m_last;
+      if (ar.is_loading()) {
+        // Continue the trace as written up to the checkpoint (which already has the header), dropping
+        // the rows of any run that continued past the checkpoint
+        m_writer.buffer().clear();
+        m_writer.continue_file(file_size);
+      }
+    };
+};
+
+}        // namespace Ramulator
+
+#endif   // RAMULATOR_DRAM_ENERGY_TRACE_H
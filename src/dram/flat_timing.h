@@ -0,0 +1,220 @@
+#ifndef RAMULATOR_DRAM_FLAT_TIMING_H
+#define RAMULATOR_DRAM_FLAT_TIMING_H
+
+#include <algorithm>
+#include <vector>
+
+#include "base/type.h"
+#include "base/serialization.h"
+#include "dram/node.h"
+
+namespace Ramulator {
+
+/**
+ * @brief     Timing state of all nodes of a device in flat arrays (an alternative to the timing of the node tree)
+ *
+ * @details
+ * Keeps the same information as m_cmd_ready_clk and m_cmd_history of DRAMNodeBase, but for all nodes
+ * of the device in contiguous arrays indexed by a flat node id. The nodes of a level are numbered in
+ * address order, so the child i of the node with flat id f (at the level below) has the flat id
+ * f * count[level below] + i, and the queries walk the path with index arithmetic only. The command
+ * histories are ring buffers with the newest entry at the head.
+ *
+ * update_timing(), check_ready(), and get_ready_clk() follow DRAMNodeBase exactly, so the command timing is identical.
+ * The node states (e.g., open rows) stay in the node tree.
+ *
+ */
+template<IsDRAMSpec T>
+class FlatTimingState {
+  private:
+    T* m_spec = nullptr;
+    int m_num_cmds = 0;
+    int m_num_levels = 0;                 // The number of levels that have nodes (i.e., the ones above the row level)
+
+    std::vector<int> m_count;             // The number of children of a node at the level above, per level
+    std::vector<int> m_node_base;         // The global id of the first node of each level
+    std::vector<int> m_hist_window;       // The history length of each (level, command)
+    std::vector<int> m_hist_offset;       // The offset of the history of each (level, command) in a node's history block
+    std::vector<int> m_hist_stride;       // The size of the history block of a node of each level
+    std::vector<size_t> m_hist_base;      // The start of the history blocks of each level
+
+    std::vector<Clk_t> m_ready_clk;       // [global node id * num_cmds + cmd]: The next cycle that each command can be issued again
+    std::vector<int> m_hist_head;         // [global node id * num_cmds + cmd]: The position of the newest history entry
+    std::vector<Clk_t> m_history;         // The issue-history of each command at each node
+
+  public:
+    void init(T* spec) {
+      m_spec = spec;
+      m_num_cmds = T::m_commands.size();
+
+      // Same as the node tree: there are no nodes at or below the row level or a level of size 0
+      int last_level = T::m_levels["row"];
+      m_num_levels = 1;
+      while (m_num_levels != last_level && spec->m_organization.count[m_num_levels] != 0) {
+        m_num_levels++;
+      }
+
+      int num_nodes = 0;
+      size_t history_size = 0;
+      int num_level_nodes = 1;
+      for (int level = 0; level < m_num_levels; level++) {
+        m_count.push_back(spec->m_organization.count[level]);
+        num_level_nodes *= m_count[level];
+        m_node_base.push_back(num_nodes);
+        num_nodes += num_level_nodes;
+
+        int stride = 0;
+        for (int cmd = 0; cmd < m_num_cmds; cmd++) {
+          int window = 0;
+          for (const auto& t : spec->m_timing_cons[level][cmd]) {
+            window = std::max(window, t.window);
+          }
+          m_hist_window.push_back(window);
+          m_hist_offset.push_back(stride);
+          stride += window;
+        }
+        m_hist_stride.push_back(stride);
+        m_hist_base.push_back(history_size);
+        history_size += (size_t)num_level_nodes * stride;
+      }
+
+      m_ready_clk.assign((size_t)num_nodes * m_num_cmds, -1);
+      m_hist_head.assign((size_t)num_nodes * m_num_cmds, 0);
+      m_history.assign(history_size, -1);
+    };
+
+    void serialize(Archive& ar) {
+      ar & m_ready_clk & m_hist_head & m_history;
+    };
+
+    void update_timing(int command, const AddrVec_t& addr_vec, Clk_t clk) {
+      update_target_timing(0, addr_vec[0], command, addr_vec, clk);
+    };
+
+    bool check_ready(int command, const AddrVec_t& addr_vec, Clk_t clk) {
+      return check_ready(0, addr_vec[0], command, addr_vec, clk);
+    };
+
+    Clk_t get_ready_clk(int command, const AddrVec_t& addr_vec) {
+      return get_ready_clk(0, addr_vec[0], command, addr_vec);
+    };
+
+  private:
+    Clk_t& ready_clk(int level, int node_id, int cmd) {
+      return m_ready_clk[(size_t)(m_node_base[level] + node_id) * m_num_cmds + cmd];
+    };
+
+    void update_sibling_timing(int level, int node_id, int command, Clk_t clk) {
+      for (const auto& t : m_spec->m_timing_cons[level][command]) {
+        if (!t.sibling) {
+          // not sibling timing parameter
+          continue;
+        }
+
+        // update earliest schedulable time of every command
+        Clk_t& ready = ready_clk(level, node_id, t.cmd);
+        ready = std::max(ready, clk + t.val);
+      }
+    };
+
+    void update_target_timing(int level, int node_id, int command, const AddrVec_t& addr_vec, Clk_t clk) {
+      // Update history
+      int level_cmd = level * m_num_cmds + command;
+      int window = m_hist_window[level_cmd];
+      Clk_t* history = nullptr;
+      int* head = nullptr;
+      if (window != 0) {
+        history = &m_history[m_hist_base[level] + (size_t)node_id * m_hist_stride[level] + m_hist_offset[level_cmd]];
+        head = &m_hist_head[(size_t)(m_node_base[level] + node_id) * m_num_cmds + command];
+        *head = (*head + 1) % window;
+        history[*head] = clk;
+      }
+
+      for (const auto& t : m_spec->m_timing_cons[level][command]) {
+        if (t.sibling) {
+          continue;
+        }
+
+        // Get the oldest history
+        Clk_t past = history[(*head - (t.window - 1) + window) % window];
+        if (past < 0) {
+          // not enough history
+          continue;
+        }
+
+        // update earliest schedulable time of every command
+        Clk_t& ready = ready_clk(level, node_id, t.cmd);
+        ready = std::max(ready, past + t.val);
+      }
+
+      int child_level = level + 1;
+      if (child_level == m_num_levels) {
+        // stop: updated all levels
+        return;
+      }
+
+      // update all of my children, only the target one has its own children updated
+      int num_children = m_count[child_level];
+      int target_child = addr_vec[child_level];
+      int first_child = node_id * num_children;
+      for (int i = 0; i < num_children; i++) {
+        if (target_child != -1 && i != target_child) {
+          update_sibling_timing(child_level, first_child + i, command, clk);
+        } else {
+          update_target_timing(child_level, first_child + i, command, addr_vec, clk);
+        }
+      }
+    };
+
+    bool check_ready(int level, int node_id, int command, const AddrVec_t& addr_vec, Clk_t clk) {
+      Clk_t ready = ready_clk(level, node_id, command);
+      if (ready != -1 && clk < ready) {
+        // stop: the check failed at this level
+        return false;
+      }
+
+      int child_level = level + 1;
+      if (level == m_spec->m_command_scopes[command] || child_level == m_num_levels) {
+        // stop: the check passed at all levels
+        return true;
+      }
+
+      int num_children = m_count[child_level];
+      int child_id = addr_vec[child_level];
+      if (child_id == -1) {
+        // if it is a same bank command, check all children
+        for (int i = 0; i < num_children; i++) {
+          if (!check_ready(child_level, node_id * num_children + i, command, addr_vec, clk)) {
+            return false;
+          }
+        }
+        return true;
+      }
+      return check_ready(child_level, node_id * num_children + child_id, command, addr_vec, clk);
+    };
+
+    Clk_t get_ready_clk(int level, int node_id, int command, const AddrVec_t& addr_vec) {
+      Clk_t ready = ready_clk(level, node_id, command);
+
+      int child_level = level + 1;
+      if (level == m_spec->m_command_scopes[command] || child_level == m_num_levels) {
+        // stop: reached the scope of the command
+        return ready;
+      }
+
+      int num_children = m_count[child_level];
+      int child_id = addr_vec[child_level];
+      if (child_id == -1) {
+        // if it is a same bank command, the latest of all children
+        for (int i = 0; i < num_children; i++) {
+          ready = std::max(ready, get_ready_clk(child_level, node_id * num_children + i, command, addr_vec));
+        }
+        return ready;
+      }
+      return std::max(ready, get_ready_clk(child_level, node_id * num_children + child_id, command, addr_vec));
+    };
+};
+
+}        // namespace Ramulator
+
+#endif   // RAMULATOR_DRAM_FLAT_TIMING_H
@@ -0,0 +1,106 @@
+#ifndef RAMULATOR_DRAM_FUTURE_ACTIONS_H
+#define RAMULATOR_DRAM_FUTURE_ACTIONS_H
+
+#include <vector>
+#include <queue>
+#include <limits>
+#include <functional>
+
+#include "base/type.h"
+#include "base/serialization.h"
+#include "dram/spec.h"
+
+namespace Ramulator {
+
+/**
+ * @brief     A timing wheel of the future actions (e.g., refresh-end) of a device
+ *
+ * @details
+ * An action is kept in the slot of its clock modulo the number of slots (so an action further away than one
+ * turn of the wheel simply waits in its slot), and a min-heap keeps the clocks of all pending actions.
+ * Checking a cycle without due actions is one heap lookup, and the heap top is the next due clock.
+ * Actions due in the same cycle are handled in the reverse order they were added.
+ *
+ */
+class FutureActionWheel {
+  private:
+    static constexpr Clk_t NUM_SLOTS = 1024;      // Must be a power of two
+
+    std::vector<std::vector<FutureAction>> m_slots;
+    std::priority_queue<Clk_t, std::vector<Clk_t>, std::greater<Clk_t>> m_due_clks;   // The clocks of all pending actions
+    std::vector<FutureAction> m_due_actions;      // The actions being handled
+
+  public:
+    FutureActionWheel() : m_slots(NUM_SLOTS) {};
+
+    bool empty() const { return m_due_clks.empty(); };
+    size_t size() const { return m_due_clks.size(); };
+
+    /**
+     * @brief     Returns the clock of the earliest pending action (or the max clock if there is none)
+     */
+    Clk_t next_clk() const {
+      return m_due_clks.empty() ? std::numeric_limits<Clk_t>::max() : m_due_clks.top();
+    };
+
+    void push(const FutureAction& action) {
+      m_slots[action.clk & (NUM_SLOTS - 1)].push_back(action);
+      m_due_clks.push(action.clk);
+    };
+
+    /**
+     * @brief     Handles (and removes) the actions due at the given clock
+     * @details
+     * Actions due before the clock can no longer be handled at their cycle and are dropped.
+     * The handler may push new actions.
+     *
+     */
+    template<typename Handler_t>
+    void handle_due(Clk_t clk, Handler_t&& handler) {
+      while (!m_due_clks.empty() && m_due_clks.top() <= clk) {
+        Clk_t due_clk = m_due_clks.top();
+        while (!m_due_clks.empty() && m_due_clks.top() == due_clk) {
+          m_due_clks.pop();
+        }
+
+        // Take the due actions out of the slot first, as the handler may add actions to it
+        auto& slot = m_slots[due_clk & (NUM_SLOTS - 1)];
+        size_t num_kept = 0;
+        for (size_t i = 0; i < slot.size(); i++) {
+          if (slot[i].clk == due_clk) {
+            m_due_actions.push_back(std::move(slot[i]));
+          } else {
+            slot[num_kept++] = std::move(slot[i]);
+          }
+        }
+        slot.resize(num_kept);
+
+        if (due_clk == clk) {
+          for (auto it = m_due_actions.rbegin(); it != m_due_actions.rend(); it++) {
+            handler(*it);
+          }
+        }
+        m_due_actions.clear();
+      }
+    };
+
+    void serialize(Archive& ar) {
+      // Saved as one list in slot order, which keeps the order of the actions due in the same cycle
+      std::vector<FutureAction> actions;
+      for (auto& slot : m_slots) {
+        actions.insert(actions.end(), slot.begin(), slot.end());
+      }
+      ar & actions;
+      if (ar.is_loading()) {
+        m_slots.assign(NUM_SLOTS, {});
+        m_due_clks = {};
+        for (auto& action : actions) {
+          push(action);
+        }
+      }
+    };
+};
+
+}        // namespace Ramulator
+
+#endif   // RAMULATOR_DRAM_FUTURE_ACTIONS_H
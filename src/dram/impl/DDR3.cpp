@@ -158,7 +158,7 @@ class DDR3 : public IDRAM, public Implementation {
       create_nodes();
     };
 
-    void issue_command(int command, const AddrVec_t& addr_vec) override {
+    void issue_device_command(int command, const AddrVec_t& addr_vec) override {
       int channel_id = addr_vec[m_levels["channel"]];
       m_channels[channel_id]->update_timing(command, addr_vec, m_clk);
       m_channels[channel_id]->update_states(command, addr_vec, m_clk);
@@ -1,4 +1,5 @@
 #include "dram/dram.h"
+#include "dram/flat_timing.h"
 #include "dram/lambdas.h"
 
 // #define DEBUG_POWER
@@ -256,6 +257,8 @@ class DDR5AsyncDIMM : public IDRAM, public Implementation {
       Node(DDR5AsyncDIMM* dram, Node* parent, int level, int id) : DRAMNodeBase<DDR5AsyncDIMM>(dram, parent, level, id) {};
     };
     std::vector<Node*> m_channels;
+    bool m_use_flat_timing = false;           // Keep the timing state of the nodes in flat arrays instead of the node tree
+    FlatTimingState<DDR5AsyncDIMM> m_flat_timing;
 
     FuncMatrix<ActionFunc_t<Node>>  m_actions;
     FuncMatrix<PreqFunc_t<Node>>    m_preqs;
@@ -276,15 +279,18 @@ class DDR5AsyncDIMM : public IDRAM, public Implementation {
 
   public:
     void tick() override {
+      RAMULATOR_PROFILE_SCOPE();
       m_clk++;
 
       // Check if there is any future action at this cycle
-      for (int i = m_future_actions.size() - 1; i >= 0; i--) {
-        auto& future_action = m_future_actions[i];
-        if (future_action.clk == m_clk) {
-          handle_future_action(future_action.cmd, future_action.addr_vec);
-          m_future_actions.erase(m_future_actions.begin() + i);
-        }
+      m_future_actions.handle_due(m_clk, [this](const FutureAction& future_action) {
+        handle_future_action(future_action.cmd, future_action.addr_vec);
+      });
+
+      if (m_energy_trace && m_clk >= m_energy_trace->next_clk()) {
+        m_energy_trace->sample(m_clk, m_power_stats, [this](const std::vector<size_t>& cmd_counters, Clk_t active_cycles, Clk_t idle_cycles) {
+          return get_device_energy(cmd_counters, active_cycles, idle_cycles);
+        });
       }
     };
 
@@ -302,9 +308,13 @@ class DDR5AsyncDIMM : public IDRAM, public Implementation {
       create_nodes();
     };
 
-    void issue_command(int command, const AddrVec_t& addr_vec) override {
+    void issue_device_command(int command, const AddrVec_t& addr_vec) override {
       int channel_id = addr_vec[m_levels["channel"]];
-      m_channels[channel_id]->update_timing(command, addr_vec, m_clk);
+      if (m_use_flat_timing) {
+        m_flat_timing.update_timing(command, addr_vec, m_clk);
+      } else {
+        m_channels[channel_id]->update_timing(command, addr_vec, m_clk);
+      }
       m_channels[channel_id]->update_powers(command, addr_vec, m_clk);
       m_channels[channel_id]->update_states(command, addr_vec, m_clk);
 
@@ -315,25 +325,25 @@ class DDR5AsyncDIMM : public IDRAM, public Implementation {
     void check_future_action(int command, const AddrVec_t& addr_vec) {
       switch (command) {
         case m_commands("REFab"):
-          m_future_actions.push_back({command, addr_vec, m_clk + m_timing_vals("nRFC1") - 1});
+          add_future_action(command, addr_vec, m_clk + m_timing_vals(m_timings["nRFC1"]) - 1);
           break;
         case m_commands("REFsb"):
-          m_future_actions.push_back({command, addr_vec, m_clk + m_timing_vals("nRFCsb") - 1});
+          add_future_action(command, addr_vec, m_clk + m_timing_vals(m_timings["nRFCsb"]) - 1);
           break;
         case m_commands("RFMab"):
-          m_future_actions.push_back({command, addr_vec, m_clk + m_timing_vals("nRFM1") - 1});
+          add_future_action(command, addr_vec, m_clk + m_timing_vals(m_timings["nRFM1"]) - 1);
           break;
         case m_commands("RFMsb"):
-          m_future_actions.push_back({command, addr_vec, m_clk + m_timing_vals("nRFMsb") - 1});
+          add_future_action(command, addr_vec, m_clk + m_timing_vals(m_timings["nRFMsb"]) - 1);
           break;
         case m_commands("DRFMab"):
-          m_future_actions.push_back({command, addr_vec, m_clk + m_timing_vals("nDRFMab") - 1});
+          add_future_action(command, addr_vec, m_clk + m_timing_vals(m_timings["nDRFMab"]) - 1);
           break;
         case m_commands("DRFMsb"):
-          m_future_actions.push_back({command, addr_vec, m_clk + m_timing_vals("nDRFMsb") - 1});
+          add_future_action(command, addr_vec, m_clk + m_timing_vals(m_timings["nDRFMsb"]) - 1);
           break;
         case m_commands("REFab_L"):
-          m_future_actions.push_back({command, addr_vec, m_clk + m_timing_vals("nRFC1") - 1});
+          add_future_action(command, addr_vec, m_clk + m_timing_vals(m_timings["nRFC1"]) - 1);
           break;
         default:
           // Other commands (including offload commands) do not require future actions
@@ -345,32 +355,32 @@ class DDR5AsyncDIMM : public IDRAM, public Implementation {
       int channel_id = addr_vec[m_levels["channel"]];
       switch (command) {
         case m_commands("REFab"):
-          m_channels[channel_id]->update_powers(m_commands("REFab_end"), addr_vec, m_clk);
-          m_channels[channel_id]->update_states(m_commands("REFab_end"), addr_vec, m_clk);
+          m_channels[channel_id]->update_powers(m_commands["REFab_end"], addr_vec, m_clk);
+          m_channels[channel_id]->update_states(m_commands["REFab_end"], addr_vec, m_clk);
           break;
         case m_commands("REFsb"):
-          m_channels[channel_id]->update_powers(m_commands("REFsb_end"), addr_vec, m_clk);
-          m_channels[channel_id]->update_states(m_commands("REFsb_end"), addr_vec, m_clk);
+          m_channels[channel_id]->update_powers(m_commands["REFsb_end"], addr_vec, m_clk);
+          m_channels[channel_id]->update_states(m_commands["REFsb_end"], addr_vec, m_clk);
           break;
         case m_commands("RFMab"):
-          m_channels[channel_id]->update_powers(m_commands("RFMab_end"), addr_vec, m_clk);
-          m_channels[channel_id]->update_states(m_commands("RFMab_end"), addr_vec, m_clk);
+          m_channels[channel_id]->update_powers(m_commands["RFMab_end"], addr_vec, m_clk);
+          m_channels[channel_id]->update_states(m_commands["RFMab_end"], addr_vec, m_clk);
           break;
         case m_commands("RFMsb"):
-          m_channels[channel_id]->update_powers(m_commands("RFMsb_end"), addr_vec, m_clk);
-          m_channels[channel_id]->update_states(m_commands("RFMsb_end"), addr_vec, m_clk);
+          m_channels[channel_id]->update_powers(m_commands["RFMsb_end"], addr_vec, m_clk);
+          m_channels[channel_id]->update_states(m_commands["RFMsb_end"], addr_vec, m_clk);
           break;
         case m_commands("DRFMab"):
-          m_channels[channel_id]->update_powers(m_commands("DRFMab_end"), addr_vec, m_clk);
-          m_channels[channel_id]->update_states(m_commands("DRFMab_end"), addr_vec, m_clk);
+          m_channels[channel_id]->update_powers(m_commands["DRFMab_end"], addr_vec, m_clk);
+          m_channels[channel_id]->update_states(m_commands["DRFMab_end"], addr_vec, m_clk);
           break;
         case m_commands("DRFMsb"):
-          m_channels[channel_id]->update_powers(m_commands("DRFMsb_end"), addr_vec, m_clk);
-          m_channels[channel_id]->update_states(m_commands("DRFMsb_end"), addr_vec, m_clk);
+          m_channels[channel_id]->update_powers(m_commands["DRFMsb_end"], addr_vec, m_clk);
+          m_channels[channel_id]->update_states(m_commands["DRFMsb_end"], addr_vec, m_clk);
           break;
         case m_commands("REFab_L"):
-          m_channels[channel_id]->update_powers(m_commands("REFab_L_end"), addr_vec, m_clk);
-          m_channels[channel_id]->update_states(m_commands("REFab_L_end"), addr_vec, m_clk);
+          m_channels[channel_id]->update_powers(m_commands["REFab_L_end"], addr_vec, m_clk);
+          m_channels[channel_id]->update_states(m_commands["REFab_L_end"], addr_vec, m_clk);
           break;
         default:
           break;
@@ -392,7 +402,12 @@ class DDR5AsyncDIMM : public IDRAM, public Implementation {
 
     bool check_ready(int command, const AddrVec_t& addr_vec) override {
       int channel_id = addr_vec[m_levels["channel"]];
-      return m_channels[channel_id]->check_ready(command, addr_vec, m_clk);
+      return m_use_flat_timing ? m_flat_timing.check_ready(command, addr_vec, m_clk) : m_channels[channel_id]->check_ready(command, addr_vec, m_clk);
+    };
+
+    Clk_t get_ready_clk(int command, const AddrVec_t& addr_vec) override {
+      int channel_id = addr_vec[m_levels["channel"]];
+      return m_use_flat_timing ? m_flat_timing.get_ready_clk(command, addr_vec) : m_channels[channel_id]->get_ready_clk(command, addr_vec);
     };
 
     bool check_rowbuffer_hit(int command, const AddrVec_t& addr_vec) override {
@@ -960,6 +975,12 @@ class DDR5AsyncDIMM : public IDRAM, public Implementation {
         }
       }
 
+      if (auto trace_path = param<std::string>("energy_trace_path").desc("Write the energy of each rank in every epoch to this CSV file.").optional()) {
+        Clk_t epoch = param<Clk_t>("energy_trace_epoch").desc("Number of cycles in each epoch of the energy trace.").default_val(100000);
+        int num_dev_per_rank = (m_channel_width+m_parity_width)/m_organization.dq;
+        m_energy_trace = std::make_unique<EnergyTrace>(*trace_path, epoch, m_power_stats, num_dev_per_rank);
+      }
+
       m_powers.resize(m_levels.size(), std::vector<PowerFunc_t<Node>>(m_commands.size()));
 
       m_powers[m_levels["bank"]][m_commands["ACT"]] = Lambdas::Power::Bank::ACT<DDR5AsyncDIMM>;
@@ -1021,6 +1042,22 @@ class DDR5AsyncDIMM : public IDRAM, public Implementation {
         Node* channel = new Node(this, nullptr, 0, i);
         m_channels.push_back(channel);
       }
+
+      m_use_flat_timing = param<bool>("flat_timing_state").desc("Keep the timing state of the nodes in flat arrays indexed by node id instead of the node tree.").default_val(false);
+      if (m_use_flat_timing) {
+        m_flat_timing.init(this);
+      }
+    }
+
+    void serialize(Archive& ar) override {
+      serialize_device(ar);
+      for (auto channel : m_channels) {
+        channel->serialize(ar);
+      }
+      if (m_use_flat_timing) {
+        ar & m_flat_timing;
+      }
+      ar & s_total_rfm_energy & s_total_rfm_cycles;
     }
 
     void finalize() override {
@@ -1028,6 +1065,12 @@ class DDR5AsyncDIMM : public IDRAM, public Implementation {
       if (!m_drampower_enable)
         return;
 
+      if (m_energy_trace) {
+        m_energy_trace->close(m_clk, m_power_stats, [this](const std::vector<size_t>& cmd_counters, Clk_t active_cycles, Clk_t idle_cycles) {
+          return get_device_energy(cmd_counters, active_cycles, idle_cycles);
+        });
+      }
+
       int num_channels = m_organization.count[m_levels["channel"]];
       int num_ranks = m_organization.count[m_levels["rank"]];
 
@@ -1052,11 +1095,11 @@ class DDR5AsyncDIMM : public IDRAM, public Implementation {
         double channel_onboard_dq_energy = (double)num_trans * (double)(16 * (m_channel_width+m_parity_width)) * on_board_dq_energy / 1E3;
         double dq_energy = channel_socket_dq_energy + channel_onboard_dq_energy;
         double dq_power = dq_energy/((double)m_clk * (double)m_timing_vals("tCK_ps") / 1000.0);
-        std::cout<<"["<<num_channels<<"] Channel DQ Power Report"<<std::endl;
-        std::cout<<" - DQ (Socket) Energy (nJ) : "<<channel_socket_dq_energy<<std::endl;
-        std::cout<<" - DQ (OnBoard) Energy (nJ): "<<channel_onboard_dq_energy<<std::endl;
-        std::cout<<" - DQ Energy (nJ) : "<<dq_energy<<std::endl;
-        std::cout<<" - DQ Power (W)   : "<<dq_power<<std::endl;
+        report_stream()<<"["<<num_channels<<"] Channel DQ Power Report"<<std::endl;
+        report_stream()<<" - DQ (Socket) Energy (nJ) : "<<channel_socket_dq_energy<<std::endl;
+        report_stream()<<" - DQ (OnBoard) Energy (nJ): "<<channel_onboard_dq_energy<<std::endl;
+        report_stream()<<" - DQ Energy (nJ) : "<<dq_energy<<std::endl;
+        report_stream()<<" - DQ Power (W)   : "<<dq_power<<std::endl;
         s_total_dq_energy += (dq_energy);
         s_total_energy    += (dq_energy);
         s_total_dq_power  += (dq_power);
@@ -1065,18 +1108,18 @@ class DDR5AsyncDIMM : public IDRAM, public Implementation {
       }
 
 
-      std::cout<<" ==== Total Channel Power Report === "<<std::endl;
-      std::cout<<" - DRAM Background Energy (nJ)  : "<<s_total_background_energy<<std::endl;
-      std::cout<<" - DRAM Command Energy (nJ)     : "<<s_total_cmd_energy<<std::endl;
-      std::cout<<" - DRAM DQ Energy (nJ)          : "<<s_total_dq_energy<<std::endl;
-      std::cout<<" - Total DRAM Energy (nJ)       : "<<s_total_energy<<std::endl;
+      report_stream()<<" ==== Total Channel Power Report === "<<std::endl;
+      report_stream()<<" - DRAM Background Energy (nJ)  : "<<s_total_background_energy<<std::endl;
+      report_stream()<<" - DRAM Command Energy (nJ)     : "<<s_total_cmd_energy<<std::endl;
+      report_stream()<<" - DRAM DQ Energy (nJ)          : "<<s_total_dq_energy<<std::endl;
+      report_stream()<<" - Total DRAM Energy (nJ)       : "<<s_total_energy<<std::endl;
 
-      std::cout<<" - DRAM Background Power (W)    : "<<s_total_background_power<<std::endl;
-      std::cout<<" - DRAM Command Power (W)       : "<<s_total_cmd_power<<std::endl;
-      std::cout<<" - DRAM DQ Power(W)             : "<<s_total_dq_power<<std::endl;
-      std::cout<<" - Total DRAM Power (W)         : "<<s_total_power<<std::endl;
+      report_stream()<<" - DRAM Background Power (W)    : "<<s_total_background_power<<std::endl;
+      report_stream()<<" - DRAM Command Power (W)       : "<<s_total_cmd_power<<std::endl;
+      report_stream()<<" - DRAM DQ Power(W)             : "<<s_total_dq_power<<std::endl;
+      report_stream()<<" - Total DRAM Power (W)         : "<<s_total_power<<std::endl;
 
-      std::cout<<" ==== Total Channel Bandwidth (GB/s) Report === "<<std::endl;
+      report_stream()<<" ==== Total Channel Bandwidth (GB/s) Report === "<<std::endl;
       size_t total_host_acc = 0;
       size_t total_nma_acc = 0;
       for (int i = 0; i < num_channels; i++) {
@@ -1090,22 +1133,22 @@ class DDR5AsyncDIMM : public IDRAM, public Implementation {
       double total_bw = (double)((double)total_acc * 512.0) / ((double)m_clk * (double)m_timing_vals("tCK_ps") / 1000.0) / 8;
       double host_bw  = (double)((double)total_host_acc * 512.0) / ((double)m_clk * (double)m_timing_vals("tCK_ps") / 1000.0) / 8;
       double nma_bw   = (double)((double)total_nma_acc * 512.0) / ((double)m_clk * (double)m_timing_vals("tCK_ps") / 1000.0) / 8;
-      std::cout<<" - Total Bandwidth                  : "<<total_bw<<std::endl;
-      std::cout<<" - Host Bandwidth                   : "<<host_bw<<std::endl;
-      std::cout<<" - NMA Bandwidth                    : "<<nma_bw<<std::endl;
-      std::cout<<" - Total Access                     : "<<total_acc<<std::endl;
-      std::cout<<" - Host Access                      : "<<total_host_acc<<std::endl;
-      std::cout<<" - NMA Access                       : "<<total_nma_acc<<std::endl;
+      report_stream()<<" - Total Bandwidth                  : "<<total_bw<<std::endl;
+      report_stream()<<" - Host Bandwidth                   : "<<host_bw<<std::endl;
+      report_stream()<<" - NMA Bandwidth                    : "<<nma_bw<<std::endl;
+      report_stream()<<" - Total Access                     : "<<total_acc<<std::endl;
+      report_stream()<<" - Host Access                      : "<<total_host_acc<<std::endl;
+      report_stream()<<" - NMA Access                       : "<<total_nma_acc<<std::endl;
 
     }
 
-    void process_rank_energy(PowerStats& rank_stats, Node* rank_node) {
-
-      Lambdas::Power::Rank::finalize_rank<DDR5AsyncDIMM>(rank_node, 0, AddrVec_t(), m_clk);
-
+    /**
+     * @brief    Computes the energy of one device of a rank from its command counters and active/idle cycles
+     * 
+     */
+    RankEnergy get_device_energy(const std::vector<size_t>& cmd_counters, Clk_t active_cycles, Clk_t idle_cycles) {
       size_t num_bankgroups = m_organization.count[m_levels["bankgroup"]];
       size_t num_banks = m_organization.count[m_levels["bank"]];
-      int num_dev_per_rank = (m_channel_width+m_parity_width)/m_organization.dq;
 
       auto TS = [&](std::string_view timing) { return m_timing_vals(timing); };
       auto VE = [&](std::string_view voltage) { return m_voltage_vals(voltage); };
@@ -1116,60 +1159,84 @@ class DDR5AsyncDIMM : public IDRAM, public Implementation {
       double one_bank_idd3N = (CE("IDD3N") - CE("IDD2N"))/(num_bankgroups * num_banks);
       double one_bank_ipp3N = (CE("IPP3N") - CE("IPP2N"))/(num_bankgroups * num_banks);
 
-      rank_stats.act_background_energy = (VE("VDD") * CE("IDD3N") + VE("VPP") * CE("IPP3N"))
-                                            * rank_stats.active_cycles * tCK_ns / 1E3;
+      RankEnergy energy;
+      energy.act_background = (VE("VDD") * CE("IDD3N") + VE("VPP") * CE("IPP3N"))
+                                            * active_cycles * tCK_ns / 1E3;
 
-      rank_stats.pre_background_energy = (VE("VDD") * CE("IDD2N") + VE("VPP") * CE("IPP2N"))
-                                            * rank_stats.idle_cycles * tCK_ns / 1E3;
+      energy.pre_background = (VE("VDD") * CE("IDD2N") + VE("VPP") * CE("IPP2N"))
+                                            * idle_cycles * tCK_ns / 1E3;
 
 
       // Host MC commands (channel bus)
-      size_t act_count = rank_stats.cmd_counters[m_cmds_counted("ACT")];
-      size_t pre_count = rank_stats.cmd_counters[m_cmds_counted("PRE")];
-      size_t rd_count  = rank_stats.cmd_counters[m_cmds_counted("RD")];
-      size_t wr_count  = rank_stats.cmd_counters[m_cmds_counted("WR")];
-      size_t ref_count = rank_stats.cmd_counters[m_cmds_counted("REF")];
+      size_t act_count = cmd_counters[m_cmds_counted("ACT")];
+      size_t pre_count = cmd_counters[m_cmds_counted("PRE")];
+      size_t rd_count  = cmd_counters[m_cmds_counted("RD")];
+      size_t wr_count  = cmd_counters[m_cmds_counted("WR")];
+      size_t ref_count = cmd_counters[m_cmds_counted("REF")];
 
       // NMA-Local commands (rank-local bus, same DRAM array energy)
-      act_count += rank_stats.cmd_counters[m_cmds_counted("ACT_L")];
-      pre_count += rank_stats.cmd_counters[m_cmds_counted("PRE_L")];
-      rd_count  += rank_stats.cmd_counters[m_cmds_counted("RD_L")];
-      wr_count  += rank_stats.cmd_counters[m_cmds_counted("WR_L")];
-      ref_count += rank_stats.cmd_counters[m_cmds_counted("REFab_L")];
+      act_count += cmd_counters[m_cmds_counted("ACT_L")];
+      pre_count += cmd_counters[m_cmds_counted("PRE_L")];
+      rd_count  += cmd_counters[m_cmds_counted("RD_L")];
+      wr_count  += cmd_counters[m_cmds_counted("WR_L")];
+      ref_count += cmd_counters[m_cmds_counted("REFab_L")];
 
-      double act_cmd_energy  = (VE("VDD") * (CE("IDD0") - one_bank_idd3N) + VE("VPP") * (CE("IPP0") - one_bank_ipp3N))
+      energy.act = (VE("VDD") * (CE("IDD0") - one_bank_idd3N) + VE("VPP") * (CE("IPP0") - one_bank_ipp3N))
                                       * act_count * TS("nRAS") * tCK_ns / 1E3;
 
-      double pre_cmd_energy  = (VE("VDD") * (CE("IDD0") - CE("IDD2N")) + VE("VPP") * (CE("IPP0") - CE("IPP2N")))
+      energy.pre = (VE("VDD") * (CE("IDD0") - CE("IDD2N")) + VE("VPP") * (CE("IPP0") - CE("IPP2N")))
                                       * pre_count * TS("nRP")  * tCK_ns / 1E3;
 
-      double rd_cmd_energy   = (VE("VDD") * (CE("IDD4R") - CE("IDD3N")) + VE("VPP") * (CE("IPP4R") - CE("IPP3N")))
+      energy.rd = (VE("VDD") * (CE("IDD4R") - CE("IDD3N")) + VE("VPP") * (CE("IPP4R") - CE("IPP3N")))
                                       * rd_count * TS("nBL") * tCK_ns / 1E3;
 
-      double wr_cmd_energy   = (VE("VDD") * (CE("IDD4W") - CE("IDD3N")) + VE("VPP") * (CE("IPP4W") - CE("IPP3N")))
+      energy.wr = (VE("VDD") * (CE("IDD4W") - CE("IDD3N")) + VE("VPP") * (CE("IPP4W") - CE("IPP3N")))
                                       * wr_count * TS("nBL") * tCK_ns / 1E3;
 
-      double ref_cmd_energy  = (VE("VDD") * (CE("IDD5B")) + VE("VPP") * (CE("IPP5B")))
+      energy.ref = (VE("VDD") * (CE("IDD5B")) + VE("VPP") * (CE("IPP5B")))
                                       * ref_count * TS("nRFC1") * tCK_ns / 1E3;
 
-      double rfm_cmd_energy = (VE("VDD") * (CE("IDD0") - CE("IDD3N")) + VE("VPP") * (CE("IPP0") - CE("IPP3N"))) * num_bankgroups
-                                      * rank_stats.cmd_counters[m_cmds_counted("RFM")] * TS("nRFMsb") * tCK_ns / 1E3;
+      energy.rfm = (VE("VDD") * (CE("IDD0") - CE("IDD3N")) + VE("VPP") * (CE("IPP0") - CE("IPP3N"))) * num_bankgroups
+                                      * cmd_counters[m_cmds_counted("RFM")] * TS("nRFMsb") * tCK_ns / 1E3;
+
+      return energy;
+    }
+
+    void process_rank_energy(PowerStats& rank_stats, Node* rank_node) {
+
+      Lambdas::Power::Rank::finalize_rank<DDR5AsyncDIMM>(rank_node, 0, AddrVec_t(), m_clk);
+
+      int num_dev_per_rank = (m_channel_width+m_parity_width)/m_organization.dq;
+
+      auto TS = [&](std::string_view timing) { return m_timing_vals(timing); };
+      double tCK_ns = (double) TS("tCK_ps") / 1000.0;
+
+      RankEnergy energy = get_device_energy(rank_stats.cmd_counters, rank_stats.active_cycles, rank_stats.idle_cycles);
+      rank_stats.act_background_energy = energy.act_background;
+      rank_stats.pre_background_energy = energy.pre_background;
+
+      double act_cmd_energy  = energy.act;
+      double pre_cmd_energy  = energy.pre;
+      double rd_cmd_energy   = energy.rd;
+      double wr_cmd_energy   = energy.wr;
+      double ref_cmd_energy  = energy.ref;
+      double rfm_cmd_energy  = energy.rfm;
 
       #ifdef DEBUG_POWER
-        std::cout<<"act_cmd_energy  : "<<act_cmd_energy<<std::endl;
-        std::cout<<"pre_cmd_energy  : "<<pre_cmd_energy<<std::endl;
-        std::cout<<"rd_cmd_energy   : "<<rd_cmd_energy<<std::endl;
-        std::cout<<"wr_cmd_energy   : "<<wr_cmd_energy<<std::endl;
-        std::cout<<"ref_cmd_energy  : "<<ref_cmd_energy<<std::endl;
-        std::cout<<"rank_stats.cmd_counters[ACT]    : "<<rank_stats.cmd_counters[m_cmds_counted("ACT")]<<std::endl;
-        std::cout<<"rank_stats.cmd_counters[PRE]    : "<<rank_stats.cmd_counters[m_cmds_counted("PRE")]<<std::endl;
-        std::cout<<"rank_stats.cmd_counters[RD]     : "<<rank_stats.cmd_counters[m_cmds_counted("RD")]<<std::endl;
-        std::cout<<"rank_stats.cmd_counters[WR]     : "<<rank_stats.cmd_counters[m_cmds_counted("WR")]<<std::endl;
-        std::cout<<"rank_stats.cmd_counters[ACT_L]  : "<<rank_stats.cmd_counters[m_cmds_counted("ACT_L")]<<std::endl;
-        std::cout<<"rank_stats.cmd_counters[PRE_L]  : "<<rank_stats.cmd_counters[m_cmds_counted("PRE_L")]<<std::endl;
-        std::cout<<"rank_stats.cmd_counters[RD_L]   : "<<rank_stats.cmd_counters[m_cmds_counted("RD_L")]<<std::endl;
-        std::cout<<"rank_stats.cmd_counters[WR_L]   : "<<rank_stats.cmd_counters[m_cmds_counted("WR_L")]<<std::endl;
-        std::cout<<"rank_stats.cmd_counters[REFab_L]: "<<rank_stats.cmd_counters[m_cmds_counted("REFab_L")]<<std::endl;
+        report_stream()<<"act_cmd_energy  : "<<act_cmd_energy<<std::endl;
+        report_stream()<<"pre_cmd_energy  : "<<pre_cmd_energy<<std::endl;
+        report_stream()<<"rd_cmd_energy   : "<<rd_cmd_energy<<std::endl;
+        report_stream()<<"wr_cmd_energy   : "<<wr_cmd_energy<<std::endl;
+        report_stream()<<"ref_cmd_energy  : "<<ref_cmd_energy<<std::endl;
+        report_stream()<<"rank_stats.cmd_counters[ACT]    : "<<rank_stats.cmd_counters[m_cmds_counted("ACT")]<<std::endl;
+        report_stream()<<"rank_stats.cmd_counters[PRE]    : "<<rank_stats.cmd_counters[m_cmds_counted("PRE")]<<std::endl;
+        report_stream()<<"rank_stats.cmd_counters[RD]     : "<<rank_stats.cmd_counters[m_cmds_counted("RD")]<<std::endl;
+        report_stream()<<"rank_stats.cmd_counters[WR]     : "<<rank_stats.cmd_counters[m_cmds_counted("WR")]<<std::endl;
+        report_stream()<<"rank_stats.cmd_counters[ACT_L]  : "<<rank_stats.cmd_counters[m_cmds_counted("ACT_L")]<<std::endl;
+        report_stream()<<"rank_stats.cmd_counters[PRE_L]  : "<<rank_stats.cmd_counters[m_cmds_counted("PRE_L")]<<std::endl;
+        report_stream()<<"rank_stats.cmd_counters[RD_L]   : "<<rank_stats.cmd_counters[m_cmds_counted("RD_L")]<<std::endl;
+        report_stream()<<"rank_stats.cmd_counters[WR_L]   : "<<rank_stats.cmd_counters[m_cmds_counted("WR_L")]<<std::endl;
+        report_stream()<<"rank_stats.cmd_counters[REFab_L]: "<<rank_stats.cmd_counters[m_cmds_counted("REFab_L")]<<std::endl;
       #endif
 
       rank_stats.total_background_energy = num_dev_per_rank * (rank_stats.act_background_energy + rank_stats.pre_background_energy);
@@ -1195,12 +1262,12 @@ class DDR5AsyncDIMM : public IDRAM, public Implementation {
       s_total_background_power += (background_power);
       s_total_cmd_power        += (command_power);
       s_total_power            += total_power;
-      std::cout<<"["<<rank_stats.rank_id<<"] Power Report"<<std::endl;
-      std::cout<<" - Background Energy (nJ) : "<<rank_stats.total_background_energy<<std::endl;
-      std::cout<<" - Command Energy (nJ)    : "<<rank_stats.total_cmd_energy<<std::endl;
-      std::cout<<" - Background Power (W)   : "<<background_power<<std::endl;
-      std::cout<<" - Command Power (W)      : "<<command_power<<std::endl;
-      std::cout<<" - Rank Power (W)         : "<<total_power<<std::endl;
+      report_stream()<<"["<<rank_stats.rank_id<<"] Power Report"<<std::endl;
+      report_stream()<<" - Background Energy (nJ) : "<<rank_stats.total_background_energy<<std::endl;
+      report_stream()<<" - Command Energy (nJ)    : "<<rank_stats.total_cmd_energy<<std::endl;
+      report_stream()<<" - Background Power (W)   : "<<background_power<<std::endl;
+      report_stream()<<" - Command Power (W)      : "<<command_power<<std::endl;
+      report_stream()<<" - Rank Power (W)         : "<<total_power<<std::endl;
     }
 };
 
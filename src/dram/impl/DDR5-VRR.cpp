@@ -207,13 +207,9 @@ class DDR5VRR : public IDRAM, public Implementation {
       m_clk++;
 
       // Check if there is any future action at this cycle
-      for (int i = m_future_actions.size() - 1; i >= 0; i--) {
-        auto& future_action = m_future_actions[i];
-        if (future_action.clk == m_clk) {
-          handle_future_action(future_action.cmd, future_action.addr_vec);
-          m_future_actions.erase(m_future_actions.begin() + i);
-        }
-      }
+      m_future_actions.handle_due(m_clk, [this](const FutureAction& future_action) {
+        handle_future_action(future_action.cmd, future_action.addr_vec);
+      });
     };
 
     void init() override {
@@ -230,7 +226,7 @@ class DDR5VRR : public IDRAM, public Implementation {
       create_nodes();
     };
 
-    void issue_command(int command, const AddrVec_t& addr_vec) override {
+    void issue_device_command(int command, const AddrVec_t& addr_vec) override {
       int channel_id = addr_vec[m_levels["channel"]];
       m_channels[channel_id]->update_timing(command, addr_vec, m_clk);
       m_channels[channel_id]->update_powers(command, addr_vec, m_clk);
@@ -243,25 +239,25 @@ class DDR5VRR : public IDRAM, public Implementation {
     void check_future_action(int command, const AddrVec_t& addr_vec) {
       switch (command) {
         case m_commands("REFab"):
-          m_future_actions.push_back({command, addr_vec, m_clk + m_timing_vals("nRFC1") - 1});
+          add_future_action(command, addr_vec, m_clk + m_timing_vals("nRFC1") - 1);
           break;
         case m_commands("REFsb"):
-          m_future_actions.push_back({command, addr_vec, m_clk + m_timing_vals("nRFCsb") - 1});
+          add_future_action(command, addr_vec, m_clk + m_timing_vals("nRFCsb") - 1);
           break;
         case m_commands("RFMab"):
-          m_future_actions.push_back({command, addr_vec, m_clk + m_timing_vals("nRFM1") - 1});
+          add_future_action(command, addr_vec, m_clk + m_timing_vals("nRFM1") - 1);
           break;
         case m_commands("RFMsb"):
-          m_future_actions.push_back({command, addr_vec, m_clk + m_timing_vals("nRFMsb") - 1});
+          add_future_action(command, addr_vec, m_clk + m_timing_vals("nRFMsb") - 1);
           break;
         case m_commands("DRFMab"):
-          m_future_actions.push_back({command, addr_vec, m_clk + m_timing_vals("nDRFMab") - 1});
+          add_future_action(command, addr_vec, m_clk + m_timing_vals("nDRFMab") - 1);
           break;
         case m_commands("DRFMsb"):
-          m_future_actions.push_back({command, addr_vec, m_clk + m_timing_vals("nDRFMsb") - 1});
+          add_future_action(command, addr_vec, m_clk + m_timing_vals("nDRFMsb") - 1);
           break;
         case m_commands("VRR"):
-          m_future_actions.push_back({command, addr_vec, m_clk + m_timing_vals("nVRR") - 1});
+          add_future_action(command, addr_vec, m_clk + m_timing_vals("nVRR") - 1);
           break;
         default:
           // Other commands do not require future actions
@@ -1,4 +1,5 @@
 #include "dram/dram.h"
+#include "dram/flat_timing.h"
 #include "dram/lambdas.h"
 #include <iomanip>
 
@@ -399,6 +400,8 @@ class DDR5PCH : public IDRAM, public Implementation {
     Logger_t m_logger;
 
     std::vector<Node*> m_channels;
+    bool m_use_flat_timing = false;           // Keep the timing state of the nodes in flat arrays instead of the node tree
+    FlatTimingState<DDR5PCH> m_flat_timing;
     
     FuncMatrix<ActionFunc_t<Node>>  m_actions;
     FuncMatrix<PreqFunc_t<Node>>    m_preqs;
@@ -409,7 +412,7 @@ class DDR5PCH : public IDRAM, public Implementation {
     double s_total_rfm_energy = 0.0;
 
     std::vector<size_t> s_total_rfm_cycles;
-    std::vector<bool>   each_pch_refreshing;
+    std::vector<uint8_t> each_pch_refreshing;  // Not a (bit-packed) vector<bool>: channels may be issuing REFab in parallel
     int num_pseudo_ch = 0; 
     std::vector<int> db_prefetch_cnt_per_pch;
     std::vector<int> db_prefetch_rd_cnt_per_pch;
@@ -571,18 +574,25 @@ class DDR5PCH : public IDRAM, public Implementation {
   public:
     int m_BRC = 2;
 
+    // The NDP units run at 1/4 of the DRAM clock. They tick inside the DRAM tick (after the device
+    // states and before the controllers), so they cannot be a separate domain of the ClockScheduler.
+    static constexpr int NDP_CLOCK_RATIO = 4;
+
 
   public:
     void tick() override {
+      RAMULATOR_PROFILE_SCOPE();
       m_clk++;
 
       // Check if there is any future action at this cycle
-      for (int i = m_future_actions.size() - 1; i >= 0; i--) {
-        auto& future_action = m_future_actions[i];
-        if (future_action.clk == m_clk) {
-          handle_future_action(future_action.cmd, future_action.addr_vec);
-          m_future_actions.erase(m_future_actions.begin() + i);
-        }
+      m_future_actions.handle_due(m_clk, [this](const FutureAction& future_action) {
+        handle_future_action(future_action.cmd, future_action.addr_vec);
+      });
+
+      if (m_energy_trace && m_clk >= m_energy_trace->next_clk()) {
+        m_energy_trace->sample(m_clk, m_power_stats, [this](const std::vector<size_t>& cmd_counters, Clk_t active_cycles, Clk_t idle_cycles) {
+          return get_device_energy(cmd_counters, active_cycles, idle_cycles);
+        });
       }
 
       // NDP Unit tick()
@@ -593,7 +603,7 @@ class DDR5PCH : public IDRAM, public Implementation {
         }
       }      
       
-      if(m_clk%4 == 0) {
+      if(m_clk % NDP_CLOCK_RATIO == 0) {
         // NDP Unit Clock is 1/4 of DRAM clock
         // iteration each channel and pseudo channel
         for(int ch=0;ch<m_num_channels;ch++) {
@@ -1217,6 +1227,11 @@ class DDR5PCH : public IDRAM, public Implementation {
       }
     };
 
+    // The NDP units do work (and count status cycles) every cycle, so never skip ahead
+    Clk_t get_next_event_clk() override {
+      return m_clk + 1;
+    };
+
     void init() override {
       m_logger = Logging::create_logger("DDR5-PCH");
       RAMULATOR_DECLARE_SPECS();
@@ -1267,18 +1282,22 @@ class DDR5PCH : public IDRAM, public Implementation {
       m_cmds.REFsb_end = m_commands("REFsb_end");      
     };
 
-    void issue_command(int command, const AddrVec_t& addr_vec) override {
+    void issue_device_command(int command, const AddrVec_t& addr_vec) override {
       int channel_id = addr_vec[m_levels["channel"]];
 
-      m_channels[channel_id]->update_timing(command, addr_vec, m_clk);
+      if (m_use_flat_timing) {
+        m_flat_timing.update_timing(command, addr_vec, m_clk);
+      } else {
+        m_channels[channel_id]->update_timing(command, addr_vec, m_clk);
+      }
       m_channels[channel_id]->update_powers(command, addr_vec, m_clk);
       m_channels[channel_id]->update_states(command, addr_vec, m_clk);  
 
       
-      if(command == m_commands("PRE_WR")){
+      if(command == m_commands["PRE_WR"]){
         pre_wr_cnt_per_ch[channel_id]++;
       }
-      if(command == m_commands("POST_WR")) {
+      if(command == m_commands["POST_WR"]) {
         post_wr_cnt_per_ch[channel_id]++;
       }
                        
@@ -1370,22 +1389,22 @@ class DDR5PCH : public IDRAM, public Implementation {
           // std::cout<<" / "<<db_prefetch_rd_cnt_per_pch[num_pseudo_ch*addr_vec[0]+addr_vec[1]];
           // std::cout<<" / "<<db_prefetch_wr_cnt_per_pch[num_pseudo_ch*addr_vec[0]+addr_vec[1]]<<std::endl;
           // if(db_prefetch_cnt_per_pch[num_pseudo_ch*addr_vec[0]+addr_vec[1]] > 0) exit(1);
-          m_future_actions.push_back({command, addr_vec, m_clk + m_timing_vals("nRFC1") - 1});
+          add_future_action(command, addr_vec, m_clk + m_timing_vals(m_timings["nRFC1"]) - 1);
           break;
         case m_commands("REFsb"):
-          m_future_actions.push_back({command, addr_vec, m_clk + m_timing_vals("nRFCsb") - 1});
+          add_future_action(command, addr_vec, m_clk + m_timing_vals(m_timings["nRFCsb"]) - 1);
           break;
         // case m_commands("RFMab"):
-        //   m_future_actions.push_back({command, addr_vec, m_clk + m_timing_vals("nRFM1") - 1});
+        //   add_future_action(command, addr_vec, m_clk + m_timing_vals("nRFM1") - 1);
         //   break;
         // case m_commands("RFMsb"):
-        //   m_future_actions.push_back({command, addr_vec, m_clk + m_timing_vals("nRFMsb") - 1});
+        //   add_future_action(command, addr_vec, m_clk + m_timing_vals("nRFMsb") - 1);
         //   break;
         // case m_commands("DRFMab"):
-        //   m_future_actions.push_back({command, addr_vec, m_clk + m_timing_vals("nDRFMab") - 1});
+        //   add_future_action(command, addr_vec, m_clk + m_timing_vals("nDRFMab") - 1);
         //   break;
         // case m_commands("DRFMsb"):
-        //   m_future_actions.push_back({command, addr_vec, m_clk + m_timing_vals("nDRFMsb") - 1});
+        //   add_future_action(command, addr_vec, m_clk + m_timing_vals("nDRFMsb") - 1);
         //   break;
         default:
           // Other commands do not require future actions
@@ -1401,12 +1420,12 @@ class DDR5PCH : public IDRAM, public Implementation {
           each_pch_refreshing[num_pseudo_ch*addr_vec[0]+addr_vec[1]]=false;
           // db_prefetch_change_mode(addr_vec[0],addr_vec[1]);
           // std::cout<<"["<<m_clk<<"] REFab Done CH["<<addr_vec[0]<<"]PCH["<<addr_vec[1]<<"] "<<db_prefetch_cnt_per_pch[num_pseudo_ch*addr_vec[0]+addr_vec[1]]<<std::endl;
-          m_channels[channel_id]->update_powers(m_commands("REFab_end"), addr_vec, m_clk);
-          m_channels[channel_id]->update_states(m_commands("REFab_end"), addr_vec, m_clk);
+          m_channels[channel_id]->update_powers(m_commands["REFab_end"], addr_vec, m_clk);
+          m_channels[channel_id]->update_states(m_commands["REFab_end"], addr_vec, m_clk);
           break;
         case m_commands("REFsb"):
-          m_channels[channel_id]->update_powers(m_commands("REFsb_end"), addr_vec, m_clk);
-          m_channels[channel_id]->update_states(m_commands("REFsb_end"), addr_vec, m_clk);
+          m_channels[channel_id]->update_powers(m_commands["REFsb_end"], addr_vec, m_clk);
+          m_channels[channel_id]->update_states(m_commands["REFsb_end"], addr_vec, m_clk);
           break;
         // case m_commands("RFMab"):
         //   m_channels[channel_id]->update_powers(m_commands("RFMab_end"), addr_vec, m_clk);
@@ -1475,7 +1494,14 @@ class DDR5PCH : public IDRAM, public Implementation {
       int channel_id = addr_vec[m_levels["channel"]];
       bool is_ready = true;
       if(m_command_meta[command].is_closing && get_need_be_open_per_bank(addr_vec)) is_ready = false;
-      return is_ready && m_channels[channel_id]->check_ready(command, addr_vec, m_clk);
+      return is_ready && (m_use_flat_timing ? m_flat_timing.check_ready(command, addr_vec, m_clk) : m_channels[channel_id]->check_ready(command, addr_vec, m_clk));
+    };
+
+    Clk_t get_ready_clk(int command, const AddrVec_t& addr_vec) override {
+      int channel_id = addr_vec[m_levels["channel"]];
+      // Blocked until the bank no longer needs to be open (which invalidates the cached ready clocks)
+      if(m_command_meta[command].is_closing && get_need_be_open_per_bank(addr_vec)) return std::numeric_limits<Clk_t>::max();
+      return m_use_flat_timing ? m_flat_timing.get_ready_clk(command, addr_vec) : m_channels[channel_id]->get_ready_clk(command, addr_vec);
     };
 
     bool check_rowbuffer_hit(int command, const AddrVec_t& addr_vec) override {
@@ -1562,6 +1588,7 @@ class DDR5PCH : public IDRAM, public Implementation {
 
     void reset_need_be_open_per_bank(u_int32_t channel_idx) override {
       need_be_open_per_bank[channel_idx].assign(need_be_open_per_bank[channel_idx].size(), false);
+      invalidate_ready_clks(channel_idx);
     };
 
     void set_need_be_open_per_bank(const AddrVec_t& addr_vec) override {
@@ -1571,6 +1598,7 @@ class DDR5PCH : public IDRAM, public Implementation {
                        addr_vec[5] * m_num_banks +
                        addr_vec[6];
         need_be_open_per_bank[addr_vec[0]][idx] = true;
+        invalidate_ready_clks(addr_vec[0]);
       }
     };
 
@@ -2363,6 +2391,12 @@ class DDR5PCH : public IDRAM, public Implementation {
         }
       }
 
+      if (auto trace_path = param<std::string>("energy_trace_path").desc("Write the energy of each rank in every epoch to this CSV file.").optional()) {
+        Clk_t epoch = param<Clk_t>("energy_trace_epoch").desc("Number of cycles in each epoch of the energy trace.").default_val(100000);
+        int num_dev_per_rank = (m_channel_width+m_parity_width)/m_organization.dq;
+        m_energy_trace = std::make_unique<EnergyTrace>(*trace_path, epoch, m_power_stats, num_dev_per_rank);
+      }
+
       m_powers.resize(m_levels.size(), std::vector<PowerFunc_t<Node>>(m_commands.size()));
 
       m_powers[m_levels["bank"]][m_commands["ACT"]]          = Lambdas::Power::Bank::ACT<DDR5PCH>;
@@ -2442,6 +2476,39 @@ class DDR5PCH : public IDRAM, public Implementation {
         Node* channel = new Node(this, nullptr, 0, i);
         m_channels.push_back(channel);
       }
+
+      m_use_flat_timing = param<bool>("flat_timing_state").desc("Keep the timing state of the nodes in flat arrays indexed by node id instead of the node tree.").default_val(false);
+      if (m_use_flat_timing) {
+        m_flat_timing.init(this);
+      }
+    }
+
+    void serialize(Archive& ar) override {
+      serialize_device(ar);
+      for (auto channel : m_channels) {
+        channel->serialize(ar);
+      }
+      if (m_use_flat_timing) {
+        ar & m_flat_timing;
+      }
+      ar & s_total_rfm_energy & s_total_rfm_cycles;
+
+      // Data buffer prefetch and refresh state
+      ar & each_pch_refreshing & db_prefetch_cnt_per_pch & db_prefetch_rd_cnt_per_pch & db_prefetch_wr_cnt_per_pch;
+      ar & pre_wr_cnt_per_ch & post_wr_cnt_per_ch & need_be_open_per_bank;
+      ar & m_high_pri_prefetch & m_db_prefetch_mode;
+
+      // NDP units: memories, registers, instruction slots and the command pipeline
+      ar & ins_mem_per_pch & dat_mem_per_pch & ndp_status_per_pch & ndp_pc_per_pch & ndp_inst_slot_per_pch & loop_cnt_per_pch;
+      ar & pipe_ndp_latency_per_pch & pipe_ndp_cmd_per_pch & pipe_ndp_addr_per_pch & pipe_ndp_id_per_pch;
+      ar & pipe_ndp_payload_valid_per_pch & pipe_ndp_payload_per_pch;
+      ar & ndp_valid_per_pch & ndp_cmd_per_pch & ndp_addr_per_pch & ndp_id_per_pch & ndp_payload_valid_per_pch;
+      ar & ndp_op_cnt_per_pch & ndp_rd_config_reg_per_pch & pch_dsnc_status_cnt;
+      ar & ndp_segments_per_pch & ndp_cur_segment_per_pch & ndp_seg_tracking_per_pch & ndp_seg_cnt_per_pch;
+      ar & is_pch_error & error_pch;
+      #ifdef PCH_DEBUG
+      ar & ndp_inst_hist_per_pch & m_row_access_counts;
+      #endif
     }
     
     void finalize() override {
@@ -2449,6 +2516,12 @@ class DDR5PCH : public IDRAM, public Implementation {
       if (!m_drampower_enable)
         return;
 
+      if (m_energy_trace) {
+        m_energy_trace->close(m_clk, m_power_stats, [this](const std::vector<size_t>& cmd_counters, Clk_t active_cycles, Clk_t idle_cycles) {
+          return get_device_energy(cmd_counters, active_cycles, idle_cycles);
+        });
+      }
+
       // pJ per one bit (on PCB/Socket)
       double socket_dq_energy = 18.48;
       double on_board_dq_energy = 10.08;
@@ -2594,74 +2667,74 @@ class DDR5PCH : public IDRAM, public Implementation {
         s_total_power     += (chanenl_socket_dq_power + chanenl_onboard_dq_power + channel_access_buf_power + channel_onboard_ecc_power + channel_ndp_power);
         total_ndp_energy += (channel_ndp_energy + channel_access_buf_energy + channel_onboard_ecc_energy);
         total_ndp_power  += (channel_ndp_power  + channel_access_buf_power + channel_onboard_ecc_power);
-        std::cout<<"["<<i<<"] Channel DQ Power Report"<<std::endl;
-        std::cout<<" - DQ (Socket) Energy (nJ)  : "<<channel_socket_dq_energy<<std::endl;
-        std::cout<<" - DQ (OnBoard) Energy (nJ) : "<<channel_onboard_dq_energy<<std::endl;
-        std::cout<<" - DQ (Buffer) Energy (nJ)  : "<<channel_access_buf_energy<<std::endl;
-        std::cout<<" - DQ (ECC) Energy (nJ)     : "<<channel_onboard_ecc_energy<<std::endl;
-        std::cout<<" - NDP Ops Energy (nJ)      : "<<channel_ndp_energy<<std::endl;
-        std::cout<<" - DQ (Socket) Power (W)    : "<<chanenl_socket_dq_power<<std::endl;   
-        std::cout<<" - DQ (OnBoard) Power (W)   : "<<chanenl_onboard_dq_power<<std::endl; 
-        std::cout<<" - DQ (Buffer) Power (W)    : "<<channel_access_buf_power<<std::endl;  
-        std::cout<<" - DQ (ECC) Power (W)       : "<<channel_onboard_ecc_power<<std::endl; 
-        std::cout<<" - NDP Ops Power (W)        : "<<channel_ndp_power<<std::endl; 
+        report_stream()<<"["<<i<<"] Channel DQ Power Report"<<std::endl;
+        report_stream()<<" - DQ (Socket) Energy (nJ)  : "<<channel_socket_dq_energy<<std::endl;
+        report_stream()<<" - DQ (OnBoard) Energy (nJ) : "<<channel_onboard_dq_energy<<std::endl;
+        report_stream()<<" - DQ (Buffer) Energy (nJ)  : "<<channel_access_buf_energy<<std::endl;
+        report_stream()<<" - DQ (ECC) Energy (nJ)     : "<<channel_onboard_ecc_energy<<std::endl;
+        report_stream()<<" - NDP Ops Energy (nJ)      : "<<channel_ndp_energy<<std::endl;
+        report_stream()<<" - DQ (Socket) Power (W)    : "<<chanenl_socket_dq_power<<std::endl;   
+        report_stream()<<" - DQ (OnBoard) Power (W)   : "<<chanenl_onboard_dq_power<<std::endl; 
+        report_stream()<<" - DQ (Buffer) Power (W)    : "<<channel_access_buf_power<<std::endl;  
+        report_stream()<<" - DQ (ECC) Power (W)       : "<<channel_onboard_ecc_power<<std::endl; 
+        report_stream()<<" - NDP Ops Power (W)        : "<<channel_ndp_power<<std::endl; 
       }
 
-      std::cout<<" ==== Total Channel Power Report === "<<std::endl;
-      std::cout<<" - DRAM Background Energy (nJ)  : "<<s_total_background_energy<<std::endl;
-      std::cout<<" - DRAM Command Energy (nJ)     : "<<s_total_cmd_energy<<std::endl;
-      std::cout<<" - DRAM DQ Energy (nJ)          : "<<s_total_dq_energy<<std::endl;
-      std::cout<<" - NDP Ops Energy (nJ)          : "<<total_ndp_energy<<std::endl;
+      report_stream()<<" ==== Total Channel Power Report === "<<std::endl;
+      report_stream()<<" - DRAM Background Energy (nJ)  : "<<s_total_background_energy<<std::endl;
+      report_stream()<<" - DRAM Command Energy (nJ)     : "<<s_total_cmd_energy<<std::endl;
+      report_stream()<<" - DRAM DQ Energy (nJ)          : "<<s_total_dq_energy<<std::endl;
+      report_stream()<<" - NDP Ops Energy (nJ)          : "<<total_ndp_energy<<std::endl;
 
-      std::cout<<" - Total DRAM Energy (nJ)       : "<<s_total_energy<<std::endl;
-      std::cout<<" - DRAM Background Power (W)    : "<<s_total_background_power<<std::endl;
-      std::cout<<" - DRAM Command Power (W)       : "<<s_total_cmd_power<<std::endl;
-      std::cout<<" - DRAM DQ Power(W)             : "<<s_total_dq_power<<std::endl;
-      std::cout<<" - NDP Ops Power(W)             : "<<total_ndp_power<<std::endl;
-      std::cout<<" - Total DRAM Power (W)         : "<<s_total_power<<std::endl;
+      report_stream()<<" - Total DRAM Energy (nJ)       : "<<s_total_energy<<std::endl;
+      report_stream()<<" - DRAM Background Power (W)    : "<<s_total_background_power<<std::endl;
+      report_stream()<<" - DRAM Command Power (W)       : "<<s_total_cmd_power<<std::endl;
+      report_stream()<<" - DRAM DQ Power(W)             : "<<s_total_dq_power<<std::endl;
+      report_stream()<<" - NDP Ops Power(W)             : "<<total_ndp_power<<std::endl;
+      report_stream()<<" - Total DRAM Power (W)         : "<<s_total_power<<std::endl;
 
-      std::cout<<" ==== Total Channel Bandwidth (GB/s) Report === "<<std::endl;
+      report_stream()<<" ==== Total Channel Bandwidth (GB/s) Report === "<<std::endl;
       total_host_bw = (double)((double)host_acc * 512.0) / ((double)m_clk * (double)m_timing_vals("tCK_ps") / 1000.0) / 8;
       total_db_bw   = (double)((double)db_acc * 512.0 * (double)dq_scaling) / ((double)m_clk * (double)m_timing_vals("tCK_ps") / 1000.0) / 8;
       total_ndp_bw  = (double)((double)ndp_exec * 512.0 * (double)dq_scaling) / ((double)m_clk * (double)m_timing_vals("tCK_ps") / 1000.0) / 8;            
-      std::cout<<" - Total Host <-> DB Bandwidth      : "<<total_host_bw<<std::endl;  
-      std::cout<<" - Total DB <-> DRAMs Bandwidth     : "<<total_db_bw<<std::endl;  
-      std::cout<<" - Total NDP Bandwidth              : "<<total_ndp_bw<<std::endl;  
-      std::cout<<" - Total Host Access                : "<<host_acc<<std::endl;
-      std::cout<<" - Total DB Access                  : "<<db_acc<<std::endl;
-      std::cout<<" - Total NDP Access                 : "<<ndp_exec<<std::endl;
+      report_stream()<<" - Total Host <-> DB Bandwidth      : "<<total_host_bw<<std::endl;  
+      report_stream()<<" - Total DB <-> DRAMs Bandwidth     : "<<total_db_bw<<std::endl;  
+      report_stream()<<" - Total NDP Bandwidth              : "<<total_ndp_bw<<std::endl;  
+      report_stream()<<" - Total Host Access                : "<<host_acc<<std::endl;
+      report_stream()<<" - Total DB Access                  : "<<db_acc<<std::endl;
+      report_stream()<<" - Total NDP Access                 : "<<ndp_exec<<std::endl;
 
       // DIMM-side NDP Status 
-        std::cout<<"DIMM-side NDP Ctrl Status Stats (total cycle: "<<m_clk<<")"<<std::endl;
-        std::cout<<"   - Each PCH"<<std::endl;        
-        std::cout<<"--------------------------------------------------------------------------------------------"<<std::endl;      
+        report_stream()<<"DIMM-side NDP Ctrl Status Stats (total cycle: "<<m_clk<<")"<<std::endl;
+        report_stream()<<"   - Each PCH"<<std::endl;        
+        report_stream()<<"--------------------------------------------------------------------------------------------"<<std::endl;      
       for(int ndp_status=0;ndp_status<9;ndp_status++) {
-        std::cout<<"["<<m_ndp_status(ndp_status)<<"] : ";
+        report_stream()<<"["<<m_ndp_status(ndp_status)<<"] : ";
         for(int ch=0;ch<m_num_channels;ch++) {
           for(int pch=0;pch<m_num_pseudochannel;pch++) {
             int pch_idx = ch*m_num_pseudochannel + pch; 
-            std::cout<<pch_dsnc_status_cnt[pch_idx][ndp_status];
+            report_stream()<<pch_dsnc_status_cnt[pch_idx][ndp_status];
             if(pch_idx != (m_num_pseudochannel*m_num_channels - 1))
-              std::cout<<" | ";                
+              report_stream()<<" | ";                
             // 
           }
         }
-        std::cout<<std::endl;
+        report_stream()<<std::endl;
       }
-      std::cout<<"--------------------------------------------------------------------------------------------"<<std::endl;
+      report_stream()<<"--------------------------------------------------------------------------------------------"<<std::endl;
 
       // NDP Segment Tracking Report (only when enabled)
       if (m_ndp_seg_tracking_enable) {
       double tCK_ns = (double)m_timing_vals("tCK_ps") / 1000.0;
-      std::cout<<"\n=== NDP Segment Tracking Report ==="<<std::endl;
+      report_stream()<<"\n=== NDP Segment Tracking Report ==="<<std::endl;
       for(int ch=0;ch<m_num_channels;ch++) {
         for(int pch=0;pch<m_num_pseudochannel;pch++) {
           int pch_idx = ch*m_num_pseudochannel + pch;
           auto& segs = ndp_segments_per_pch[pch_idx];
           if (segs.empty()) continue;
-          std::cout<<"\n--- CH["<<ch<<"] PCH["<<pch<<"] ("<<segs.size()<<" segments) ---"<<std::endl;
-          std::cout<<"  Seg | Type      | FetchStart | DrainStart |    SegEnd  |  Total | Fetch | Drain"<<std::endl;
-          std::cout<<"------+-----------+------------+------------+-----------+--------+-------+------"<<std::endl;
+          report_stream()<<"\n--- CH["<<ch<<"] PCH["<<pch<<"] ("<<segs.size()<<" segments) ---"<<std::endl;
+          report_stream()<<"  Seg | Type      | FetchStart | DrainStart |    SegEnd  |  Total | Fetch | Drain"<<std::endl;
+          report_stream()<<"------+-----------+------------+------------+-----------+--------+-------+------"<<std::endl;
 
           // Per-type aggregation
           Clk_t total_rd_cycles = 0, total_wr_cycles = 0, total_wait_cycles = 0, total_self_exec_cycles = 0;
@@ -2671,15 +2744,15 @@ class DDR5PCH : public IDRAM, public Implementation {
             Clk_t total  = s.end - s.fetch_start;
             Clk_t fetch  = (s.drain_start > 0) ? (s.drain_start - s.fetch_start) : total;
             Clk_t drain  = (s.drain_start > 0) ? (s.end - s.drain_start) : 0;
-            std::cout<<"  "<<std::setw(3)<<s.seg_id<<" | "
-                     <<std::setw(9)<<std::left<<ndp_seg_type_str(s.type)<<std::right<<" | "
-                     <<std::setw(10)<<s.fetch_start<<" | "
-                     <<std::setw(10)<<((s.drain_start > 0) ? std::to_string(s.drain_start) : "-")<<" | "
-                     <<std::setw(9)<<s.end<<" | "
-                     <<std::setw(6)<<total<<" | "
-                     <<std::setw(5)<<fetch<<" | "
-                     <<std::setw(5)<<drain
-                     <<std::endl;
+            report_stream()<<"  "<<std::setw(3)<<s.seg_id<<" | "
+                           <<std::setw(9)<<std::left<<ndp_seg_type_str(s.type)<<std::right<<" | "
+                           <<std::setw(10)<<s.fetch_start<<" | "
+                           <<std::setw(10)<<((s.drain_start > 0) ? std::to_string(s.drain_start) : "-")<<" | "
+                           <<std::setw(9)<<s.end<<" | "
+                           <<std::setw(6)<<total<<" | "
+                           <<std::setw(5)<<fetch<<" | "
+                           <<std::setw(5)<<drain
+                           <<std::endl;
             switch(s.type) {
               case NdpSegType::RD:        total_rd_cycles += total; rd_cnt++; break;
               case NdpSegType::WR:        total_wr_cycles += total; wr_cnt++; break;
@@ -2688,31 +2761,32 @@ class DDR5PCH : public IDRAM, public Implementation {
               default: break;
             }
           }
-          std::cout<<"------+-----------+------------+------------+-----------+--------+-------+------"<<std::endl;
+          report_stream()<<"------+-----------+------------+------------+-----------+--------+-------+------"<<std::endl;
           Clk_t first_start = segs.front().fetch_start;
           Clk_t last_end = segs.back().end;
           Clk_t total_span = last_end - first_start;
-          std::cout<<"  Total NDP span: "<<total_span<<" cycles ("
-                   <<(double)total_span * tCK_ns<<" ns)"<<std::endl;
+          report_stream()<<"  Total NDP span: "<<total_span<<" cycles ("
+                         <<(double)total_span * tCK_ns<<" ns)"<<std::endl;
           if (rd_cnt > 0)
-            std::cout<<"  RD segments:        "<<rd_cnt<<" segs, "<<total_rd_cycles<<" cycles (avg "<<(total_rd_cycles/rd_cnt)<<")"<<std::endl;
+            report_stream()<<"  RD segments:        "<<rd_cnt<<" segs, "<<total_rd_cycles<<" cycles (avg "<<(total_rd_cycles/rd_cnt)<<")"<<std::endl;
           if (wr_cnt > 0)
-            std::cout<<"  WR segments:        "<<wr_cnt<<" segs, "<<total_wr_cycles<<" cycles (avg "<<(total_wr_cycles/wr_cnt)<<")"<<std::endl;
+            report_stream()<<"  WR segments:        "<<wr_cnt<<" segs, "<<total_wr_cycles<<" cycles (avg "<<(total_wr_cycles/wr_cnt)<<")"<<std::endl;
           if (self_exec_cnt > 0)
-            std::cout<<"  SELF_EXEC segments: "<<self_exec_cnt<<" segs, "<<total_self_exec_cycles<<" cycles (avg "<<(total_self_exec_cycles/self_exec_cnt)<<")"<<std::endl;
+            report_stream()<<"  SELF_EXEC segments: "<<self_exec_cnt<<" segs, "<<total_self_exec_cycles<<" cycles (avg "<<(total_self_exec_cycles/self_exec_cnt)<<")"<<std::endl;
           if (wait_cnt > 0)
-            std::cout<<"  WAIT segments:      "<<wait_cnt<<" segs, "<<total_wait_cycles<<" cycles (avg "<<(total_wait_cycles/wait_cnt)<<")"<<std::endl;
+            report_stream()<<"  WAIT segments:      "<<wait_cnt<<" segs, "<<total_wait_cycles<<" cycles (avg "<<(total_wait_cycles/wait_cnt)<<")"<<std::endl;
         }
       }
-      std::cout<<"=== End NDP Segment Tracking Report ===\n"<<std::endl;
+      report_stream()<<"=== End NDP Segment Tracking Report ===\n"<<std::endl;
       } // end m_ndp_seg_tracking_enable
     }
-    void process_rank_energy(PowerStats& rank_stats, Node* rank_node) {
-      
-      Lambdas::Power::Rank::finalize_rank<DDR5PCH>(rank_node, 0, AddrVec_t(), m_clk);
+    /**
+     * @brief    Computes the energy of one device of a rank from its command counters and active/idle cycles
+     * 
+     */
+    RankEnergy get_device_energy(const std::vector<size_t>& cmd_counters, Clk_t active_cycles, Clk_t idle_cycles) {
       size_t num_bankgroups = m_organization.count[m_levels["bankgroup"]];
       size_t num_banks = m_organization.count[m_levels["bank"]];
-      int num_dev_per_rank = (m_channel_width+m_parity_width)/m_organization.dq;      
 
       auto TS = [&](std::string_view timing) { return m_timing_vals(timing); };
       auto VE = [&](std::string_view voltage) { return m_voltage_vals(voltage); };
@@ -2723,43 +2797,66 @@ class DDR5PCH : public IDRAM, public Implementation {
       double one_bank_idd3N = (CE("IDD3N") - CE("IDD2N"))/(num_bankgroups * num_banks);
       double one_bank_ipp3N = (CE("IPP3N") - CE("IPP2N"))/(num_bankgroups * num_banks);
 
-      rank_stats.act_background_energy = (VE("VDD") * CE("IDD3N") + VE("VPP") * CE("IPP3N")) 
-                                            * rank_stats.active_cycles * tCK_ns / 1E3;
+      RankEnergy energy;
+      energy.act_background = (VE("VDD") * CE("IDD3N") + VE("VPP") * CE("IPP3N")) 
+                                            * active_cycles * tCK_ns / 1E3;
 
-      rank_stats.pre_background_energy = (VE("VDD") * CE("IDD2N") + VE("VPP") * CE("IPP2N")) 
-                                            * rank_stats.idle_cycles * tCK_ns / 1E3;
+      energy.pre_background = (VE("VDD") * CE("IDD2N") + VE("VPP") * CE("IPP2N")) 
+                                            * idle_cycles * tCK_ns / 1E3;
 
 
-      double act_cmd_energy  = (VE("VDD") * (CE("IDD0") - one_bank_idd3N) + VE("VPP") * (CE("IPP0") - one_bank_ipp3N)) 
-                                      * rank_stats.cmd_counters[m_cmds_counted("ACT")] * TS("nRAS") * tCK_ns / 1E3;
+      energy.act = (VE("VDD") * (CE("IDD0") - one_bank_idd3N) + VE("VPP") * (CE("IPP0") - one_bank_ipp3N)) 
+                                      * cmd_counters[m_cmds_counted("ACT")] * TS("nRAS") * tCK_ns / 1E3;
 
-      double pre_cmd_energy  = (VE("VDD") * (CE("IDD0") - CE("IDD2N")) + VE("VPP") * (CE("IPP0") - CE("IPP2N"))) 
-                                      * rank_stats.cmd_counters[m_cmds_counted("PRE")] * TS("nRP")  * tCK_ns / 1E3;
+      energy.pre = (VE("VDD") * (CE("IDD0") - CE("IDD2N")) + VE("VPP") * (CE("IPP0") - CE("IPP2N"))) 
+                                      * cmd_counters[m_cmds_counted("PRE")] * TS("nRP")  * tCK_ns / 1E3;
 
-      double rd_cmd_energy   = (VE("VDD") * (CE("IDD4R") - CE("IDD3N")) + VE("VPP") * (CE("IPP4R") - CE("IPP3N"))) 
-                                      * (rank_stats.cmd_counters[m_cmds_counted("RD")] + rank_stats.cmd_counters[m_cmds_counted("DRAM2DB_RD")] + rank_stats.cmd_counters[m_cmds_counted("NDP_DRAM2DB_RD")]) * TS("nBL") * tCK_ns / 1E3;
+      energy.rd = (VE("VDD") * (CE("IDD4R") - CE("IDD3N")) + VE("VPP") * (CE("IPP4R") - CE("IPP3N"))) 
+                                      * (cmd_counters[m_cmds_counted("RD")] + cmd_counters[m_cmds_counted("DRAM2DB_RD")] + cmd_counters[m_cmds_counted("NDP_DRAM2DB_RD")]) * TS("nBL") * tCK_ns / 1E3;
                                       
-      double wr_cmd_energy   = (VE("VDD") * (CE("IDD4W") - CE("IDD3N")) + VE("VPP") * (CE("IPP4W") - CE("IPP3N"))) 
-                                      * (rank_stats.cmd_counters[m_cmds_counted("WR")] + rank_stats.cmd_counters[m_cmds_counted("DB2DRAM_WR")] + rank_stats.cmd_counters[m_cmds_counted("NDP_DB2DRAM_WR")]) * TS("nBL") * tCK_ns / 1E3;
+      energy.wr = (VE("VDD") * (CE("IDD4W") - CE("IDD3N")) + VE("VPP") * (CE("IPP4W") - CE("IPP3N"))) 
+                                      * (cmd_counters[m_cmds_counted("WR")] + cmd_counters[m_cmds_counted("DB2DRAM_WR")] + cmd_counters[m_cmds_counted("NDP_DB2DRAM_WR")]) * TS("nBL") * tCK_ns / 1E3;
                                       
-      double ref_cmd_energy  = (VE("VDD") * (CE("IDD5B")) + VE("VPP") * (CE("IPP5B"))) 
-                                      * rank_stats.cmd_counters[m_cmds_counted("REF")] * TS("nRFC1") * tCK_ns / 1E3;
+      energy.ref = (VE("VDD") * (CE("IDD5B")) + VE("VPP") * (CE("IPP5B"))) 
+                                      * cmd_counters[m_cmds_counted("REF")] * TS("nRFC1") * tCK_ns / 1E3;
+
+      energy.rfm = (VE("VDD") * (CE("IDD0") - CE("IDD3N")) + VE("VPP") * (CE("IPP0") - CE("IPP3N"))) * num_bankgroups
+                                      * cmd_counters[m_cmds_counted("RFM")] * TS("nRFMsb") * tCK_ns / 1E3;
+
+      return energy;
+    }
+
+    void process_rank_energy(PowerStats& rank_stats, Node* rank_node) {
+      
+      Lambdas::Power::Rank::finalize_rank<DDR5PCH>(rank_node, 0, AddrVec_t(), m_clk);
+      int num_dev_per_rank = (m_channel_width+m_parity_width)/m_organization.dq;      
+
+      auto TS = [&](std::string_view timing) { return m_timing_vals(timing); };
+      double tCK_ns = (double) TS("tCK_ps") / 1000.0;
+
+      RankEnergy energy = get_device_energy(rank_stats.cmd_counters, rank_stats.active_cycles, rank_stats.idle_cycles);
+      rank_stats.act_background_energy = energy.act_background;
+      rank_stats.pre_background_energy = energy.pre_background;
 
-      double rfm_cmd_energy = (VE("VDD") * (CE("IDD0") - CE("IDD3N")) + VE("VPP") * (CE("IPP0") - CE("IPP3N"))) * num_bankgroups
-                                      * rank_stats.cmd_counters[m_cmds_counted("RFM")] * TS("nRFMsb") * tCK_ns / 1E3;
+      double act_cmd_energy  = energy.act;
+      double pre_cmd_energy  = energy.pre;
+      double rd_cmd_energy   = energy.rd;
+      double wr_cmd_energy   = energy.wr;
+      double ref_cmd_energy  = energy.ref;
+      double rfm_cmd_energy  = energy.rfm;
 
       #ifdef DEBUG_POWER
-        std::cout<<"act_cmd_energy                        : "<<act_cmd_energy<<std::endl;
-        std::cout<<"pre_cmd_energy                        : "<<pre_cmd_energy<<std::endl;
-        std::cout<<"rd_cmd_energy                         : "<<rd_cmd_energy<<std::endl;
-        std::cout<<"wr_cmd_energy                         : "<<wr_cmd_energy<<std::endl;
-        std::cout<<"ref_cmd_energy                        : "<<ref_cmd_energy<<std::endl;
-        std::cout<<"rank_stats.cmd_counters[ACT]          : "<<rank_stats.cmd_counters[m_cmds_counted("ACT")]<<std::endl;
-        std::cout<<"rank_stats.cmd_counters[PRE]          : "<<rank_stats.cmd_counters[m_cmds_counted("PRE")]<<std::endl;
-        std::cout<<"rank_stats.cmd_counters[RD]           : "<<rank_stats.cmd_counters[m_cmds_counted("RD")]<<std::endl;
-        std::cout<<"rank_stats.cmd_counters[WR]           : "<<rank_stats.cmd_counters[m_cmds_counted("WR")]<<std::endl;
-        std::cout<<"rank_stats.cmd_counters[DRAM2DB_RD]   : "<<rank_stats.cmd_counters[m_cmds_counted("DRAM2DB_RD")]<<std::endl;
-        std::cout<<"rank_stats.cmd_counters[DB2DRAM_WR]   : "<<rank_stats.cmd_counters[m_cmds_counted("DB2DRAM_WR")]<<std::endl;
+        report_stream()<<"act_cmd_energy                        : "<<act_cmd_energy<<std::endl;
+        report_stream()<<"pre_cmd_energy                        : "<<pre_cmd_energy<<std::endl;
+        report_stream()<<"rd_cmd_energy                         : "<<rd_cmd_energy<<std::endl;
+        report_stream()<<"wr_cmd_energy                         : "<<wr_cmd_energy<<std::endl;
+        report_stream()<<"ref_cmd_energy                        : "<<ref_cmd_energy<<std::endl;
+        report_stream()<<"rank_stats.cmd_counters[ACT]          : "<<rank_stats.cmd_counters[m_cmds_counted("ACT")]<<std::endl;
+        report_stream()<<"rank_stats.cmd_counters[PRE]          : "<<rank_stats.cmd_counters[m_cmds_counted("PRE")]<<std::endl;
+        report_stream()<<"rank_stats.cmd_counters[RD]           : "<<rank_stats.cmd_counters[m_cmds_counted("RD")]<<std::endl;
+        report_stream()<<"rank_stats.cmd_counters[WR]           : "<<rank_stats.cmd_counters[m_cmds_counted("WR")]<<std::endl;
+        report_stream()<<"rank_stats.cmd_counters[DRAM2DB_RD]   : "<<rank_stats.cmd_counters[m_cmds_counted("DRAM2DB_RD")]<<std::endl;
+        report_stream()<<"rank_stats.cmd_counters[DB2DRAM_WR]   : "<<rank_stats.cmd_counters[m_cmds_counted("DB2DRAM_WR")]<<std::endl;
       #endif
       rank_stats.total_background_energy = num_dev_per_rank * (rank_stats.act_background_energy + rank_stats.pre_background_energy);
       rank_stats.total_cmd_energy = (act_cmd_energy 
@@ -2786,12 +2883,12 @@ class DDR5PCH : public IDRAM, public Implementation {
       s_total_background_power += (background_power);
       s_total_cmd_power        += (command_power);
       s_total_power            += total_power;
-      std::cout<<"["<<rank_stats.rank_id<<"] Power Report"<<std::endl;
-      std::cout<<" - Background Energy (nJ) : "<<rank_stats.total_background_energy<<std::endl;
-      std::cout<<" - Command Energy (nJ)    : "<<rank_stats.total_cmd_energy<<std::endl;
-      std::cout<<" - Background Power (W)   : "<<background_power<< " / "<< s_total_background_power <<std::endl;
-      std::cout<<" - Command Power (W)      : "<<command_power<< " / "<< s_total_cmd_power <<std::endl;      
-      std::cout<<" - Rank Power (W)         : "<<total_power<< " / "<< s_total_power <<std::endl;           
+      report_stream()<<"["<<rank_stats.rank_id<<"] Power Report"<<std::endl;
+      report_stream()<<" - Background Energy (nJ) : "<<rank_stats.total_background_energy<<std::endl;
+      report_stream()<<" - Command Energy (nJ)    : "<<rank_stats.total_cmd_energy<<std::endl;
+      report_stream()<<" - Background Power (W)   : "<<background_power<< " / "<< s_total_background_power <<std::endl;
+      report_stream()<<" - Command Power (W)      : "<<command_power<< " / "<< s_total_cmd_power <<std::endl;      
+      report_stream()<<" - Rank Power (W)         : "<<total_power<< " / "<< s_total_power <<std::endl;           
     }
 
     void print_ndp_all_pch_status() const {
@@ -126,6 +126,9 @@ class LPDDR5 : public IDRAM, public Implementation {
     );
 
   public:
+    // The banks keep "Pre-Opened" rows (ACT-1) in the row-state maps
+    inline static constexpr bool m_multi_row_banks = true;
+
     struct Node : public DRAMNodeBase<LPDDR5> {
       Clk_t m_final_synced_cycle = -1; // Extra CAS Sync command needed for RD/WR after this cycle
 
@@ -157,7 +160,7 @@ class LPDDR5 : public IDRAM, public Implementation {
       create_nodes();
     };
 
-    void issue_command(int command, const AddrVec_t& addr_vec) override {
+    void issue_device_command(int command, const AddrVec_t& addr_vec) override {
       int channel_id = addr_vec[m_levels["channel"]];
       m_channels[channel_id]->update_timing(command, addr_vec, m_clk);
       m_channels[channel_id]->update_states(command, addr_vec, m_clk);
@@ -434,11 +437,11 @@ class LPDDR5 : public IDRAM, public Implementation {
       m_preqs[m_levels["rank"]][m_commands["REFab"]] = Lambdas::Preq::Rank::RequireAllBanksClosed<LPDDR5>;
       m_preqs[m_levels["rank"]][m_commands["RFMab"]] = Lambdas::Preq::Rank::RequireAllBanksClosed<LPDDR5>;
 
-      m_preqs[m_levels["rank"]][m_commands["REFpb"]] = [this] (Node* node, int cmd, const AddrVec_t& addr_vec, Clk_t clk) {
+      m_preqs[m_levels["rank"]][m_commands["REFpb"]] = [] (Node* node, int cmd, const AddrVec_t& addr_vec, Clk_t clk) {
 
         for (auto bg : node->m_child_nodes) {
           for (auto bank : bg->m_child_nodes) {
-            int num_banks_per_bg = m_organization.count[m_levels["bank"]];
+            int num_banks_per_bg = node->m_spec->m_organization.count[m_levels["bank"]];
             int flat_bankid = bank->m_node_id + bg->m_node_id * num_banks_per_bg;
             if (flat_bankid == addr_vec[LPDDR5::m_levels["bank"]] || flat_bankid == addr_vec[LPDDR5::m_levels["bank"]] + 8) {
               switch (node->m_state) {
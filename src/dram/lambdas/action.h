@@ -16,17 +16,17 @@ namespace Bank {
   template <class T>
   void ACT(typename T::Node* node, int cmd, int target_id, Clk_t clk) {
     node->m_state = T::m_states["Opened"];
-    node->m_row_state[target_id] = T::m_states["Opened"];
+    node->open_row(target_id);
     if(node->m_f_state == T::m_f_states["Closed"]) {
       node->m_f_state = T::m_f_states["Closed"];
-      node->m_row_f_state.clear();      
+      node->close_f_rows();
     }
   };
 
   template <class T>
   void PRE(typename T::Node* node, int cmd, int target_id, Clk_t clk) {
     node->m_state = T::m_states["Closed"];
-    node->m_row_state.clear();
+    node->close_rows();
   };
 
   template <class T>
@@ -42,13 +42,13 @@ namespace Bank {
   template <class T>
   void P_ACT(typename T::Node* node, int cmd, int target_id, Clk_t clk) {
     node->m_f_state = T::m_f_states["Opened"];
-    node->m_row_f_state[target_id] = T::m_f_states["Opened"];
+    node->open_f_row(target_id);
   };  
 
   template <class T>
   void P_PRE(typename T::Node* node, int cmd, int target_id, Clk_t clk) {
     node->m_f_state = T::m_f_states["Closed"];
-    node->m_row_f_state.clear();
+    node->close_f_rows();
   };    
 
 }       // namespace Bank
@@ -59,7 +59,7 @@ template <class T>
     for (auto bank : node->m_child_nodes) {
       if (bank->m_node_id == target_id) {
         bank->m_state = T::m_states["Closed"];
-        bank->m_row_state.clear();
+        bank->close_rows();
       }
     }
   };
@@ -79,7 +79,7 @@ template <class T>
     for (auto bank : node->m_child_nodes) {
       if (bank->m_node_id == target_id) {
         bank->m_state = T::m_states["Closed"];
-        bank->m_row_state.clear();
+        bank->close_rows();
       }
     }
   }
@@ -91,13 +91,13 @@ namespace Rank {
     if constexpr (T::m_levels["bank"] - T::m_levels["rank"] == 1) {
       for (auto bank : node->m_child_nodes) {
         bank->m_state = T::m_states["Closed"];
-        bank->m_row_state.clear();
+        bank->close_rows();
       }
     } else if constexpr (T::m_levels["bank"] - T::m_levels["rank"] == 2) {
       for (auto bg : node->m_child_nodes) {
         for (auto bank : bg->m_child_nodes) {
           bank->m_state = T::m_states["Closed"];
-          bank->m_row_state.clear();
+          bank->close_rows();
         }
       }
     } else {
@@ -136,7 +136,7 @@ namespace Channel {
       for (auto bg : node->m_child_nodes) {
         for (auto bank : bg->m_child_nodes) {
           bank->m_state = T::m_states["Closed"];
-          bank->m_row_state.clear();
+          bank->close_rows();
         }
       }
     } else if constexpr (T::m_levels["bank"] - T::m_levels["channel"] == 3) {
@@ -144,7 +144,7 @@ namespace Channel {
         for (auto bg : pc->m_child_nodes) {
           for (auto bank : bg->m_child_nodes) {
             bank->m_state = T::m_states["Closed"];
-            bank->m_row_state.clear();
+            bank->close_rows();
           }
         }
       }
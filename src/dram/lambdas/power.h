@@ -1,6 +1,9 @@
 #ifndef RAMULATOR_DRAM_LAMBDAS_POWER_H
 #define RAMULATOR_DRAM_LAMBDAS_POWER_H
 
+#include <string>
+#include <string_view>
+
 #include <spdlog/spdlog.h>
 
 namespace Ramulator {
@@ -9,40 +12,11 @@ namespace Power {
 namespace Bank {
   template <class T>
   int get_flat_rank_id(typename T::Node* node) {
-    int channel_id = -1;
-    int rank_id = -1;
-    int num_ranks = node->m_spec->get_level_size("rank");
-    if constexpr (T::m_levels["bank"] - T::m_levels["rank"] == 1) {
-      auto rank_node = node->m_parent_node;
-      auto channel_node = rank_node->m_parent_node;
-      rank_id = rank_node->m_node_id;
-      channel_id = channel_node->m_node_id;
-    } else if constexpr ((T::m_levels["rank"] - T::m_levels["channel"]) == 4) { 
-      // channel - pseudochannel - narrowio - wideio - rank - bankgroup
-      int num_pseudochannels = node->m_spec->get_level_size("pseudochannel");
-      int pseudochannel_id = -1;
-      auto bg_node = node->m_parent_node;
-      auto rank_node = bg_node->m_parent_node;
-      auto wideio_node = rank_node->m_parent_node;
-      auto narrowio_node = wideio_node->m_parent_node;
-      auto pseudochannel_node = narrowio_node->m_parent_node;
-      auto channel_node = pseudochannel_node->m_parent_node;
-      channel_id = channel_node->m_node_id;
-      pseudochannel_id = pseudochannel_node->m_node_id;
-      rank_id = rank_node->m_node_id;        
-      return channel_id * num_ranks * num_pseudochannels + pseudochannel_id * num_ranks + rank_id;
-    } else if constexpr (T::m_levels["bank"] - T::m_levels["rank"] == 2) {
-      auto bg_node = node->m_parent_node;
-      auto rank_node = bg_node->m_parent_node;
-      auto channel_node = rank_node->m_parent_node;
-      rank_id = rank_node->m_node_id;
-      channel_id = channel_node->m_node_id;
-    }
-    return channel_id * num_ranks + rank_id;
+    return node->m_flat_rank_id;
   }
 
   template <class T>
-  void debug(typename T::Node* node, std::string msg, Clk_t clk) {
+  void debug(typename T::Node* node, std::string_view msg, Clk_t clk) {
     if (node->m_spec->m_power_debug) {
       std::cout << "[Power] Rank" << Bank::get_flat_rank_id<T>(node) << " Bank" << node->m_node_id << " " << msg << " @ " << clk << std::endl;
     }
@@ -51,97 +25,97 @@ namespace Bank {
   template <class T>
   void ACT(typename T::Node* node, int cmd, const AddrVec_t& addr_vec, Clk_t clk) {
     Bank::debug<T>(node, "Incrementing ACT counter.", clk);
-    node->m_spec->m_power_stats[Bank::get_flat_rank_id<T>(node)].cmd_counters[T::m_cmds_counted("ACT")]++;
+    node->m_spec->m_power_stats[Bank::get_flat_rank_id<T>(node)].cmd_counters[T::m_cmds_counted["ACT"]]++;
   }
 
   template <class T>
   void PRE(typename T::Node* node, int cmd, const AddrVec_t& addr_vec, Clk_t clk) {
     Bank::debug<T>(node, "Incrementing PRE counter.", clk);
-    node->m_spec->m_power_stats[Bank::get_flat_rank_id<T>(node)].cmd_counters[T::m_cmds_counted("PRE")]++;
+    node->m_spec->m_power_stats[Bank::get_flat_rank_id<T>(node)].cmd_counters[T::m_cmds_counted["PRE"]]++;
   }
 
   template <class T>
   void RD(typename T::Node* node, int cmd, const AddrVec_t& addr_vec, Clk_t clk) {
     Bank::debug<T>(node, "Incrementing RD counter.", clk);
-    node->m_spec->m_power_stats[Bank::get_flat_rank_id<T>(node)].cmd_counters[T::m_cmds_counted("RD")]++;
+    node->m_spec->m_power_stats[Bank::get_flat_rank_id<T>(node)].cmd_counters[T::m_cmds_counted["RD"]]++;
   }
 
   template <class T>
   void WR(typename T::Node* node, int cmd, const AddrVec_t& addr_vec, Clk_t clk) {
     Bank::debug<T>(node, "Incrementing WR counter.", clk);
-    node->m_spec->m_power_stats[Bank::get_flat_rank_id<T>(node)].cmd_counters[T::m_cmds_counted("WR")]++;
+    node->m_spec->m_power_stats[Bank::get_flat_rank_id<T>(node)].cmd_counters[T::m_cmds_counted["WR"]]++;
   }
 
   template <class T>
   void DRAM2DB_RD(typename T::Node* node, int cmd, const AddrVec_t& addr_vec, Clk_t clk) {
     Bank::debug<T>(node, "Incrementing DRAM-to-DB RD counter.", clk);
-    node->m_spec->m_power_stats[Bank::get_flat_rank_id<T>(node)].cmd_counters[T::m_cmds_counted("DRAM2DB_RD")]++;
+    node->m_spec->m_power_stats[Bank::get_flat_rank_id<T>(node)].cmd_counters[T::m_cmds_counted["DRAM2DB_RD"]]++;
   }
 
   template <class T>
   void DB2DRAM_WR(typename T::Node* node, int cmd, const AddrVec_t& addr_vec, Clk_t clk) {
     Bank::debug<T>(node, "Incrementing DB-to-DRAM WR counter.", clk);
-    node->m_spec->m_power_stats[Bank::get_flat_rank_id<T>(node)].cmd_counters[T::m_cmds_counted("DB2DRAM_WR")]++;
+    node->m_spec->m_power_stats[Bank::get_flat_rank_id<T>(node)].cmd_counters[T::m_cmds_counted["DB2DRAM_WR"]]++;
   }  
 
   template <class T>
   void  NDP_DRAM2DB_RD(typename T::Node* node, int cmd, const AddrVec_t& addr_vec, Clk_t clk) {
     Bank::debug<T>(node, "Incrementing NDP DRAM-to-DB RD counter.", clk);
-    node->m_spec->m_power_stats[Bank::get_flat_rank_id<T>(node)].cmd_counters[T::m_cmds_counted("NDP_DRAM2DB_RD")]++;
+    node->m_spec->m_power_stats[Bank::get_flat_rank_id<T>(node)].cmd_counters[T::m_cmds_counted["NDP_DRAM2DB_RD"]]++;
   }
 
   template <class T>
   void NDP_DB2DRAM_WR(typename T::Node* node, int cmd, const AddrVec_t& addr_vec, Clk_t clk) {
     Bank::debug<T>(node, "Incrementing NDP DB-to-DRAM WR counter.", clk);
-    node->m_spec->m_power_stats[Bank::get_flat_rank_id<T>(node)].cmd_counters[T::m_cmds_counted("NDP_DB2DRAM_WR")]++;
+    node->m_spec->m_power_stats[Bank::get_flat_rank_id<T>(node)].cmd_counters[T::m_cmds_counted["NDP_DB2DRAM_WR"]]++;
   }  
 
   template <class T>
   void DB2MC_RD(typename T::Node* node, int cmd, const AddrVec_t& addr_vec, Clk_t clk) {
     Bank::debug<T>(node, "Incrementing DB-to-MC RD counter.", clk);
-    node->m_spec->m_power_stats[Bank::get_flat_rank_id<T>(node)].cmd_counters[T::m_cmds_counted("DB2MC_RD")]++;
+    node->m_spec->m_power_stats[Bank::get_flat_rank_id<T>(node)].cmd_counters[T::m_cmds_counted["DB2MC_RD"]]++;
   }  
   
   template <class T>
   void MC2DB_WR(typename T::Node* node, int cmd, const AddrVec_t& addr_vec, Clk_t clk) {
     Bank::debug<T>(node, "Incrementing MC-to-DB WR counter.", clk);
-    node->m_spec->m_power_stats[Bank::get_flat_rank_id<T>(node)].cmd_counters[T::m_cmds_counted("MC2DB_WR")]++;
+    node->m_spec->m_power_stats[Bank::get_flat_rank_id<T>(node)].cmd_counters[T::m_cmds_counted["MC2DB_WR"]]++;
   }    
 
   template <class T>
   void VRR(typename T::Node* node, int cmd, const AddrVec_t& addr_vec, Clk_t clk) {
     Bank::debug<T>(node, "Incrementing VRR counter.", clk);
-    node->m_spec->m_power_stats[Bank::get_flat_rank_id<T>(node)].cmd_counters[T::m_cmds_counted("VRR")]++;
+    node->m_spec->m_power_stats[Bank::get_flat_rank_id<T>(node)].cmd_counters[T::m_cmds_counted["VRR"]]++;
   }
 
   template <class T>
   void RVRR(typename T::Node* node, int cmd, const AddrVec_t& addr_vec, Clk_t clk) {
     Bank::debug<T>(node, "Incrementing RVRR counter.", clk);
-    node->m_spec->m_power_stats[Bank::get_flat_rank_id<T>(node)].cmd_counters[T::m_cmds_counted("RVRR")]++;
+    node->m_spec->m_power_stats[Bank::get_flat_rank_id<T>(node)].cmd_counters[T::m_cmds_counted["RVRR"]]++;
   }
   // NMA-Local commands (rank-local bus, same DRAM energy as originals)
   template <class T>
   void ACT_L(typename T::Node* node, int cmd, const AddrVec_t& addr_vec, Clk_t clk) {
     Bank::debug<T>(node, "Incrementing ACT_L counter.", clk);
-    node->m_spec->m_power_stats[Bank::get_flat_rank_id<T>(node)].cmd_counters[T::m_cmds_counted("ACT_L")]++;
+    node->m_spec->m_power_stats[Bank::get_flat_rank_id<T>(node)].cmd_counters[T::m_cmds_counted["ACT_L"]]++;
   }
 
   template <class T>
   void PRE_L(typename T::Node* node, int cmd, const AddrVec_t& addr_vec, Clk_t clk) {
     Bank::debug<T>(node, "Incrementing PRE_L counter.", clk);
-    node->m_spec->m_power_stats[Bank::get_flat_rank_id<T>(node)].cmd_counters[T::m_cmds_counted("PRE_L")]++;
+    node->m_spec->m_power_stats[Bank::get_flat_rank_id<T>(node)].cmd_counters[T::m_cmds_counted["PRE_L"]]++;
   }
 
   template <class T>
   void RD_L(typename T::Node* node, int cmd, const AddrVec_t& addr_vec, Clk_t clk) {
     Bank::debug<T>(node, "Incrementing RD_L counter.", clk);
-    node->m_spec->m_power_stats[Bank::get_flat_rank_id<T>(node)].cmd_counters[T::m_cmds_counted("RD_L")]++;
+    node->m_spec->m_power_stats[Bank::get_flat_rank_id<T>(node)].cmd_counters[T::m_cmds_counted["RD_L"]]++;
   }
 
   template <class T>
   void WR_L(typename T::Node* node, int cmd, const AddrVec_t& addr_vec, Clk_t clk) {
     Bank::debug<T>(node, "Incrementing WR_L counter.", clk);
-    node->m_spec->m_power_stats[Bank::get_flat_rank_id<T>(node)].cmd_counters[T::m_cmds_counted("WR_L")]++;
+    node->m_spec->m_power_stats[Bank::get_flat_rank_id<T>(node)].cmd_counters[T::m_cmds_counted["WR_L"]]++;
   }
 }      // namespace Bank
 
@@ -153,88 +127,60 @@ namespace Bank {
 namespace Rank {
   template <class T>
   int get_flat_rank_id(typename T::Node* node) {
-    int num_ranks = node->m_spec->get_level_size("rank");
-    int channel_id = -1;
-    int rank_id = -1;
-    if constexpr (T::m_levels["rank"] - T::m_levels["channel"] == 1) {
-      auto channel_node = node->m_parent_node;
-      rank_id = node->m_node_id;
-      channel_id = channel_node->m_node_id;
-      return channel_id * num_ranks + rank_id;
-    } else {
-      int num_pseudochannels = node->m_spec->get_level_size("pseudochannel");
-      int pseudochannel_id = -1;
-      auto wideio_node = node->m_parent_node;
-      auto narrowio_node = wideio_node->m_parent_node;
-      auto pseudochannel_node = narrowio_node->m_parent_node;
-      auto channel_node = pseudochannel_node->m_parent_node;
-      rank_id = node->m_node_id;    
-      pseudochannel_id = pseudochannel_node->m_node_id;
-      channel_id = channel_node->m_node_id;
-      return channel_id * num_ranks * num_pseudochannels + pseudochannel_id * num_ranks + rank_id;
-    }
+    return node->m_flat_rank_id;
   }
 
   template <class T>
-  void debug(typename T::Node* node, std::string msg, Clk_t clk) {
+  void debug(typename T::Node* node, std::string_view msg, Clk_t clk) {
     if (node->m_spec->m_power_debug) {
       std::cout << "[Power] Rank" << Rank::get_flat_rank_id<T>(node) << " " << msg << " @ " << clk << std::endl;
     }
   }
 
-  template <class T>
-  int get_open_bank_count(typename T::Node* node) {
-    int bank_count = 0;
-    if constexpr (T::m_levels["bank"] - T::m_levels["rank"] == 1) {
-      for (auto bank: node->m_child_nodes) {
-        if (bank->m_state == T::m_states["Opened"]) {
-          bank_count++;
-        }
-      }
-    } else if constexpr (T::m_levels["bank"] - T::m_levels["rank"] == 2) {
-      for (auto bg : node->m_child_nodes) {
-        for (auto bank: bg->m_child_nodes) {
-          if (bank->m_state == T::m_states["Opened"]) {
-              bank_count++;
-          }
-        }
-      }
-    }
-    return bank_count;
-  }
+  // The number of open and of refreshing banks of a rank (counted in one pass)
+  struct BankStateCounts {
+    int num_opened = 0;
+    int num_refreshing = 0;
+  };
 
   template <class T>
-  int get_refreshing_bank_count(typename T::Node* node) {
-    int bank_count = 0;
+  BankStateCounts count_bank_states(typename T::Node* node) {
+    BankStateCounts counts;
+    auto count_bank = [&counts](typename T::Node* bank) {
+      if (bank->m_state == T::m_states["Opened"]) {
+        counts.num_opened++;
+      } else if (bank->m_state == T::m_states["Refreshing"]) {
+        counts.num_refreshing++;
+      }
+    };
     if constexpr (T::m_levels["bank"] - T::m_levels["rank"] == 1) {
       for (auto bank: node->m_child_nodes) {
-        if (bank->m_state == T::m_states["Refreshing"]) {
-          bank_count++;
-        }
+        count_bank(bank);
       }
     } else if constexpr (T::m_levels["bank"] - T::m_levels["rank"] == 2) {
       for (auto bg : node->m_child_nodes) {
         for (auto bank: bg->m_child_nodes) {
-          if (bank->m_state == T::m_states["Refreshing"]) {
-              bank_count++;
-          }
+          count_bank(bank);
         }
       }
     }
-    return bank_count;
+    return counts;
   }
 
   template <class T>
   void ACT(typename T::Node* node, int cmd, const AddrVec_t& addr_vec, Clk_t clk) {
     Rank::debug<T>(node, "------ACT------", clk);
     auto& cur_power_stats = node->m_spec->m_power_stats[Rank::get_flat_rank_id<T>(node)];
-    bool is_rank_idle = get_open_bank_count<T>(node) == 0 && get_refreshing_bank_count<T>(node) == 0;
+    BankStateCounts banks = count_bank_states<T>(node);
+    bool is_rank_idle = banks.num_opened == 0 && banks.num_refreshing == 0;
     
     if (is_rank_idle) {
       cur_power_stats.idle_cycles += clk - cur_power_stats.idle_start_cycle;
       cur_power_stats.active_start_cycle = clk;
-      std::string msg = "Rank is idle. idle_cycles: " + std::to_string(cur_power_stats.idle_cycles) + "    active_start_cycle: " + std::to_string(cur_power_stats.active_start_cycle);
-      Rank::debug<T>(node, msg, clk);
+      if (node->m_spec->m_power_debug) {
+        std::string msg = "Rank is idle. idle_cycles: " + std::to_string(cur_power_stats.idle_cycles) + "    active_start_cycle: " + std::to_string(cur_power_stats.active_start_cycle);
+        Rank::debug<T>(node, msg, clk);
+      }
       cur_power_stats.cur_power_state = PowerStats::PowerState::ACTIVE;
     }
   }
@@ -243,13 +189,16 @@ namespace Rank {
   void PRE(typename T::Node* node, int cmd, const AddrVec_t& addr_vec, Clk_t clk) {
     Rank::debug<T>(node, "------PRE------", clk);
     auto& cur_power_stats = node->m_spec->m_power_stats[Rank::get_flat_rank_id<T>(node)];
-    bool is_rank_going_idle = get_open_bank_count<T>(node) == 1 && get_refreshing_bank_count<T>(node) == 0; // TODO: AND this PRE is targetting the active bank
+    BankStateCounts banks = count_bank_states<T>(node);
+    bool is_rank_going_idle = banks.num_opened == 1 && banks.num_refreshing == 0; // TODO: AND this PRE is targetting the active bank
 
     if (is_rank_going_idle) {
       cur_power_stats.active_cycles += clk - cur_power_stats.active_start_cycle;
       cur_power_stats.idle_start_cycle = clk;
-      std::string msg = "Rank is going idle. active_cycles: " + std::to_string(cur_power_stats.active_cycles) + "    idle_start_cycle: " + std::to_string(cur_power_stats.idle_start_cycle);
-      Rank::debug<T>(node, msg, clk);
+      if (node->m_spec->m_power_debug) {
+        std::string msg = "Rank is going idle. active_cycles: " + std::to_string(cur_power_stats.active_cycles) + "    idle_start_cycle: " + std::to_string(cur_power_stats.idle_start_cycle);
+        Rank::debug<T>(node, msg, clk);
+      }
       cur_power_stats.cur_power_state = PowerStats::PowerState::IDLE;
     }
   }
@@ -258,17 +207,20 @@ namespace Rank {
   void PREA(typename T::Node* node, int cmd, const AddrVec_t& addr_vec, Clk_t clk) {
     Rank::debug<T>(node, "------PREA------", clk);
     auto& cur_power_stats = node->m_spec->m_power_stats[Rank::get_flat_rank_id<T>(node)];
-    bool is_rank_idle = get_open_bank_count<T>(node) == 0 && get_refreshing_bank_count<T>(node) == 0;
+    BankStateCounts banks = count_bank_states<T>(node);
+    bool is_rank_idle = banks.num_opened == 0 && banks.num_refreshing == 0;
 
-    assert(get_refreshing_bank_count<T>(node) == 0 && "PREA should not be called when there are refreshing banks");
+    assert(banks.num_refreshing == 0 && "PREA should not be called when there are refreshing banks");
 
-    cur_power_stats.cmd_counters[T::m_cmds_counted("PRE")] += get_open_bank_count<T>(node);
+    cur_power_stats.cmd_counters[T::m_cmds_counted["PRE"]] += banks.num_opened;
     Rank::debug<T>(node, "Incrementing PRE counter.", clk);
     if (!is_rank_idle) {
       cur_power_stats.active_cycles += clk - cur_power_stats.active_start_cycle;
       cur_power_stats.idle_start_cycle = clk;
-      std::string msg = "Rank is not idle. active_cycles: " + std::to_string(cur_power_stats.active_cycles) + "    idle_start_cycle: " + std::to_string(cur_power_stats.idle_start_cycle);
-      Rank::debug<T>(node, msg, clk);
+      if (node->m_spec->m_power_debug) {
+        std::string msg = "Rank is not idle. active_cycles: " + std::to_string(cur_power_stats.active_cycles) + "    idle_start_cycle: " + std::to_string(cur_power_stats.idle_start_cycle);
+        Rank::debug<T>(node, msg, clk);
+      }
       cur_power_stats.cur_power_state = PowerStats::PowerState::IDLE;
     }    
   }
@@ -277,13 +229,15 @@ namespace Rank {
   void REFab(typename T::Node* node, int cmd, const AddrVec_t& addr_vec, Clk_t clk) {
     Rank::debug<T>(node, "------REFab------", clk);
     auto& cur_power_stats = node->m_spec->m_power_stats[Rank::get_flat_rank_id<T>(node)];
-    cur_power_stats.cmd_counters[T::m_cmds_counted("REF")]++;
+    cur_power_stats.cmd_counters[T::m_cmds_counted["REF"]]++;
 
     // We assume rank is idle when REF is called
 
     cur_power_stats.idle_cycles += clk - cur_power_stats.idle_start_cycle;
-    std::string msg = "Refresh starts. idle_cycles: " + std::to_string(cur_power_stats.idle_cycles);
-    Rank::debug<T>(node, msg, clk);
+    if (node->m_spec->m_power_debug) {
+      std::string msg = "Refresh starts. idle_cycles: " + std::to_string(cur_power_stats.idle_cycles);
+      Rank::debug<T>(node, msg, clk);
+    }
     cur_power_stats.cur_power_state = PowerStats::PowerState::REFRESHING;
   }
 
@@ -293,8 +247,10 @@ namespace Rank {
     auto& cur_power_stats = node->m_spec->m_power_stats[Rank::get_flat_rank_id<T>(node)];
 
     cur_power_stats.idle_start_cycle = clk;
-    std::string msg = "Refresh ends. idle_start_cycle: " + std::to_string(cur_power_stats.idle_start_cycle);
-    Rank::debug<T>(node, msg, clk);
+    if (node->m_spec->m_power_debug) {
+      std::string msg = "Refresh ends. idle_start_cycle: " + std::to_string(cur_power_stats.idle_start_cycle);
+      Rank::debug<T>(node, msg, clk);
+    }
     cur_power_stats.cur_power_state = PowerStats::PowerState::IDLE;
   }
 
@@ -302,13 +258,16 @@ namespace Rank {
   void VRR(typename T::Node* node, int cmd, const AddrVec_t& addr_vec, Clk_t clk) {
     Rank::debug<T>(node, "------VRR------", clk);
     auto& cur_power_stats = node->m_spec->m_power_stats[Rank::get_flat_rank_id<T>(node)];
-    bool is_rank_idle = get_open_bank_count<T>(node) == 0 && get_refreshing_bank_count<T>(node) == 0;
+    BankStateCounts banks = count_bank_states<T>(node);
+    bool is_rank_idle = banks.num_opened == 0 && banks.num_refreshing == 0;
 
     if (is_rank_idle) {
       cur_power_stats.idle_cycles += clk - cur_power_stats.idle_start_cycle;
       cur_power_stats.active_start_cycle = clk;
-      std::string msg = "Rank is idle. idle_cycles: " + std::to_string(cur_power_stats.idle_cycles) + "    active_start_cycle: " + std::to_string(cur_power_stats.active_start_cycle);
-      Rank::debug<T>(node, msg, clk);
+      if (node->m_spec->m_power_debug) {
+        std::string msg = "Rank is idle. idle_cycles: " + std::to_string(cur_power_stats.idle_cycles) + "    active_start_cycle: " + std::to_string(cur_power_stats.active_start_cycle);
+        Rank::debug<T>(node, msg, clk);
+      }
       cur_power_stats.cur_power_state = PowerStats::PowerState::ACTIVE;
     }
   }
@@ -317,13 +276,16 @@ namespace Rank {
   void VRR_end(typename T::Node* node, int cmd, const AddrVec_t& addr_vec, Clk_t clk) {
     Rank::debug<T>(node, "------VRR_end------", clk);
     auto& cur_power_stats = node->m_spec->m_power_stats[Rank::get_flat_rank_id<T>(node)];
-    bool is_rank_going_idle = get_open_bank_count<T>(node) == 0 && get_refreshing_bank_count<T>(node) == 1;
+    BankStateCounts banks = count_bank_states<T>(node);
+    bool is_rank_going_idle = banks.num_opened == 0 && banks.num_refreshing == 1;
 
     if (is_rank_going_idle) {
       cur_power_stats.active_cycles += clk - cur_power_stats.active_start_cycle;
       cur_power_stats.idle_start_cycle = clk;
-      std::string msg = "Rank is going idle. idle_start_cycle: " + std::to_string(cur_power_stats.idle_start_cycle) + "    active_cycles: " + std::to_string(cur_power_stats.active_cycles);
-      Rank::debug<T>(node, msg, clk);
+      if (node->m_spec->m_power_debug) {
+        std::string msg = "Rank is going idle. idle_start_cycle: " + std::to_string(cur_power_stats.idle_start_cycle) + "    active_cycles: " + std::to_string(cur_power_stats.active_cycles);
+        Rank::debug<T>(node, msg, clk);
+      }
       cur_power_stats.cur_power_state = PowerStats::PowerState::IDLE;
     }
   }
@@ -332,14 +294,17 @@ namespace Rank {
   void RFMsb(typename T::Node* node, int cmd, const AddrVec_t& addr_vec, Clk_t clk) {
     Rank::debug<T>(node, "------RFMsb------", clk);
     auto& cur_power_stats = node->m_spec->m_power_stats[Rank::get_flat_rank_id<T>(node)];
-    bool is_rank_idle = get_open_bank_count<T>(node) == 0 && get_refreshing_bank_count<T>(node) == 0;
+    BankStateCounts banks = count_bank_states<T>(node);
+    bool is_rank_idle = banks.num_opened == 0 && banks.num_refreshing == 0;
 
-    cur_power_stats.cmd_counters[T::m_cmds_counted("RFM")]++;
+    cur_power_stats.cmd_counters[T::m_cmds_counted["RFM"]]++;
     if (is_rank_idle) {
       cur_power_stats.idle_cycles += clk - cur_power_stats.idle_start_cycle;
       cur_power_stats.active_start_cycle = clk;
-      std::string msg = "Rank is idle. idle_cycles: " + std::to_string(cur_power_stats.idle_cycles) + "    active_start_cycle: " + std::to_string(cur_power_stats.active_start_cycle);
-      Rank::debug<T>(node, msg, clk);
+      if (node->m_spec->m_power_debug) {
+        std::string msg = "Rank is idle. idle_cycles: " + std::to_string(cur_power_stats.idle_cycles) + "    active_start_cycle: " + std::to_string(cur_power_stats.active_start_cycle);
+        Rank::debug<T>(node, msg, clk);
+      }
       cur_power_stats.cur_power_state = PowerStats::PowerState::ACTIVE;
     }
   }
@@ -348,14 +313,17 @@ namespace Rank {
   void RFMsb_end(typename T::Node* node, int cmd, const AddrVec_t& addr_vec, Clk_t clk) {
     Rank::debug<T>(node, "------RFMsb_end------", clk);
     auto& cur_power_stats = node->m_spec->m_power_stats[Rank::get_flat_rank_id<T>(node)];
+    BankStateCounts banks = count_bank_states<T>(node);
     size_t num_bankgroups = node->m_child_nodes.size();
-    bool is_rank_going_idle = get_open_bank_count<T>(node) == 0 && get_refreshing_bank_count<T>(node) == num_bankgroups;
+    bool is_rank_going_idle = banks.num_opened == 0 && banks.num_refreshing == num_bankgroups;
 
     if (is_rank_going_idle) {
       cur_power_stats.active_cycles += clk - cur_power_stats.active_start_cycle;
       cur_power_stats.idle_start_cycle = clk;
-      std::string msg = "Rank is going idle. idle_start_cycle: " + std::to_string(cur_power_stats.idle_start_cycle) + "    active_cycles: " + std::to_string(cur_power_stats.active_cycles);
-      Rank::debug<T>(node, msg, clk);
+      if (node->m_spec->m_power_debug) {
+        std::string msg = "Rank is going idle. idle_start_cycle: " + std::to_string(cur_power_stats.idle_start_cycle) + "    active_cycles: " + std::to_string(cur_power_stats.active_cycles);
+        Rank::debug<T>(node, msg, clk);
+      }
       cur_power_stats.cur_power_state = PowerStats::PowerState::IDLE;
     }
   }
@@ -364,14 +332,17 @@ namespace Rank {
   void RRFMsb(typename T::Node* node, int cmd, const AddrVec_t& addr_vec, Clk_t clk) {
     Rank::debug<T>(node, "------RRFMsb------", clk);
     auto& cur_power_stats = node->m_spec->m_power_stats[Rank::get_flat_rank_id<T>(node)];
-    bool is_rank_idle = get_open_bank_count<T>(node) == 0 && get_refreshing_bank_count<T>(node) == 0;
+    BankStateCounts banks = count_bank_states<T>(node);
+    bool is_rank_idle = banks.num_opened == 0 && banks.num_refreshing == 0;
 
-    cur_power_stats.cmd_counters[T::m_cmds_counted("RRFM")]++;
+    cur_power_stats.cmd_counters[T::m_cmds_counted["RRFM"]]++;
     if (is_rank_idle) {
       cur_power_stats.idle_cycles += clk - cur_power_stats.idle_start_cycle;
       cur_power_stats.active_start_cycle = clk;
-      std::string msg = "Rank is idle. idle_cycles: " + std::to_string(cur_power_stats.idle_cycles) + "    active_start_cycle: " + std::to_string(cur_power_stats.active_start_cycle);
-      Rank::debug<T>(node, msg, clk);
+      if (node->m_spec->m_power_debug) {
+        std::string msg = "Rank is idle. idle_cycles: " + std::to_string(cur_power_stats.idle_cycles) + "    active_start_cycle: " + std::to_string(cur_power_stats.active_start_cycle);
+        Rank::debug<T>(node, msg, clk);
+      }
       cur_power_stats.cur_power_state = PowerStats::PowerState::ACTIVE;
     }
   }
@@ -380,14 +351,17 @@ namespace Rank {
   void RRFMsb_end(typename T::Node* node, int cmd, const AddrVec_t& addr_vec, Clk_t clk) {
     Rank::debug<T>(node, "------RRFMsb_end------", clk);
     auto& cur_power_stats = node->m_spec->m_power_stats[Rank::get_flat_rank_id<T>(node)];
+    BankStateCounts banks = count_bank_states<T>(node);
     size_t num_bankgroups = node->m_child_nodes.size();
-    bool is_rank_going_idle = get_open_bank_count<T>(node) == 0 && get_refreshing_bank_count<T>(node) == num_bankgroups;
+    bool is_rank_going_idle = banks.num_opened == 0 && banks.num_refreshing == num_bankgroups;
 
     if (is_rank_going_idle) {
       cur_power_stats.active_cycles += clk - cur_power_stats.active_start_cycle;
       cur_power_stats.idle_start_cycle = clk;
-      std::string msg = "Rank is going idle. idle_start_cycle: " + std::to_string(cur_power_stats.idle_start_cycle) + "    active_cycles: " + std::to_string(cur_power_stats.active_cycles);
-      Rank::debug<T>(node, msg, clk);
+      if (node->m_spec->m_power_debug) {
+        std::string msg = "Rank is going idle. idle_start_cycle: " + std::to_string(cur_power_stats.idle_start_cycle) + "    active_cycles: " + std::to_string(cur_power_stats.active_cycles);
+        Rank::debug<T>(node, msg, clk);
+      }
       cur_power_stats.cur_power_state = PowerStats::PowerState::IDLE;
     }
   }
@@ -410,12 +384,14 @@ namespace Rank {
       }
     }
 
-    cur_power_stats.cmd_counters[T::m_cmds_counted("PRE")] += open_target_banks;
+    cur_power_stats.cmd_counters[T::m_cmds_counted["PRE"]] += open_target_banks;
     if (is_rank_going_idle) {
       cur_power_stats.active_cycles += clk - cur_power_stats.active_start_cycle;
       cur_power_stats.idle_start_cycle = clk;
-      std::string msg = "Rank is going idle. active_cycles: " + std::to_string(cur_power_stats.active_cycles) + "    idle_start_cycle: " + std::to_string(cur_power_stats.idle_start_cycle);
-      Bank::debug<T>(node, msg, clk);
+      if (node->m_spec->m_power_debug) {
+        std::string msg = "Rank is going idle. active_cycles: " + std::to_string(cur_power_stats.active_cycles) + "    idle_start_cycle: " + std::to_string(cur_power_stats.idle_start_cycle);
+        Bank::debug<T>(node, msg, clk);
+      }
       cur_power_stats.cur_power_state = PowerStats::PowerState::IDLE;
     }
   }
@@ -425,7 +401,8 @@ namespace Rank {
   void ACT_L(typename T::Node* node, int cmd, const AddrVec_t& addr_vec, Clk_t clk) {
     Rank::debug<T>(node, "------ACT_L------", clk);
     auto& cur_power_stats = node->m_spec->m_power_stats[Rank::get_flat_rank_id<T>(node)];
-    bool is_rank_idle = get_open_bank_count<T>(node) == 0 && get_refreshing_bank_count<T>(node) == 0;
+    BankStateCounts banks = count_bank_states<T>(node);
+    bool is_rank_idle = banks.num_opened == 0 && banks.num_refreshing == 0;
     if (is_rank_idle) {
       cur_power_stats.idle_cycles += clk - cur_power_stats.idle_start_cycle;
       cur_power_stats.active_start_cycle = clk;
@@ -437,7 +414,8 @@ namespace Rank {
   void PRE_L(typename T::Node* node, int cmd, const AddrVec_t& addr_vec, Clk_t clk) {
     Rank::debug<T>(node, "------PRE_L------", clk);
     auto& cur_power_stats = node->m_spec->m_power_stats[Rank::get_flat_rank_id<T>(node)];
-    bool is_rank_going_idle = get_open_bank_count<T>(node) == 1 && get_refreshing_bank_count<T>(node) == 0;
+    BankStateCounts banks = count_bank_states<T>(node);
+    bool is_rank_going_idle = banks.num_opened == 1 && banks.num_refreshing == 0;
     if (is_rank_going_idle) {
       cur_power_stats.active_cycles += clk - cur_power_stats.active_start_cycle;
       cur_power_stats.idle_start_cycle = clk;
@@ -449,8 +427,9 @@ namespace Rank {
   void PREA_L(typename T::Node* node, int cmd, const AddrVec_t& addr_vec, Clk_t clk) {
     Rank::debug<T>(node, "------PREA_L------", clk);
     auto& cur_power_stats = node->m_spec->m_power_stats[Rank::get_flat_rank_id<T>(node)];
-    bool is_rank_idle = get_open_bank_count<T>(node) == 0 && get_refreshing_bank_count<T>(node) == 0;
-    cur_power_stats.cmd_counters[T::m_cmds_counted("PRE_L")] += get_open_bank_count<T>(node);
+    BankStateCounts banks = count_bank_states<T>(node);
+    bool is_rank_idle = banks.num_opened == 0 && banks.num_refreshing == 0;
+    cur_power_stats.cmd_counters[T::m_cmds_counted["PRE_L"]] += banks.num_opened;
     if (!is_rank_idle) {
       cur_power_stats.active_cycles += clk - cur_power_stats.active_start_cycle;
       cur_power_stats.idle_start_cycle = clk;
@@ -462,7 +441,7 @@ namespace Rank {
   void REFab_L(typename T::Node* node, int cmd, const AddrVec_t& addr_vec, Clk_t clk) {
     Rank::debug<T>(node, "------REFab_L------", clk);
     auto& cur_power_stats = node->m_spec->m_power_stats[Rank::get_flat_rank_id<T>(node)];
-    cur_power_stats.cmd_counters[T::m_cmds_counted("REFab_L")]++;
+    cur_power_stats.cmd_counters[T::m_cmds_counted["REFab_L"]]++;
     cur_power_stats.idle_cycles += clk - cur_power_stats.idle_start_cycle;
     cur_power_stats.cur_power_state = PowerStats::PowerState::REFRESHING;
   }
@@ -478,13 +457,13 @@ namespace Rank {
   template <class T>
   void DB2MC_RD(typename T::Node* node, int cmd, const AddrVec_t& addr_vec, Clk_t clk) {
     Rank::debug<T>(node, "Incrementing DB-to-MC RD counter.", clk);
-    node->m_spec->m_power_stats[Rank::get_flat_rank_id<T>(node)].cmd_counters[T::m_cmds_counted("DB2MC_RD")]++;
+    node->m_spec->m_power_stats[Rank::get_flat_rank_id<T>(node)].cmd_counters[T::m_cmds_counted["DB2MC_RD"]]++;
   }  
   
   template <class T>
   void MC2DB_WR(typename T::Node* node, int cmd, const AddrVec_t& addr_vec, Clk_t clk) {
     Rank::debug<T>(node, "Incrementing MC-to-DB WR counter.", clk);
-    node->m_spec->m_power_stats[Rank::get_flat_rank_id<T>(node)].cmd_counters[T::m_cmds_counted("MC2DB_WR")]++;
+    node->m_spec->m_power_stats[Rank::get_flat_rank_id<T>(node)].cmd_counters[T::m_cmds_counted["MC2DB_WR"]]++;
   }    
 
 
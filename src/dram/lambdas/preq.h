@@ -12,7 +12,7 @@ int RequireRowOpen(typename T::Node* node, int cmd, const AddrVec_t& addr_vec, C
   switch (node->m_state) {
     case T::m_states["Closed"]: return T::m_commands["ACT"];
     case T::m_states["Opened"]: {
-      if (node->m_row_state.find(addr_vec[T::m_levels["row"]]) != node->m_row_state.end()) {
+      if (node->is_row_open(addr_vec[T::m_levels["row"]])) {
         return cmd;
       } else {
         return T::m_commands["PRE"];
@@ -32,7 +32,7 @@ int PCHRequireRowOpen(typename T::Node* node, int cmd, const AddrVec_t& addr_vec
   switch (node->m_state) {
     case T::m_states["Closed"]: return T::m_commands["ACT"];
     case T::m_states["Opened"]: {
-      if (node->m_row_state.find(addr_vec[T::m_levels["row"]]) != node->m_row_state.end()) {
+      if (node->is_row_open(addr_vec[T::m_levels["row"]])) {
         return cmd;
       } else {
         return T::m_commands["PRE"];
@@ -71,7 +71,7 @@ int RequireFakeRowOpen(typename T::Node* node, int cmd, const AddrVec_t& addr_ve
   switch (node->m_f_state) {
     case T::m_f_states["Closed"]: return T::m_commands["P_ACT"];
     case T::m_f_states["Opened"]: {
-      if (node->m_row_f_state.find(addr_vec[T::m_levels["row"]]) != node->m_row_f_state.end()) {
+      if (node->is_f_row_open(addr_vec[T::m_levels["row"]])) {
         return cmd;
       } else {
         return T::m_commands["P_PRE"];
@@ -1,24 +1,120 @@
 #ifndef RAMULATOR_DRAM_NODE_H
 #define RAMULATOR_DRAM_NODE_H
 
+#include <array>
 #include <vector>
+#include <algorithm>
+#include <string_view>
 #include <map>
-#include <deque>
 #include <functional>
 #include <concepts>
 
 #include "base/type.h"
+#include "base/exception.h"
 #include "dram/spec.h"
 
 namespace Ramulator {
 
 class IDRAM;
 
+/**
+ * @brief     Issue-history of a command at a node: the last `window` issue cycles in an inline ring buffer
+ * 
+ */
+class CmdHistory {
+  public:
+    static constexpr int MAX_WINDOW = 4;    // The longest window of any timing constraint (e.g., nFAW)
+
+  private:
+    std::array<Clk_t, MAX_WINDOW> m_clks;
+    int m_window = 0;
+    int m_head = 0;                         // The position of the newest entry
+
+  public:
+    void resize(int window) {
+      if (window > MAX_WINDOW) {
+        throw ConfigurationError("Timing constraint window {} is longer than the command history ({})!", window, MAX_WINDOW);
+      }
+      m_clks.fill(-1);
+      m_window = window;
+      m_head = 0;
+    };
+
+    int size() const { return m_window; };
+
+    void push(Clk_t clk) {
+      m_head = (m_head == 0 ? m_window : m_head) - 1;
+      m_clks[m_head] = clk;
+    };
+
+    // The i-th newest issue cycle (i.e., history[0] is the latest one), -1 if there is not enough history
+    Clk_t operator[](int i) const {
+      int pos = m_head + i;
+      return m_clks[pos < m_window ? pos : pos - m_window];
+    };
+
+    void serialize(Archive& ar) {
+      ar & m_clks & m_window & m_head;
+    };
+};
+
+/**
+ * @brief     A small inline set of open row ids (e.g., the open-row register of a bank)
+ * 
+ */
+template<int N>
+class OpenRowSet {
+  private:
+    std::array<int, N> m_rows;
+    int m_size = 0;
+
+  public:
+    bool empty() const { return m_size == 0; };
+
+    bool contains(int row) const {
+      for (int i = 0; i < m_size; i++) {
+        if (m_rows[i] == row) {
+          return true;
+        }
+      }
+      return false;
+    };
+
+    // Returns false if the set is full
+    bool insert(int row) {
+      if (contains(row)) {
+        return true;
+      }
+      if (m_size == N) {
+        return false;
+      }
+      m_rows[m_size++] = row;
+      return true;
+    };
+
+    void clear() { m_size = 0; };
+
+    void serialize(Archive& ar) {
+      ar & m_rows & m_size;
+    };
+};
+
+// A standard that keeps several rows per bank in the row-state maps (e.g., with its own row states) sets
+// "static constexpr bool m_multi_row_banks = true;", the others use the open-row registers of DRAMNodeBase.
+template<typename T>
+concept HasMultiRowBanks = requires { requires T::m_multi_row_banks; };
+
 template<typename T>
 concept IsDRAMSpec = requires(T t) { 
   typename T::Node; 
 };
 
+// Whether the organization hierarchy of the standard has the given level (e.g., HBM has no rank level)
+template<typename T>
+constexpr bool has_level(std::string_view level) {
+  return std::find(T::m_levels.begin(), T::m_levels.end(), level) != T::m_levels.end();
+}
+
 // CRTP class defnition is not complete, so we cannot have something nice like:
 // template<typename T>
 // concept IsDRAMSpec = std::is_base_of_v<IDRAM, T> && requires(T t) { 
@@ -41,33 +137,42 @@ struct DRAMNodeBase {
     int m_level = -1;      // The level of this node in the organization hierarchy
     int m_node_id = -1;    // The id of this node at this level
     int m_size = -1;       // The size of the node (e.g., how many rows in a bank)
+    int m_flat_rank_id = -1;  // The id of my rank among all ranks of the device (i.e., the power stats slot), if I am at or below the rank level
 
     int m_state = -1;      // The state of the node
     int m_f_state = -1;    // The state of the Fake-Node for NDP Ops
 
     std::vector<Clk_t> m_cmd_ready_clk;             // The next cycle that each command can be issued again at this level
-    std::vector<std::deque<Clk_t>> m_cmd_history;   // Issue-history of each command at this level
+    std::vector<CmdHistory> m_cmd_history;          // Issue-history of each command at this level
+
+    // The sibling timing of the commands issued to one of my children applies to all my other children, so it is
+    // kept once here instead of in every other child. Per command: the latest ready clock, the only child it does
+    // not apply to, and the latest ready clock that applies to that child (see get_sibling_ready_clk()).
+    std::vector<Clk_t> m_sibling_ready_clk;
+    std::vector<int>   m_sibling_excluded_child;
+    std::vector<Clk_t> m_sibling_excluded_ready_clk;
 
     using RowId_t = int;
     using RowState_t = int;
-    std::map<RowId_t, RowState_t> m_row_state;    // The state of the rows, if I am a bank-ish node
-    std::map<RowId_t, RowState_t> m_row_f_state;  // The state of fake-the rows, if I am a bank-ish node
+    OpenRowSet<1> m_open_rows;                    // The open row, if I am a bank-ish node
+    OpenRowSet<4> m_open_f_rows;                  // The open fake-rows, if I am a bank-ish node
+    std::map<RowId_t, RowState_t> m_row_state;    // The state of the rows that do not fit in m_open_rows (or of all rows, see HasMultiRowBanks)
+    std::map<RowId_t, RowState_t> m_row_f_state;  // The state of fake-the rows that do not fit in m_open_f_rows (or of all rows, see HasMultiRowBanks)
 
     DRAMNodeBase(T* spec, NodeType* parent, int level, int id):
     m_spec(spec), m_parent_node(parent), m_level(level), m_node_id(id) {
       int num_cmds = T::m_commands.size();
       m_cmd_ready_clk.resize(num_cmds, -1);
       m_cmd_history.resize(num_cmds);
+      m_sibling_ready_clk.resize(num_cmds, -1);
+      m_sibling_excluded_child.resize(num_cmds, -1);
+      m_sibling_excluded_ready_clk.resize(num_cmds, -1);
       for (int cmd = 0; cmd < num_cmds; cmd++) {
         int window = 0;
         for (const auto& t : spec->m_timing_cons[level][cmd]) {
           window = std::max(window, t.window);
         }
-        if (window != 0) {
-          m_cmd_history[cmd].resize(window, -1);
-        } else {
-          m_cmd_history[cmd].clear();
-        }
+        m_cmd_history[cmd].resize(window);
       }
 
       // auto current_level = T::m_levels(m_level);
@@ -75,6 +180,15 @@ struct DRAMNodeBase {
       m_state   = spec->m_init_states[m_level];
       m_f_state = spec->m_init_f_states[m_level];
 
+      if constexpr (has_level<T>("rank")) {
+        constexpr int rank_level = T::m_levels["rank"];
+        if (m_level == rank_level) {
+          m_flat_rank_id = get_flat_rank_id();
+        } else if (m_level > rank_level) {
+          m_flat_rank_id = m_parent_node->m_flat_rank_id;
+        }
+      }
+
       // Recursively construct next levels
       int next_level = level + 1;
       int last_level = T::m_levels["row"];
@@ -93,6 +207,99 @@ struct DRAMNodeBase {
       }
     };
 
+    /**
+     * @brief    Computes the flat id of this rank node: ranks are numbered per channel (and per pseudochannel, if any)
+     * @details
+     * E.g., channel * num_ranks + rank, or (channel * num_pseudochannels + pseudochannel) * num_ranks + rank.
+     * The other levels above the rank (e.g., the narrowio and wideio of DDR5-pCH) do not have their own ranks.
+     * 
+     */
+    int get_flat_rank_id() const {
+      int pseudochannel_level = -1;
+      if constexpr (has_level<T>("pseudochannel")) {
+        pseudochannel_level = T::m_levels["pseudochannel"];
+      }
+
+      int flat_id = m_node_id;
+      int stride = m_spec->m_organization.count[m_level];
+      for (const NodeType* node = m_parent_node; node != nullptr; node = node->m_parent_node) {
+        if (node->m_level == T::m_levels["channel"] || node->m_level == pseudochannel_level) {
+          flat_id += node->m_node_id * stride;
+          stride *= m_spec->m_organization.count[node->m_level];
+        }
+      }
+      return flat_id;
+    };
+
+    /**
+     * @brief    Saves/loads the states and timing information of this node and its children.
+     * 
+     */
+    void serialize(Archive& ar) {
+      ar & m_state & m_f_state;
+      ar & m_cmd_ready_clk & m_cmd_history;
+      ar & m_sibling_ready_clk & m_sibling_excluded_child & m_sibling_excluded_ready_clk;
+      ar & m_open_rows & m_open_f_rows;
+      ar & m_row_state & m_row_f_state;
+      for (auto child : m_child_nodes) {
+        child->serialize(ar);
+      }
+    };
+
+    /**
+     * @brief    Opens/closes/looks up the (fake-)rows of a bank-ish node.
+     * @details
+     * A bank holds at most one open row, so the row is kept in the open-row register. A row that does not
+     * fit spills into the row-state map, which is then also searched and cleared. Standards with
+     * HasMultiRowBanks use the maps only.
+     * 
+     */
+    void open_row(RowId_t row) {
+      if constexpr (HasMultiRowBanks<T>) {
+        m_row_state[row] = T::m_states["Opened"];
+      } else if (!m_open_rows.insert(row)) {
+        m_row_state[row] = T::m_states["Opened"];
+      }
+    };
+
+    bool is_row_open(RowId_t row) const {
+      if constexpr (HasMultiRowBanks<T>) {
+        return m_row_state.find(row) != m_row_state.end();
+      } else {
+        return m_open_rows.contains(row) || (!m_row_state.empty() && m_row_state.find(row) != m_row_state.end());
+      }
+    };
+
+    void close_rows() {
+      m_open_rows.clear();
+      if (!m_row_state.empty()) {
+        m_row_state.clear();
+      }
+    };
+
+    void open_f_row(RowId_t row) {
+      if constexpr (HasMultiRowBanks<T>) {
+        m_row_f_state[row] = T::m_f_states["Opened"];
+      } else if (!m_open_f_rows.insert(row)) {
+        m_row_f_state[row] = T::m_f_states["Opened"];
+      }
+    };
+
+    bool is_f_row_open(RowId_t row) const {
+      if constexpr (HasMultiRowBanks<T>) {
+        return m_row_f_state.find(row) != m_row_f_state.end();
+      } else {
+        return m_open_f_rows.contains(row) || (!m_row_f_state.empty() && m_row_f_state.find(row) != m_row_f_state.end());
+      }
+    };
+
+    void close_f_rows() {
+      m_open_f_rows.clear();
+      if (!m_row_f_state.empty()) {
+        m_row_f_state.clear();
+      }
+    };
+
     void update_states(int command, const AddrVec_t& addr_vec, Clk_t clk) {
       int child_id = addr_vec[m_level+1];
       if (m_spec->m_actions[m_level][command]) {
@@ -136,32 +343,34 @@ struct DRAMNodeBase {
       }
     };
 
-    void update_timing(int command, const AddrVec_t& addr_vec, Clk_t clk) {
-      /************************************************
-       *         Update Sibling Node Timing
-       ***********************************************/
-      if (m_node_id != addr_vec[m_level] && addr_vec[m_level] != -1) {
-        for (const auto& t : m_spec->m_timing_cons[m_level][command]) {
-          if (!t.sibling) {
-            // not sibling timing parameter
-            continue; 
-          }
+    /**
+     * @brief    Returns the ready clock of the command from the sibling timing of my children, for the given child.
+     * 
+     */
+    Clk_t get_sibling_ready_clk(int child_id, int command) const {
+      return child_id != m_sibling_excluded_child[command] ? m_sibling_ready_clk[command] : m_sibling_excluded_ready_clk[command];
+    };
 
-          // update earliest schedulable time of every command
-          Clk_t future = clk + t.val;
-          m_cmd_ready_clk[t.cmd] = std::max(m_cmd_ready_clk[t.cmd], future); 
-        }
-        // stop recursion
-        return;
+    /**
+     * @brief    Returns the next cycle that the command can be issued again at this level (my own and the sibling timing).
+     * 
+     */
+    Clk_t get_cmd_ready_clk(int command) const {
+      Clk_t ready_clk = m_cmd_ready_clk[command];
+      if (m_parent_node) {
+        ready_clk = std::max(ready_clk, m_parent_node->get_sibling_ready_clk(m_node_id, command));
       }
+      return ready_clk;
+    };
 
+    void update_timing(int command, const AddrVec_t& addr_vec, Clk_t clk) {
       /************************************************
        *          Update Target Node Timing
        ***********************************************/
       // Update history
-      if (m_cmd_history[command].size()) {
-        m_cmd_history[command].pop_back();
-        m_cmd_history[command].push_front(clk); 
+      CmdHistory& history = m_cmd_history[command];
+      if (history.size()) {
+        history.push(clk);
       }
 
       for (const auto& t : m_spec->m_timing_cons[m_level][command]) {
@@ -170,7 +379,7 @@ struct DRAMNodeBase {
         }
 
         // Get the oldest history
-        Clk_t past = m_cmd_history[command][t.window-1];
+        Clk_t past = history[t.window-1];
         if (past < 0) {
           // not enough history
           continue; 
@@ -186,10 +395,40 @@ struct DRAMNodeBase {
         return; 
       }
 
-      // recursively update all of my children
-      for (auto child : m_child_nodes) {
-        child->update_timing(command, addr_vec, clk);
+      int child_id = addr_vec[m_level+1];
+      if (child_id == -1) {
+        // all of my children are targets
+        for (auto child : m_child_nodes) {
+          child->update_timing(command, addr_vec, clk);
+        }
+        return;
       }
+
+      /************************************************
+       *         Update Sibling Node Timing
+       ***********************************************/
+      for (const auto& t : m_spec->m_timing_cons[m_level+1][command]) {
+        if (!t.sibling) {
+          // not sibling timing parameter
+          continue; 
+        }
+
+        // update earliest schedulable time of every command at all children but the target one
+        Clk_t future = clk + t.val;
+        if (child_id == m_sibling_excluded_child[t.cmd]) {
+          m_sibling_ready_clk[t.cmd] = std::max(m_sibling_ready_clk[t.cmd], future);
+        } else if (future > m_sibling_ready_clk[t.cmd]) {
+          // the previous latest clock applies to the new excluded child
+          m_sibling_excluded_ready_clk[t.cmd] = m_sibling_ready_clk[t.cmd];
+          m_sibling_ready_clk[t.cmd] = future;
+          m_sibling_excluded_child[t.cmd] = child_id;
+        } else {
+          m_sibling_excluded_ready_clk[t.cmd] = std::max(m_sibling_excluded_ready_clk[t.cmd], future);
+        }
+      }
+
+      // recursively update the target child
+      m_child_nodes[child_id]->update_timing(command, addr_vec, clk);
     };
 
     int get_preq_command(int command, const AddrVec_t& addr_vec, Clk_t m_clk) {
@@ -216,7 +455,8 @@ struct DRAMNodeBase {
     };
 
     bool check_ready(int command, const AddrVec_t& addr_vec, Clk_t clk) {
-      if (m_cmd_ready_clk[command] != -1 && clk < m_cmd_ready_clk[command]) {
+      Clk_t ready_clk = get_cmd_ready_clk(command);
+      if (ready_clk != -1 && clk < ready_clk) {
         // stop recursion: the check failed at this level
         return false; 
       }
@@ -240,6 +480,26 @@ struct DRAMNodeBase {
       }
     };
 
+    Clk_t get_ready_clk(int command, const AddrVec_t& addr_vec) {
+      Clk_t ready_clk = get_cmd_ready_clk(command);
+
+      int child_id = addr_vec[m_level+1];
+      if (m_level == m_spec->m_command_scopes[command] || !m_child_nodes.size()) {
+        // stop recursion: reached the scope of the command
+        return ready_clk;
+      }
+
+      if (child_id == -1) {
+        // if it is a same bank command, the latest of all children in rank level
+        for (auto child : m_child_nodes) {
+          ready_clk = std::max(ready_clk, child->get_ready_clk(command, addr_vec));
+        }
+        return ready_clk;
+      } else {
+        return std::max(ready_clk, m_child_nodes[child_id]->get_ready_clk(command, addr_vec));
+      }
+    };
+
     bool check_rowbuffer_hit(int command, const AddrVec_t& addr_vec, Clk_t m_clk) {
       // TODO: Optimize this by just checking the bank-levels? Have a dedicated bank structure?
       int child_id = addr_vec[m_level+1];
@@ -279,7 +539,7 @@ struct DRAMNodeBase {
       std::cout<<"====== Node Level ["<<T::m_levels(m_level)<<"] ID ["<<m_node_id<<"]======"<<std::endl;
 
       for(int i=0;i<m_cmd_ready_clk.size();i++) {
-        std::cout<<"["<< T::m_commands(i)<<"] next issueabled cycle :"<<m_cmd_ready_clk[i]<<std::endl;
+        std::cout<<"["<< T::m_commands(i)<<"] next issueabled cycle :"<<get_cmd_ready_clk(i)<<std::endl;
       }
 
 
@@ -295,25 +555,44 @@ struct DRAMNodeBase {
     };    
 };
 
+// The lambdas are plain function pointers (i.e., captureless lambdas or function templates), so a call
+// is a single indirect jump instead of going through std::function. They can reach the device via node->m_spec.
 template<class T>
-using ActionFunc_t = std::function<void(typename T::Node* node, int cmd, int target_id, Clk_t clk)>;
+using ActionFunc_t = void (*)(typename T::Node* node, int cmd, int target_id, Clk_t clk);
 template<class T>
-using PreqFunc_t   = std::function<int (typename T::Node* node, int cmd, const AddrVec_t& addr_vec, Clk_t clk)>;
+using PreqFunc_t   = int  (*)(typename T::Node* node, int cmd, const AddrVec_t& addr_vec, Clk_t clk);
 template<class T>
-using RowhitFunc_t = std::function<bool(typename T::Node* node, int cmd, int target_id, Clk_t clk)>;
+using RowhitFunc_t = bool (*)(typename T::Node* node, int cmd, int target_id, Clk_t clk);
 template<class T>
-using RowopenFunc_t = std::function<bool(typename T::Node* node, int cmd, int target_id, Clk_t clk)>;
+using RowopenFunc_t = bool (*)(typename T::Node* node, int cmd, int target_id, Clk_t clk);
 template<class T>
-using PowerFunc_t = std::function<void(typename T::Node* node, int cmd, const AddrVec_t& addr_vec, Clk_t clk)>;
+using PowerFunc_t = void (*)(typename T::Node* node, int cmd, const AddrVec_t& addr_vec, Clk_t clk);
 
+/**
+ * @brief     A (level x command) table of lambdas in one contiguous array, looked up as matrix[level][command]
+ * 
+ */
 template<typename T>
-using FuncMatrix = std::vector<std::vector<T>>;
+class FuncMatrix {
+  private:
+    size_t m_num_commands = 0;
+    std::vector<T> m_funcs;
+
+  public:
+    // Every level starts as a copy of level_funcs (usually all nullptr)
+    void resize(size_t num_levels, const std::vector<T>& level_funcs) {
+      m_num_commands = level_funcs.size();
+      m_funcs.clear();
+      for (size_t level = 0; level < num_levels; level++) {
+        m_funcs.insert(m_funcs.end(), level_funcs.begin(), level_funcs.end());
+      }
+    };
 
-// TODO: Enable easy syntax for FuncMatrix lookup
-// template<typename T, int N, int M>
-// class FuncMatrix : public std::array<std::array<T, M>, N> {
+    size_t size() const { return m_num_commands ? m_funcs.size() / m_num_commands : 0; };
 
-// };
+    T* operator[](int level) { return m_funcs.data() + level * m_num_commands; };
+    const T* operator[](int level) const { return m_funcs.data() + level * m_num_commands; };
+};
 
 }        // namespace Ramulator
 
@@ -11,6 +11,8 @@
 
 #include <spdlog/spdlog.h>
 
+#include "base/serialization.h"
+
 namespace Ramulator {
 
 using Level_t = int;
@@ -41,6 +43,8 @@ struct FutureAction {
   Command_t cmd;
   AddrVec_t addr_vec;
   Clk_t clk;
+
+  void serialize(Archive& ar) { ar & cmd & addr_vec & clk; };
 };
 
 // Timing Constraint
@@ -319,9 +323,40 @@ struct PowerStats {
 
     Clk_t active_start_cycle = -1; // initially rank is not active
     Clk_t idle_start_cycle = 0;
-    
+
+    // The active/idle cycles up to the given cycle, including the interval the rank is currently in
+    Clk_t get_active_cycles(Clk_t clk) const {
+      return cur_power_state == PowerState::ACTIVE ? active_cycles + (clk - active_start_cycle) : active_cycles;
+    };
+    Clk_t get_idle_cycles(Clk_t clk) const {
+      return cur_power_state == PowerState::IDLE ? idle_cycles + (clk - idle_start_cycle) : idle_cycles;
+    };
+
+    void serialize(Archive& ar) {
+      ar & rank_id & cur_power_state;
+      ar & act_background_energy & pre_background_energy;
+      ar & total_background_energy & total_cmd_energy & total_energy;
+      ar & cmd_counters;
+      ar & active_cycles & idle_cycles & active_start_cycle & idle_start_cycle;
+    };
 };        
 
+/**
+ * @brief    The energy (nJ) of a rank (or of one of its devices) over some cycles: the background energy
+ *           with open banks and with all banks precharged, and the energy of each command class
+ */
+struct RankEnergy {
+  double act_background = 0;
+  double pre_background = 0;
+
+  double act = 0;
+  double pre = 0;
+  double rd  = 0;
+  double wr  = 0;
+  double ref = 0;
+  double rfm = 0;
+};
+
 }// namespace Ramulator
 
 #endif   // RAMULATOR_DEVICE_DEVICE_H
@@ -0,0 +1,118 @@
+#ifndef RAMULATOR_DRAM_SPEC_IDS_H
+#define RAMULATOR_DRAM_SPEC_IDS_H
+
+#include <string_view>
+#include <limits>
+
+#include "base/exception.h"
+#include "dram/spec.h"
+
+namespace Ramulator {
+
+// The names used outside of the standards (i.e., by the controllers, the memory systems, and the address mappers)
+#define RAMULATOR_SPEC_COMMAND_IDS(X) \
+  X(ACT) X(PRE) X(PREA) X(PREsb) X(RD) X(WR) X(RDA) X(WRA) \
+  X(REFab) X(REFab_end) X(REFsb) X(REFsb_end) X(RFMab) X(RFMsb) \
+  X(P_ACT) X(P_PRE) X(PRE_RD) X(PRE_RDA) X(PRE_WR) X(POST_RD) X(POST_WR) X(POST_WRA) \
+  X(NDP_DB_RD) X(NDP_DB_WR) X(NDP_DRAM_RD) X(NDP_DRAM_RDA) X(NDP_DRAM_WR) X(NDP_DRAM_WRA) \
+  X(ACT_L) X(PRE_L) X(PREA_L) X(RD_L) X(WR_L) X(REFab_L) \
+  X(ACTO) X(PREO) X(RDO) X(WRO) X(REFO)
+
+#define RAMULATOR_SPEC_LEVEL_IDS(X) \
+  X(channel) X(pseudochannel) X(rank) X(bankgroup) X(bank) X(row) X(column)
+
+#define RAMULATOR_SPEC_TIMING_IDS(X) \
+  X(rate) X(tCK_ps) X(nBL) X(nCL) X(nCWL) X(nRP) X(nREFI) X(nRFC1) X(nRFCsb)
+
+// Request names are not identifiers, so each one comes with the name of its id
+#define RAMULATOR_SPEC_REQUEST_IDS(X) \
+  X(read, "read") X(write, "write") \
+  X(all_bank_refresh, "all-bank-refresh") X(close_row, "close-row") X(close_all_bank, "close-all-bank") \
+  X(rfm, "rfm") X(victim_row_refresh, "victim-row-refresh") \
+  X(ndp_db_read, "ndp-db-read") X(ndp_db_write, "ndp-db-write") X(ndp_dram_read, "ndp-dram-read") X(ndp_dram_write, "ndp-dram-write")
+
+/**
+ * @brief     The id of a command, level, timing, or request (MISSING if the standard does not define it)
+ *
+ * @details
+ * Converts to the id, so optional names (e.g., RFMab or the NDP commands) can simply be compared against.
+ * MISSING is not -1, so a missing id never equals an unset command or type (e.g., Request::command).
+ * Code that cannot do without the name uses required() instead, which throws if the standard does not define it.
+ *
+ */
+struct SpecId {
+  static constexpr int MISSING = std::numeric_limits<int>::min();
+
+  int id = MISSING;
+  const char* kind;
+  const char* name;
+
+  operator int() const { return id; };
+
+  bool exists() const { return id != MISSING; };
+
+  int required() const {
+    if (!exists()) {
+      throw ConfigurationError("The DRAM standard does not define the {} {}!", kind, name);
+    }
+    return id;
+  };
+};
+
+/**
+ * @brief     The ids of the commands, levels, timings, and requests used outside of the standards
+ *
+ * @details
+ * Resolved once from the definitions of the standard when it declares its specs, so e.g. m_ids.cmd.RD
+ * replaces a lookup of m_commands("RD") by name.
+ *
+ */
+struct SpecIds {
+  struct Commands {
+    #define RAMULATOR_SPEC_ID(name) SpecId name{SpecId::MISSING, "command", #name};
+    RAMULATOR_SPEC_COMMAND_IDS(RAMULATOR_SPEC_ID)
+    #undef RAMULATOR_SPEC_ID
+  } cmd;
+
+  struct Levels {
+    #define RAMULATOR_SPEC_ID(name) SpecId name{SpecId::MISSING, "level", #name};
+    RAMULATOR_SPEC_LEVEL_IDS(RAMULATOR_SPEC_ID)
+    #undef RAMULATOR_SPEC_ID
+  } level;
+
+  struct Timings {
+    #define RAMULATOR_SPEC_ID(name) SpecId name{SpecId::MISSING, "timing", #name};
+    RAMULATOR_SPEC_TIMING_IDS(RAMULATOR_SPEC_ID)
+    #undef RAMULATOR_SPEC_ID
+  } timing;
+
+  struct Requests {
+    #define RAMULATOR_SPEC_ID(name, str) SpecId name{SpecId::MISSING, "request", str};
+    RAMULATOR_SPEC_REQUEST_IDS(RAMULATOR_SPEC_ID)
+    #undef RAMULATOR_SPEC_ID
+  } req;
+
+  void resolve(const SpecDef& commands, const SpecDef& levels, const SpecDef& timings, const SpecDef& requests) {
+    #define RAMULATOR_SPEC_ID(name) cmd.name.id = find(commands, #name);
+    RAMULATOR_SPEC_COMMAND_IDS(RAMULATOR_SPEC_ID)
+    #undef RAMULATOR_SPEC_ID
+    #define RAMULATOR_SPEC_ID(name) level.name.id = find(levels, #name);
+    RAMULATOR_SPEC_LEVEL_IDS(RAMULATOR_SPEC_ID)
+    #undef RAMULATOR_SPEC_ID
+    #define RAMULATOR_SPEC_ID(name) timing.name.id = find(timings, #name);
+    RAMULATOR_SPEC_TIMING_IDS(RAMULATOR_SPEC_ID)
+    #undef RAMULATOR_SPEC_ID
+    #define RAMULATOR_SPEC_ID(name, str) req.name.id = find(requests, str);
+    RAMULATOR_SPEC_REQUEST_IDS(RAMULATOR_SPEC_ID)
+    #undef RAMULATOR_SPEC_ID
+  };
+
+  private:
+    static int find(const SpecDef& def, std::string_view name) {
+      return def.contains(name) ? def(name) : SpecId::MISSING;
+    };
+};
+
+}        // namespace Ramulator
+
+#endif   // RAMULATOR_DRAM_SPEC_IDS_H
@@ -28,6 +28,11 @@ class IDRAMController : public Clocked<IDRAMController> {
     std::vector<IControllerPlugin*> m_plugins;
 
     int m_channel_id = -1;
+
+  protected:
+    bool m_defer_callbacks = false;         // Whether the callbacks of completed requests are deferred
+    std::vector<Request> m_deferred_reqs;   // Completed requests whose callbacks are not called yet
+
   public:
     /**
      * @brief       Send a request to the memory controller.
@@ -44,12 +49,42 @@ class IDRAMController : public Clocked<IDRAMController> {
      */
     virtual bool priority_send(Request& req) = 0;
 
+    /**
+     * @brief       Applies the state changes of the request to the device, without timing.
+     * 
+     */
+    virtual void functional_access(Request& req) {
+      throw ConfigurationError("Controller {} does not support functional accesses!", m_impl->get_name());
+    };
+
+    /**
+     * @brief       Throws a ConfigurationError if the controller or any of its plugins does not support functional accesses.
+     * 
+     */
+    virtual void check_functional_access() {
+      throw ConfigurationError("Controller {} does not support functional accesses!", m_impl->get_name());
+    };
+
     /**
      * @brief       Ticks the memory controller.
      * 
      */
     virtual void tick() = 0;
 
+    /**
+     * @brief       Returns the earliest cycle at which tick() may change any state.
+     * @details
+     * Any cycle that is not after the current one (e.g., the default 0) disables idle skipping.
+     * 
+     */
+    virtual Clk_t get_next_event_clk() { return 0; };
+
+    /**
+     * @brief       Advances the controller to the given cycle as if all ticks in between were idle.
+     * 
+     */
+    virtual void fast_forward(Clk_t clk) {};
+
     virtual bool is_finished() = 0; // Check Only All RDs are Done
     virtual bool is_abs_finished() = 0; // check RD/WR are Done
     virtual bool is_empty_ndp_req() = 0;
@@ -60,9 +95,44 @@ class IDRAMController : public Clocked<IDRAMController> {
     virtual uint64_t get_req_latency() = 0;
     virtual uint64_t get_iss_counter() { return 0; }
     virtual uint64_t get_rec_counter() { return 0; }
+    // Row hits and all row-hit/miss/conflict classified requests so far (e.g., for convergence detection)
+    virtual uint64_t get_row_hit_counter() { return 0; }
+    virtual uint64_t get_row_access_counter() { return 0; }
 
     // Notify controller of HSNC segment boundary (for per-segment NDP CAS analysis)
     virtual void notify_segment_boundary(int pch_idx, int seg_id) {}
+
+    /**
+     * @brief       Defers the callbacks of completed requests until run_deferred_callbacks() is called.
+     * @details
+     * Used when the channels are ticked in parallel: the callbacks touch the frontend or the memory
+     * system, so they are called afterwards from the simulation thread. Replaying channel 0's callbacks
+     * (in completion order), then channel 1's, and so on gives the same order as a serial tick. The only
+     * difference is that they run after every channel has ticked, so a callback must not send new
+     * requests (the memory system rejects this while replaying).
+     * 
+     */
+    void set_defer_callbacks(bool defer) { m_defer_callbacks = defer; };
+
+    void run_deferred_callbacks() {
+      for (auto& req : m_deferred_reqs) {
+        req.callback(req);
+      }
+      m_deferred_reqs.clear();
+    };
+
+  protected:
+    /**
+     * @brief       Calls (or defers) the callback of a completed request.
+     * 
+     */
+    void complete_request(Request& req) {
+      if (m_defer_callbacks) {
+        m_deferred_reqs.push_back(req);
+      } else {
+        req.callback(req);
+      }
+    };
 };
 
 }       // namespace Ramulator
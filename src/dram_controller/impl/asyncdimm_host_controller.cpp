@@ -20,6 +20,7 @@ class AsyncDIMMHostController final : public IDRAMController, public Implementat
     ReqBuffer m_priority_buffer;          // Buffer for high-priority requests (refresh)
     ReqBuffer m_read_buffer;
     ReqBuffer m_write_buffer;
+    ReqNodePool m_req_nodes;              // The nodes of the removed requests, reused by all buffers of this controller
 
     std::vector<ReqBuffer> m_read_buffers;        // Per-rank read buffers
     std::vector<ReqBuffer> m_write_buffers;       // Per-rank write buffers
@@ -255,6 +256,10 @@ class AsyncDIMMHostController final : public IDRAMController, public Implementat
       int cmd_count;         // Total offloaded commands (1/2/3) for OT decrement
       int bank_flat_id;      // Target bank for OT decrement
       bool is_read;
+
+      void serialize(Archive& ar) {
+        ar & req & cmd_count & bank_flat_id & is_read;
+      }
     };
     std::deque<ReturnUnitEntry> m_return_unit;    // Global RU (all ranks, in offload order)
     static constexpr int RU_MAX_ENTRIES = 128;
@@ -308,7 +313,7 @@ class AsyncDIMMHostController final : public IDRAMController, public Implementat
       // Count RU entries for this rank
       int ru_for_rank = 0;
       for (auto& e : m_return_unit)
-        if (e.req.addr_vec[m_dram->m_levels("rank")] == rank_id) ru_for_rank++;
+        if (e.req.addr_vec[m_dram->m_ids.level.rank.required()] == rank_id) ru_for_rank++;
 
       char buf[256];
       snprintf(buf, sizeof(buf),
@@ -358,8 +363,8 @@ class AsyncDIMMHostController final : public IDRAMController, public Implementat
 
     void setup(IFrontEnd* frontend, IMemorySystem* memory_system) override {
       m_dram = memory_system->get_ifce<IDRAM>();
-      m_bank_addr_idx = m_dram->m_levels("bank");
-      m_rank_addr_idx = m_dram->m_levels("rank");
+      m_bank_addr_idx = m_dram->m_ids.level.bank.required();
+      m_rank_addr_idx = m_dram->m_ids.level.rank.required();
       m_priority_buffer.max_size = 512 * 3 + 32;
       m_active_buffer.max_size = 32 * 4;
       m_write_buffer.max_size = 128;
@@ -368,10 +373,10 @@ class AsyncDIMMHostController final : public IDRAMController, public Implementat
       num_ranks = m_dram->get_level_size("rank");
       num_bankgroups = m_dram->get_level_size("bankgroup");
       num_banks = m_dram->get_level_size("bank");
-      rank_idx = m_dram->m_levels("rank");
-      bankgroup_idx = m_dram->m_levels("bankgroup");
-      bank_idx = m_dram->m_levels("bank");
-      row_idx = m_dram->m_levels("row");
+      rank_idx = m_dram->m_ids.level.rank.required();
+      bankgroup_idx = m_dram->m_ids.level.bankgroup.required();
+      bank_idx = m_dram->m_ids.level.bank.required();
+      row_idx = m_dram->m_ids.level.row.required();
 
       m_num_cores = frontend->get_num_cores();
 
@@ -436,6 +441,14 @@ class AsyncDIMMHostController final : public IDRAMController, public Implementat
         rr_rk_idx.push_back(i);
         register_stat(s_num_refresh_cc_per_rank[i]).name("s_num_refresh_cc_per_rank_{}_{}", m_channel_id, i);
       }
+      for (ReqBuffer* buffer : {&m_active_buffer, &m_priority_buffer, &m_read_buffer, &m_write_buffer}) {
+        buffer->set_node_pool(&m_req_nodes);
+      }
+      for (auto* buffers : {&m_read_buffers, &m_write_buffers, &m_priority_buffers}) {
+        for (ReqBuffer& buffer : *buffers) {
+          buffer.set_node_pool(&m_req_nodes);
+        }
+      }
 
 
       // Initialize per-rank mode register (Host Mode only in Phase 1)
@@ -450,9 +463,9 @@ class AsyncDIMMHostController final : public IDRAMController, public Implementat
       m_nma_start_hold.resize(num_ranks, std::nullopt);
       m_nma_start_in_flight.resize(num_ranks, false);
       m_conc_enter_clk.resize(num_ranks, 0);
-      m_nma_row_idx = m_dram->m_levels("row");
-      m_nma_bg_idx  = m_dram->m_levels("bankgroup");
-      m_nma_bk_idx  = m_dram->m_levels("bank");
+      m_nma_row_idx = m_dram->m_ids.level.row.required();
+      m_nma_bg_idx  = m_dram->m_ids.level.bankgroup.required();
+      m_nma_bk_idx  = m_dram->m_ids.level.bank.required();
 
       // Phase 3: OT counter and Return Unit
       m_total_banks_flat = num_ranks * num_bankgroups * num_banks;
@@ -478,6 +491,27 @@ class AsyncDIMMHostController final : public IDRAMController, public Implementat
       m_open_row_miss.resize(num_ranks * num_bankgroups * num_banks, false);
     };
 
+    void serialize(Archive& ar) override {
+      ar & m_clk & pending;
+      ar & m_active_buffer & m_priority_buffer & m_read_buffer & m_write_buffer;
+      ar & m_read_buffers & m_write_buffers & m_priority_buffers;
+      ar & m_is_write_mode_per_rank & is_empty_priority_per_rank & rr_rk_idx & m_mode_per_rank;
+      ar & s_offload_per_bank & s_ot_total_inc & s_ot_total_dec;
+      ar & m_debug_track_events & m_debug_host_ru_log & m_bank_cmd_rings;
+      ar & s_ru_cmd_count_hist & s_interrupt_count & s_ot_dec_hist & s_ru_pop_log & s_offload_cmd_log;
+      ar & m_offload_stopped & m_c2h_draining;
+      ar & m_rt_track_window_issues & m_rt_track_window_pending & m_rt_track_window_start;
+      ar & m_host_access_cnt & m_tcore_host_access_cnt;
+      ar & m_host_acceess_rec_counter & m_host_acceess_iss_counter;
+      ar & m_host_rd_acceess_rec_counter & m_host_rd_acceess_iss_counter;
+      ar & m_bw_host_nma_bypass & m_bw_host_nma_offload & m_bw_tcore_host_nma_bypass & m_bw_tcore_host_nma_offload;
+      ar & m_open_row & m_pre_open_row & m_open_row_miss;
+      ar & m_lat_vec;
+      ar & m_nma_wr_send_cnt & m_nma_wr_pending_rank & m_nma_wr_issue_cnt;
+      ar & m_nma_start_requested & m_nma_start_hold & m_nma_start_in_flight & m_conc_enter_clk;
+      ar & m_ot_counter & m_return_unit & m_rt_pending_count & m_rt_read_pending;
+    };
+
     // ===== Public API for AsyncDIMM Memory System =====
 
     // Set bypass callback (called by asyncdimm_system to wire NMA MC)
@@ -592,7 +626,7 @@ class AsyncDIMMHostController final : public IDRAMController, public Implementat
           }
           if (it->is_read) {
             it->req.depart = m_clk + m_dram->m_read_latency;
-            pending.push_back(it->req);
+            pending.push_back(std::move(it->req));
           } else {
             if (it->req.is_host_req) m_host_acceess_rec_counter++;
           }
@@ -606,7 +640,7 @@ class AsyncDIMMHostController final : public IDRAMController, public Implementat
         while (!m_rt_read_pending[rank_id].empty()) {
           auto& req = m_rt_read_pending[rank_id].front();
           req.depart = m_clk + m_dram->m_read_latency;
-          pending.push_back(req);
+          pending.push_back(std::move(req));
           m_rt_read_pending[rank_id].pop_front();
         }
         m_rt_pending_count[rank_id] = 0;
@@ -653,7 +687,7 @@ class AsyncDIMMHostController final : public IDRAMController, public Implementat
           s_offload_per_bank[it->bank_flat_id].ot_dec += cc;
           if (it->bank_flat_id == m_debug_track_bank_flat) {
             m_debug_track_events.push_back({(long)m_clk, 4/*OT_DEC*/, m_ot_counter[it->bank_flat_id],
-              it->req.addr_vec[m_dram->m_levels("row")]});
+              it->req.addr_vec[m_dram->m_ids.level.row.required()]});
           }
         }
 
@@ -806,8 +840,8 @@ class AsyncDIMMHostController final : public IDRAMController, public Implementat
       // Only REF (REFab/REFsb) is allowed through; cap PRE would become stuck as PREO
       // after mode transition since PREO doesn't consume the request from priority buffer.
       if (rank_id >= 0 && rank_id < m_num_rank && m_nma_start_in_flight[rank_id]) {
-        bool is_ref = (req.final_command == m_dram->m_commands("REFab") ||
-                       req.final_command == m_dram->m_commands("REFsb"));
+        bool is_ref = (req.final_command == m_dram->m_ids.cmd.REFab ||
+                       req.final_command == m_dram->m_ids.cmd.REFsb);
         if (!is_ref) return true;  // Silently drop cap PRE
       }
 
@@ -818,6 +852,7 @@ class AsyncDIMMHostController final : public IDRAMController, public Implementat
     }
 
     void tick() override {
+      RAMULATOR_PROFILE_SCOPE();
       m_clk++;
 
       // Update queue length statistics
@@ -834,7 +869,7 @@ class AsyncDIMMHostController final : public IDRAMController, public Implementat
         if (m_nma_start_hold[rk_id].has_value() &&
             m_nma_wr_send_cnt[rk_id] == m_nma_wr_issue_cnt[rk_id]) {
           auto& held_req = m_nma_start_hold[rk_id].value();
-          if (m_write_buffers[rk_id].enqueue(held_req)) {
+          if (m_write_buffers[rk_id].enqueue(std::move(held_req))) {
             m_nma_start_hold[rk_id] = std::nullopt;
             m_nma_start_in_flight[rk_id] = true;
           }
@@ -875,12 +910,12 @@ class AsyncDIMMHostController final : public IDRAMController, public Implementat
         int batch = std::min(m_rt_pending_count[rk], 8);  // Max batch = 8
         int rt_cmd = m_rt_cmds[batch];
         AddrVec_t rt_addr(m_dram->m_levels.size(), -1);
-        rt_addr[m_dram->m_levels("channel")] = m_channel_id;
-        rt_addr[m_dram->m_levels("rank")]    = rk;
+        rt_addr[m_dram->m_ids.level.channel.required()] = m_channel_id;
+        rt_addr[m_dram->m_ids.level.rank.required()]    = rk;
         if (m_dram->check_ready(rt_cmd, rt_addr)) {
           m_dram->issue_command(rt_cmd, rt_addr);  // 1 command, DQ = batch × nBL
-          int nBL = m_dram->m_timing_vals("nBL");
-          int nCL = m_dram->m_timing_vals("nCL");
+          int nBL = m_dram->m_timing_vals(m_dram->m_ids.timing.nBL.required());
+          int nCL = m_dram->m_timing_vals(m_dram->m_ids.timing.nCL.required());
           for (int i = 0; i < batch && !m_rt_read_pending[rk].empty(); i++) {
             auto& req = m_rt_read_pending[rk].front();
             req.depart = m_clk + nCL + i * nBL;
@@ -970,7 +1005,7 @@ class AsyncDIMMHostController final : public IDRAMController, public Implementat
         if (request_found && req_rank >= 0 && req_rank < m_num_rank &&
             m_mode_per_rank[req_rank] == AsyncDIMMMode::NMA) {
           int cmd = req_it->command;
-          if (cmd != m_dram->m_commands("REFO"))
+          if (cmd != m_dram->m_ids.cmd.REFO)
             request_found = false;
         }
       }
@@ -984,9 +1019,9 @@ class AsyncDIMMHostController final : public IDRAMController, public Implementat
         int flat_bank_id = req_it->addr_vec[bank_idx]
                          + req_it->addr_vec[bankgroup_idx] * num_banks
                          + req_it->addr_vec[rank_idx] * num_bankgroups * num_banks;
-        bool is_offload = (cmd == m_dram->m_commands("ACTO") || cmd == m_dram->m_commands("PREO") ||
-                           cmd == m_dram->m_commands("RDO")  || cmd == m_dram->m_commands("WRO")  ||
-                           cmd == m_dram->m_commands("REFO"));
+        bool is_offload = (cmd == m_dram->m_ids.cmd.ACTO || cmd == m_dram->m_ids.cmd.PREO ||
+                           cmd == m_dram->m_ids.cmd.RDO  || cmd == m_dram->m_ids.cmd.WRO  ||
+                           cmd == m_dram->m_ids.cmd.REFO);
 
         // Issue command to DRAM model
         m_dram->issue_command(cmd, req_it->addr_vec);
@@ -995,7 +1030,7 @@ class AsyncDIMMHostController final : public IDRAMController, public Implementat
         // Note: In CONCURRENT mode, NMAInst writes are offloaded as WRO (not WR).
         // Must check both final_command (WR in HOST) and WRO (offload in CONCURRENT).
         bool is_nma_final = (cmd == req_it->final_command) ||
-                            (cmd == m_dram->m_commands("WRO"));
+                            (cmd == m_dram->m_ids.cmd.WRO);
         if (req_it->is_ndp_req && is_nma_final &&
             cmd_rank_id >= 0 && cmd_rank_id < m_num_rank) {
           int rr = req_it->addr_vec[m_nma_row_idx];
@@ -1021,15 +1056,15 @@ class AsyncDIMMHostController final : public IDRAMController, public Implementat
         if (m_bypass_to_nma && (is_offload || m_mode_per_rank[cmd_rank_id] != AsyncDIMMMode::NMA)) {
           static const std::vector<uint64_t> s_empty_payload{};
           const auto& payload =
-            (cmd == m_dram->m_commands("WR") || cmd == m_dram->m_commands("WRA") ||
-             cmd == m_dram->m_commands("WRO"))
+            (cmd == m_dram->m_ids.cmd.WR || cmd == m_dram->m_ids.cmd.WRA ||
+             cmd == m_dram->m_ids.cmd.WRO)
             ? req_it->m_payload : s_empty_payload;
           m_bypass_to_nma(cmd_rank_id, cmd, req_it->addr_vec, payload);
           s_num_bypass_cmds++;
         }
 
         // Row tracking (unified: ACT/ACTO open, PRE/PREO close)
-        if (cmd == m_dram->m_commands("ACT") || cmd == m_dram->m_commands("ACTO")) {
+        if (cmd == m_dram->m_ids.cmd.ACT || cmd == m_dram->m_ids.cmd.ACTO) {
           m_open_row_miss[flat_bank_id] = false;
           m_open_row[flat_bank_id] = req_it->addr_vec[row_idx];
           m_pre_open_row[flat_bank_id] = -1;
@@ -1040,7 +1075,7 @@ class AsyncDIMMHostController final : public IDRAMController, public Implementat
             m_scheduler->update_bk_status(flat_bank_id, false);
             m_rowpolicy->update_cap(0, req_it->addr_vec[rank_idx], req_it->addr_vec[bankgroup_idx], req_it->addr_vec[bank_idx], 128);
           }
-        } else if (cmd == m_dram->m_commands("PRE") || cmd == m_dram->m_commands("PREO")) {
+        } else if (cmd == m_dram->m_ids.cmd.PRE || cmd == m_dram->m_ids.cmd.PREO) {
           m_pre_open_row[flat_bank_id] = m_open_row[flat_bank_id];
           m_open_row[flat_bank_id] = -1;
           if (!is_offload) {
@@ -1048,7 +1083,7 @@ class AsyncDIMMHostController final : public IDRAMController, public Implementat
             m_scheduler->update_pre_open_row(flat_bank_id, m_pre_open_row[flat_bank_id]);
             m_scheduler->update_bk_status(flat_bank_id, true);
           }
-        } else if (cmd == m_dram->m_commands("PREsb")) {
+        } else if (cmd == m_dram->m_ids.cmd.PREsb) {
           int rk_id = req_it->addr_vec[rank_idx]; int t_bk = req_it->addr_vec[bank_idx];
           for (int bg = 0; bg < num_bankgroups; bg++) {
             int fid = t_bk + bg * num_banks + rk_id * num_bankgroups * num_banks;
@@ -1057,7 +1092,7 @@ class AsyncDIMMHostController final : public IDRAMController, public Implementat
             m_scheduler->update_pre_open_row(fid, m_pre_open_row[fid]);
             m_scheduler->update_bk_status(fid, true);
           }
-        } else if (cmd == m_dram->m_commands("PREA")) {
+        } else if (cmd == m_dram->m_ids.cmd.PREA) {
           int rk_id = req_it->addr_vec[rank_idx];
           for (int bg = 0; bg < num_bankgroups; bg++)
             for (int bk = 0; bk < num_banks; bk++) {
@@ -1070,7 +1105,7 @@ class AsyncDIMMHostController final : public IDRAMController, public Implementat
         }
 
         // OT tracking: every offload command increments OT (except REFO)
-        if (is_offload && cmd != m_dram->m_commands("REFO")) {
+        if (is_offload && cmd != m_dram->m_ids.cmd.REFO) {
           if (flat_bank_id >= 0 && flat_bank_id < m_total_banks_flat) {
             m_ot_counter[flat_bank_id]++;
             // [DEBUG]
@@ -1085,15 +1120,15 @@ class AsyncDIMMHostController final : public IDRAMController, public Implementat
           if (flat_bank_id == m_debug_track_bank_flat) {
             const char* cn[] = {"ACTO","PREO","RDO","WRO","REFO"};
             int ci = -1;
-            if      (cmd == m_dram->m_commands("ACTO")) ci = 0;
-            else if (cmd == m_dram->m_commands("PREO")) ci = 1;
-            else if (cmd == m_dram->m_commands("RDO"))  ci = 2;
-            else if (cmd == m_dram->m_commands("WRO"))  ci = 3;
-            else if (cmd == m_dram->m_commands("REFO")) ci = 4;
+            if      (cmd == m_dram->m_ids.cmd.ACTO) ci = 0;
+            else if (cmd == m_dram->m_ids.cmd.PREO) ci = 1;
+            else if (cmd == m_dram->m_ids.cmd.RDO)  ci = 2;
+            else if (cmd == m_dram->m_ids.cmd.WRO)  ci = 3;
+            else if (cmd == m_dram->m_ids.cmd.REFO) ci = 4;
             fprintf(stderr, "[%ld][OFFLOAD] %s row=%d col=%d %s sp=%d OT=%d\n",
               (long)m_clk, (ci >= 0 && ci <= 4) ? cn[ci] : "???",
-              req_it->addr_vec[m_dram->m_levels("row")],
-              req_it->addr_vec[m_dram->m_levels("column")],
+              req_it->addr_vec[m_dram->m_ids.level.row.required()],
+              req_it->addr_vec[m_dram->m_ids.level.column.required()],
               (req_it->type_id == Request::Type::Read) ? "RD" : "WR",
               req_it->scratchpad[0], m_ot_counter[flat_bank_id]);
           }
@@ -1101,10 +1136,10 @@ class AsyncDIMMHostController final : public IDRAMController, public Implementat
           // Per-bank per-command offload counters
           if (flat_bank_id >= 0 && flat_bank_id < m_total_banks_flat) {
             int cmd_type = -1;
-            if      (cmd == m_dram->m_commands("ACTO")) { s_offload_per_bank[flat_bank_id].acto++; cmd_type = 0; }
-            else if (cmd == m_dram->m_commands("PREO")) { s_offload_per_bank[flat_bank_id].preo++; cmd_type = 1; }
-            else if (cmd == m_dram->m_commands("RDO"))  { s_offload_per_bank[flat_bank_id].rdo++;  cmd_type = 2; }
-            else if (cmd == m_dram->m_commands("WRO"))  { s_offload_per_bank[flat_bank_id].wro++;  cmd_type = 3; }
+            if      (cmd == m_dram->m_ids.cmd.ACTO) { s_offload_per_bank[flat_bank_id].acto++; cmd_type = 0; }
+            else if (cmd == m_dram->m_ids.cmd.PREO) { s_offload_per_bank[flat_bank_id].preo++; cmd_type = 1; }
+            else if (cmd == m_dram->m_ids.cmd.RDO)  { s_offload_per_bank[flat_bank_id].rdo++;  cmd_type = 2; }
+            else if (cmd == m_dram->m_ids.cmd.WRO)  { s_offload_per_bank[flat_bank_id].wro++;  cmd_type = 3; }
             if (cmd_type >= 0) {
               int buf_type = 0;  // default: active_buf
               if (buffer == &m_active_buffer) buf_type = 0;
@@ -1118,14 +1153,14 @@ class AsyncDIMMHostController final : public IDRAMController, public Implementat
               // Debug: track Ch0 Rk0 BG7 BK1
               if (flat_bank_id == m_debug_track_bank_flat) {
                 m_debug_track_events.push_back({(long)m_clk, cmd_type, m_ot_counter[flat_bank_id],
-                  req_it->addr_vec[m_dram->m_levels("row")]});
+                  req_it->addr_vec[m_dram->m_ids.level.row.required()]});
               }
               // Per-bank last-3 ring buffer: detect consecutive ACTO/PREO without RDO/WRO
               {
                 auto& ring = m_bank_cmd_rings[flat_bank_id];
                 ring.cmds[ring.idx] = cmd_type;
                 ring.clks[ring.idx] = (long)m_clk;
-                ring.rows[ring.idx] = req_it->addr_vec[m_dram->m_levels("row")];
+                ring.rows[ring.idx] = req_it->addr_vec[m_dram->m_ids.level.row.required()];
                 ring.idx = (ring.idx + 1) % 3;
                 ring.count++;
                 if (cmd_type == 2 || cmd_type == 3) {  // RDO or WRO
@@ -1144,30 +1179,30 @@ class AsyncDIMMHostController final : public IDRAMController, public Implementat
         }
 
         // Stats
-        if (cmd == m_dram->m_commands("RD") || cmd == m_dram->m_commands("RDA") ||
-            cmd == m_dram->m_commands("RDO")) s_num_issue_reads++;
-        if (cmd == m_dram->m_commands("WR") || cmd == m_dram->m_commands("WRA") ||
-            cmd == m_dram->m_commands("WRO")) s_num_issue_writes++;
-        if (cmd == m_dram->m_commands("REFab"))
-          s_num_refresh_cc_per_rank[req_it->addr_vec[m_rank_addr_idx]] += m_dram->m_timing_vals("nRFC1");
+        if (cmd == m_dram->m_ids.cmd.RD || cmd == m_dram->m_ids.cmd.RDA ||
+            cmd == m_dram->m_ids.cmd.RDO) s_num_issue_reads++;
+        if (cmd == m_dram->m_ids.cmd.WR || cmd == m_dram->m_ids.cmd.WRA ||
+            cmd == m_dram->m_ids.cmd.WRO) s_num_issue_writes++;
+        if (cmd == m_dram->m_ids.cmd.REFab)
+          s_num_refresh_cc_per_rank[req_it->addr_vec[m_rank_addr_idx]] += m_dram->m_timing_vals(m_dram->m_ids.timing.nRFC1.required());
 
         // Request lifecycle
         bool is_final_real    = (cmd == req_it->final_command);
-        bool is_final_offload = (cmd == m_dram->m_commands("RDO") || cmd == m_dram->m_commands("WRO") ||
-                                 cmd == m_dram->m_commands("REFO"));
+        bool is_final_offload = (cmd == m_dram->m_ids.cmd.RDO || cmd == m_dram->m_ids.cmd.WRO ||
+                                 cmd == m_dram->m_ids.cmd.REFO);
 
         if (is_final_offload) {
           // Offload final (RDO/WRO/REFO): register in Return Unit, NOT in pending.
           // Completion happens when NMA MC fires interrupt (+ RT for reads).
-          if (cmd != m_dram->m_commands("REFO")) {
+          if (cmd != m_dram->m_ids.cmd.REFO) {
             bool is_read = (req_it->type_id == Request::Type::Read);
             int cc = req_it->scratchpad[0];
             m_return_unit.push_back({*req_it, cc, flat_bank_id, is_read});
             if (flat_bank_id == m_debug_track_bank_flat) {
               m_debug_track_events.push_back({(long)m_clk, 5/*RU_PUSH*/, m_ot_counter[flat_bank_id],
-                req_it->addr_vec[m_dram->m_levels("row")]});
+                req_it->addr_vec[m_dram->m_ids.level.row.required()]});
               m_debug_host_ru_log.push_back({(long)m_clk,
-                req_it->addr_vec[m_dram->m_levels("row")], cc, is_read, m_ot_counter[flat_bank_id]});
+                req_it->addr_vec[m_dram->m_ids.level.row.required()], cc, is_read, m_ot_counter[flat_bank_id]});
             }
           }
           // REFO: no RU entry needed (refresh has no frontend callback)
@@ -1178,7 +1213,7 @@ class AsyncDIMMHostController final : public IDRAMController, public Implementat
             if (req_it->type_id == Request::Type::Read) m_host_rd_acceess_iss_counter++;
           }
           // BW: Host<->NMA Offload (concurrent mode RDO/WRO, not REFO)
-          if (cmd != m_dram->m_commands("REFO")) {
+          if (cmd != m_dram->m_ids.cmd.REFO) {
             m_bw_host_nma_offload++;
             if (req_it->is_trace_core_req) m_bw_tcore_host_nma_offload++;
           }
@@ -1187,7 +1222,6 @@ class AsyncDIMMHostController final : public IDRAMController, public Implementat
           // Real final (RD/WR for HOST mode): complete immediately with fixed latency
           if (req_it->type_id == Request::Type::Read) {
             req_it->depart = m_clk + m_dram->m_read_latency;
-            pending.push_back(*req_it);
           } else {
             // WR completes immediately — count as received
             if (req_it->is_host_req) m_host_acceess_rec_counter++;
@@ -1201,14 +1235,17 @@ class AsyncDIMMHostController final : public IDRAMController, public Implementat
           // BW: Host<->NMA Bypass (real RD/WR bypassed to NMA for sync)
           m_bw_host_nma_bypass++;
           if (req_it->is_trace_core_req) m_bw_tcore_host_nma_bypass++;
+          // Move the read to the pending queue last, as the request is read until here
+          if (req_it->type_id == Request::Type::Read) {
+            pending.push_back(std::move(*req_it));
+          }
           buffer->remove(req_it);
         } else if (!is_offload && m_dram->m_command_meta(cmd).is_opening) {
           // Real ACT → active_buffer
           req_it->is_actived = true;
-          if (!m_active_buffer.enqueue(*req_it))
+          if (!buffer->move_to(req_it, m_active_buffer))
             throw std::runtime_error("Fail to enque to m_active_buffer");
-          buffer->remove(req_it);
-        } else if (is_offload && cmd == m_dram->m_commands("ACTO")) {
+        } else if (is_offload && cmd == m_dram->m_ids.cmd.ACTO) {
           // ACTO → active_buffer (ensures RDO/WRO gets Step 1a priority)
           // But block during C2H drain: prevent new active_buffer entries that
           // would survive mode transition and become permanently stuck.
@@ -1218,9 +1255,8 @@ class AsyncDIMMHostController final : public IDRAMController, public Implementat
             // Request stays in rd/wr buffer; will be served in HOST mode after C2H.
           } else {
             req_it->is_actived = true;
-            if (!m_active_buffer.enqueue(*req_it))
+            if (!buffer->move_to(req_it, m_active_buffer))
               throw std::runtime_error("Fail to enque to m_active_buffer");
-            buffer->remove(req_it);
           }
         }
         // PREO: request stays in buffer → next tick m_open_row closed → ACTO
@@ -1325,17 +1361,17 @@ class AsyncDIMMHostController final : public IDRAMController, public Implementat
 
           if (m_open_row[flat_bank_id] == -1) {
             // Bank closed → ACTO
-            offload_cmd = m_dram->m_commands("ACTO");
+            offload_cmd = m_dram->m_ids.cmd.ACTO.required();
           } else if (m_open_row[flat_bank_id] != target_row) {
             // Row conflict → PREO
             // Skip PREO if this bank has a pending row-hit (avoid closing the row it needs)
             if (bank_has_hit[flat_bank_id]) continue;
-            offload_cmd = m_dram->m_commands("PREO");
+            offload_cmd = m_dram->m_ids.cmd.PREO.required();
           } else {
             // Row hit → RDO/WRO
             is_hit = true;
-            offload_cmd = is_read ? m_dram->m_commands("RDO")
-                                  : m_dram->m_commands("WRO");
+            offload_cmd = is_read ? m_dram->m_ids.cmd.RDO.required()
+                                  : m_dram->m_ids.cmd.WRO.required();
           }
 
           if (!m_dram->check_ready(offload_cmd, it->addr_vec)) continue;
@@ -1436,13 +1472,13 @@ class AsyncDIMMHostController final : public IDRAMController, public Implementat
           int offload_cmd = -1;
 
           if (m_open_row[flat_bank_id] == -1) {
-            offload_cmd = m_dram->m_commands("ACTO");
+            offload_cmd = m_dram->m_ids.cmd.ACTO.required();
           } else if (m_open_row[flat_bank_id] != target_row) {
-            offload_cmd = m_dram->m_commands("PREO");
+            offload_cmd = m_dram->m_ids.cmd.PREO.required();
           } else {
             is_hit = true;
-            offload_cmd = is_read ? m_dram->m_commands("RDO")
-                                  : m_dram->m_commands("WRO");
+            offload_cmd = is_read ? m_dram->m_ids.cmd.RDO.required()
+                                  : m_dram->m_ids.cmd.WRO.required();
           }
 
           if (!m_dram->check_ready(offload_cmd, it->addr_vec)) continue;
@@ -1601,7 +1637,7 @@ class AsyncDIMMHostController final : public IDRAMController, public Implementat
           if (ab_flat >= 0 && ab_flat < m_total_banks_flat &&
               m_ot_counter[ab_flat] >= HOST_OT_THRESHOLD) continue;
           bool is_read = (it->type_id == Request::Type::Read);
-          int offload_cmd = is_read ? m_dram->m_commands("RDO") : m_dram->m_commands("WRO");
+          int offload_cmd = is_read ? m_dram->m_ids.cmd.RDO.required() : m_dram->m_ids.cmd.WRO.required();
           if (m_dram->check_ready(offload_cmd, it->addr_vec)) {
             it->command = offload_cmd;
             req_it = it;
@@ -1621,7 +1657,7 @@ class AsyncDIMMHostController final : public IDRAMController, public Implementat
           if (m_mode_per_rank[ab_rk] != AsyncDIMMMode::HOST) continue;
           if (is_empty_priority_per_rank[ab_rk]) continue;  // No pending refresh
           it->command = m_dram->get_preq_command(it->final_command, it->addr_vec);
-          if (m_dram->check_ready(it->command, it->addr_vec)) {
+          if (m_dram->check_ready(*it)) {
             req_it = it;
             request_found = true;
             req_buffer = &m_active_buffer;
@@ -1648,7 +1684,7 @@ class AsyncDIMMHostController final : public IDRAMController, public Implementat
                              m_ot_counter[fc_flat] >= HOST_OT_THRESHOLD);
               if (ot_ok) {
                 bool is_read = (req_it->type_id == Request::Type::Read);
-                int offload_cmd = is_read ? m_dram->m_commands("RDO") : m_dram->m_commands("WRO");
+                int offload_cmd = is_read ? m_dram->m_ids.cmd.RDO.required() : m_dram->m_ids.cmd.WRO.required();
                 if (m_dram->check_ready(offload_cmd, req_it->addr_vec)) {
                   req_it->command = offload_cmd;
                   request_found = true;
@@ -1659,7 +1695,7 @@ class AsyncDIMMHostController final : public IDRAMController, public Implementat
             }
           } else {
             // HOST: normal scheduling
-            if (m_dram->check_ready(req_it->command, req_it->addr_vec)) {
+            if (m_dram->check_ready(*req_it)) {
               request_found = true;
               req_buffer = &m_active_buffer;
 
@@ -1680,11 +1716,11 @@ class AsyncDIMMHostController final : public IDRAMController, public Implementat
             if (m_offload_stopped[rk_idx]) continue;  // offload stopped — hold in priority_buffer
             req_it = m_priority_buffers[rk_idx].begin();
             // Distinguish REF (REFab/REFsb) vs PRE (Row Policy cap close-row)
-            bool is_ref = (req_it->final_command == m_dram->m_commands("REFab") ||
-                           req_it->final_command == m_dram->m_commands("REFsb"));
+            bool is_ref = (req_it->final_command == m_dram->m_ids.cmd.REFab ||
+                           req_it->final_command == m_dram->m_ids.cmd.REFsb);
             if (is_ref) {
               // REF → REFO (offload refresh to NMA MC)
-              int refo_cmd = m_dram->m_commands("REFO");
+              int refo_cmd = m_dram->m_ids.cmd.REFO.required();
               if (m_dram->check_ready(refo_cmd, req_it->addr_vec)) {
                 req_it->command = refo_cmd;
                 request_found = true;
@@ -1693,7 +1729,7 @@ class AsyncDIMMHostController final : public IDRAMController, public Implementat
               }
             } else {
               // PRE (Row Policy cap) → PREO (offload single-bank close to NMA MC)
-              int preo_cmd = m_dram->m_commands("PREO");
+              int preo_cmd = m_dram->m_ids.cmd.PREO.required();
               if (m_dram->check_ready(preo_cmd, req_it->addr_vec)) {
                 req_it->command = preo_cmd;
                 request_found = true;
@@ -1706,7 +1742,7 @@ class AsyncDIMMHostController final : public IDRAMController, public Implementat
             req_buffer = &m_priority_buffers[rk_idx];
             req_it = m_priority_buffers[rk_idx].begin();
             req_it->command = m_dram->get_preq_command(req_it->final_command, req_it->addr_vec);
-            request_found = m_dram->check_ready(req_it->command, req_it->addr_vec);
+            request_found = m_dram->check_ready(*req_it);
             if (request_found) break;
           }
         }
@@ -1738,7 +1774,7 @@ class AsyncDIMMHostController final : public IDRAMController, public Implementat
             if (is_empty_priority_per_rank[rk_idx]) {
               auto& buffer = m_is_write_mode_per_rank[rk_idx] ? m_write_buffers[rk_idx] : m_read_buffers[rk_idx];
               if (req_it = m_scheduler->get_best_request(buffer); req_it != buffer.end()) {
-                request_found = m_dram->check_ready(req_it->command, req_it->addr_vec);
+                request_found = m_dram->check_ready(*req_it);
                 req_buffer = &buffer;
               }
               if (request_found) break;
@@ -1781,9 +1817,9 @@ class AsyncDIMMHostController final : public IDRAMController, public Implementat
       s_priority_queue_len_avg = (float)s_priority_queue_len / (float)m_clk;
 
       int tx_bytes = m_dram->m_internal_prefetch_size * m_dram->m_channel_width / 8;
-      s_bandwidth = ((float)((s_num_read_reqs + s_num_write_reqs) * tx_bytes) / (float)(m_clk * m_dram->m_timing_vals("tCK_ps"))) * 1E12 / (1024 * 1024 * 1012);
-      s_dq_bandwidth = ((float)((s_num_issue_reads + s_num_issue_writes) * tx_bytes) / (float)(m_clk * m_dram->m_timing_vals("tCK_ps"))) * 1E12 / (1024 * 1024 * 1012);
-      s_max_bandwidth = (float)(m_dram->m_channel_width / 8) * (float)m_dram->m_timing_vals("rate") * 1E6 / (1024 * 1024 * 1012);
+      s_bandwidth = ((float)((s_num_read_reqs + s_num_write_reqs) * tx_bytes) / (float)(m_clk * m_dram->m_timing_vals(m_dram->m_ids.timing.tCK_ps.required()))) * 1E12 / (1024 * 1024 * 1012);
+      s_dq_bandwidth = ((float)((s_num_issue_reads + s_num_issue_writes) * tx_bytes) / (float)(m_clk * m_dram->m_timing_vals(m_dram->m_ids.timing.tCK_ps.required()))) * 1E12 / (1024 * 1024 * 1012);
+      s_max_bandwidth = (float)(m_dram->m_channel_width / 8) * (float)m_dram->m_timing_vals(m_dram->m_ids.timing.rate.required()) * 1E6 / (1024 * 1024 * 1012);
 
       // Debug outputs disabled — enable when debugging OT issues
 
@@ -1817,6 +1853,9 @@ class AsyncDIMMHostController final : public IDRAMController, public Implementat
       return s_read_latency;
     }
 
+    uint64_t get_row_hit_counter() override { return s_row_hits; }
+    uint64_t get_row_access_counter() override { return s_row_hits + s_row_misses + s_row_conflicts; }
+
     std::vector<uint64_t> get_counters() override {
       std::vector<uint64_t> v;
       v.reserve(10);
@@ -149,7 +149,8 @@ class AsyncDIMMNMAController {
       bool data_pending = false;      // Waiting for DRAM data response
       Clk_t data_complete_clk = -1;   // Clock when data response arrives
     };
-    std::vector<std::deque<NMARequest>> m_nma_req_buffer;  // [total_banks]
+    SlotArena<NMARequest> m_nma_req_slots;                  // The slots of all REQ FIFOs, reused once the FIFOs reach their peak occupancy
+    std::vector<SlotQueue<NMARequest>> m_nma_req_buffer;    // [total_banks]
     static constexpr int NMA_REQ_BUFFER_PER_BANK = 8;
 
     // Round-robin bank index for per-bank front scheduling
@@ -206,10 +207,6 @@ class AsyncDIMMNMAController {
 
     Clk_t m_clk = 0;
 
-    // NMA clock ratio: NMA logic runs at 1/4 of DRAM clock
-    // (on-DIMM digital logic cannot run at full DRAM clock speed)
-    static constexpr int NMA_CLOCK_RATIO = 1;
-
     // ===== Phase 3: Concurrent Mode =====
 
     bool m_concurrent_mode = false;
@@ -295,6 +292,10 @@ class AsyncDIMMNMAController {
       int cmd_count;         // 1=RD, 2=ACT+RD, 3=PRE+ACT+RD
       bool is_read;
       std::string seq;       // e.g. "PRE→ACT→RD"
+
+      void serialize(Archive& ar) {
+        ar & first_clk & last_clk & row & cmd_count & is_read & seq;
+      }
     };
     std::vector<NMACmdGroupLog> m_debug_nma_cmd_groups;
 
@@ -411,21 +412,21 @@ class AsyncDIMMNMAController {
       m_rank_id = rank_id;
       m_dram = dram;
 
-      m_channel_level = m_dram->m_levels("channel");
-      m_rank_level = m_dram->m_levels("rank");
-      m_bankgroup_level = m_dram->m_levels("bankgroup");
-      m_bank_level = m_dram->m_levels("bank");
-      m_row_level = m_dram->m_levels("row");
-      m_column_level = m_dram->m_levels("column");
+      m_channel_level = m_dram->m_ids.level.channel.required();
+      m_rank_level = m_dram->m_ids.level.rank.required();
+      m_bankgroup_level = m_dram->m_ids.level.bankgroup.required();
+      m_bank_level = m_dram->m_ids.level.bank.required();
+      m_row_level = m_dram->m_ids.level.row.required();
+      m_column_level = m_dram->m_ids.level.column.required();
 
       m_num_bankgroups = m_dram->get_level_size("bankgroup");
       m_num_banks = m_dram->get_level_size("bank");
       m_total_banks = m_num_bankgroups * m_num_banks;
 
       // Cache timing values
-      m_nRFC1 = m_dram->m_timing_vals("nRFC1");
-      m_nRFCsb = m_dram->m_timing_vals("nRFCsb");
-      m_nREFI = m_dram->m_timing_vals("nREFI");
+      m_nRFC1 = m_dram->m_timing_vals(m_dram->m_ids.timing.nRFC1.required());
+      m_nRFCsb = m_dram->m_timing_vals(m_dram->m_ids.timing.nRFCsb.required());
+      m_nREFI = m_dram->m_timing_vals(m_dram->m_ids.timing.nREFI.required());
 
       // Initialize all banks to CLOSED
       m_bank_fsm.resize(m_total_banks);
@@ -436,6 +437,9 @@ class AsyncDIMMNMAController {
 
       // Initialize per-bank REQ FIFOs
       m_nma_req_buffer.resize(m_total_banks);
+      for (auto& fifo : m_nma_req_buffer) {
+        fifo.bind(&m_nma_req_slots);
+      }
       s_per_bank_rd.resize(m_total_banks, 0);
       s_per_bank_wr.resize(m_total_banks, 0);
 
@@ -458,9 +462,9 @@ class AsyncDIMMNMAController {
       }
 
       // Cache DRAM read timing for read completion modeling
-      m_nCL = m_dram->m_timing_vals("nCL");
-      m_nCWL = m_dram->m_timing_vals("nCWL");
-      m_nBL = m_dram->m_timing_vals("nBL");
+      m_nCL = m_dram->m_timing_vals(m_dram->m_ids.timing.nCL.required());
+      m_nCWL = m_dram->m_timing_vals(m_dram->m_ids.timing.nCWL.required());
+      m_nBL = m_dram->m_timing_vals(m_dram->m_ids.timing.nBL.required());
 
       // Store magic path addresses
       m_nma_ctrl_row = nma_ctrl_row;
@@ -470,6 +474,32 @@ class AsyncDIMMNMAController {
       m_nma_buf_bk   = nma_buf_bk;
     }
 
+    // Saves/restores the run-time state (the owning AsyncDIMM system checkpoints its NMA controllers)
+    void serialize(Archive& ar) {
+      ar & m_clk & m_bank_fsm & m_future_actions;
+      ar & m_nma_start_pending & m_nma_state & m_nma_program & m_nma_pc & m_base_reg;
+      ar & m_addr_gen_slots;
+      for (auto& fifo : m_nma_req_buffer) {
+        ar & fifo;
+      }
+      ar & m_req_rr_bank_idx & m_nma_wait_cnt & m_nma_wait_target;
+      ar & m_last_refresh_clk & m_nma_refresh_pending;
+      ar & s_num_bypass_received & s_num_act_bypass & s_num_pre_bypass & s_num_rd_bypass & s_num_wr_bypass & s_num_ref_bypass;
+      ar & s_num_magic_inst_wr & s_num_magic_ctrl_wr;
+      ar & s_num_nma_act & s_num_nma_pre & s_num_nma_rd & s_num_nma_wr & s_num_nma_ref & s_per_bank_rd & s_per_bank_wr;
+      ar & s_num_nma_instructions & s_num_nma_executions & s_num_nma_compute_only & s_num_nma_loops;
+      ar & s_nma_idle_cycles & s_nma_issue_start_cycles & s_nma_run_cycles & s_nma_bar_cycles & s_nma_wait_cycles & s_nma_done_cycles;
+      ar & m_concurrent_mode & m_accept_offload & m_cmd_fifo & m_eff_cmd_fifo_size & m_eff_req_fifo_size;
+      ar & m_arbiter_use_cmd & m_sr_unit & m_return_buffer & m_next_seq_num;
+      ar & s_interrupt_log & s_cmd_fifo_issue_log & m_debug_nma_cur_group & m_debug_nma_cmd_groups;
+      ar & m_last_interrupt_clk & m_pending_interrupts & m_sr_recovery & m_pending_reads;
+      ar & m_req_row_hit_count & m_req_row_hit_row & m_req_continuous_count & m_cmd_quota_remaining;
+      ar & s_num_cmd_received & s_num_cmd_issued & s_num_cmd_fifo_rd & s_num_cmd_fifo_wr;
+      ar & s_num_req_fifo_rd & s_num_req_fifo_wr & s_num_hn_switches & s_num_sr_recoveries;
+      ar & s_num_interrupts_sent & s_num_rt_received & s_num_forced_cmd_switches & s_num_req_cap_switches;
+      ar & s_per_bank_cmd & m_issue_track_cmd & m_issue_track_req & m_issue_track_start;
+    }
+
     void set_channel_id(int ch_id) { m_channel_id = ch_id; }
 
     /**
@@ -548,7 +578,7 @@ class AsyncDIMMNMAController {
     /**
      * Called every DRAM cycle.
      * - Future actions (refresh completion) checked every DRAM cycle.
-     * - NMA state machine executes only every NMA_CLOCK_RATIO (4) DRAM cycles.
+     * - NMA state machine also executes every DRAM cycle (the NMA logic is modeled at the DRAM clock).
      */
     void tick() {
       m_clk++;
@@ -604,10 +634,7 @@ class AsyncDIMMNMAController {
       //   m_issue_track_start = m_clk;
       // }
 
-      // NMA state machine runs at 1/4 DRAM clock
-      if (m_clk % NMA_CLOCK_RATIO == 0) {
-        tick_nma_state_machine();
-      }
+      tick_nma_state_machine();
     }
 
     // ===== Bypass command from Host MC (Phase 1: Explicit Sync H2N + Magic Path) =====
@@ -633,7 +660,7 @@ class AsyncDIMMNMAController {
       if (m_concurrent_mode) {
         // REFO: Host MC's RefreshManager says refresh is due.
         // Set pending flag — NMA MC will issue real REFab when all banks are ready.
-        if (command == m_dram->m_commands("REFO")) {
+        if (command == m_dram->m_ids.cmd.REFO) {
           m_nma_refresh_pending = true;
           s_num_ref_bypass++;
           return;
@@ -641,10 +668,10 @@ class AsyncDIMMNMAController {
 
         int decoded_cmd = -1;
         // Decode offload → NMA-local commands (rank-local CA + data bus)
-        if      (command == m_dram->m_commands("ACTO")) decoded_cmd = m_dram->m_commands("ACT_L");
-        else if (command == m_dram->m_commands("PREO")) decoded_cmd = m_dram->m_commands("PRE_L");
-        else if (command == m_dram->m_commands("RDO"))  decoded_cmd = m_dram->m_commands("RD_L");
-        else if (command == m_dram->m_commands("WRO"))  decoded_cmd = m_dram->m_commands("WR_L");
+        if      (command == m_dram->m_ids.cmd.ACTO) decoded_cmd = m_dram->m_ids.cmd.ACT_L.required();
+        else if (command == m_dram->m_ids.cmd.PREO) decoded_cmd = m_dram->m_ids.cmd.PRE_L.required();
+        else if (command == m_dram->m_ids.cmd.RDO)  decoded_cmd = m_dram->m_ids.cmd.RD_L.required();
+        else if (command == m_dram->m_ids.cmd.WRO)  decoded_cmd = m_dram->m_ids.cmd.WR_L.required();
 
         if (decoded_cmd >= 0) {
           int flat_id = get_flat_bank_id(addr_vec);
@@ -653,11 +680,11 @@ class AsyncDIMMNMAController {
             entry.command  = decoded_cmd;
             entry.addr_vec = addr_vec;
             entry.arrive   = m_clk;
-            entry.is_read  = (decoded_cmd == m_dram->m_commands("RD_L"));
+            entry.is_read  = (decoded_cmd == m_dram->m_ids.cmd.RD_L);
             // Only RD_L/WR_L need return_buffer entries for interrupt-based completion.
             // ACT_L/PRE_L are prerequisites — Host MC RU only tracks RDO/WRO.
-            if (decoded_cmd == m_dram->m_commands("RD_L") ||
-                decoded_cmd == m_dram->m_commands("WR_L")) {
+            if (decoded_cmd == m_dram->m_ids.cmd.RD_L ||
+                decoded_cmd == m_dram->m_ids.cmd.WR_L) {
               entry.seq_num = m_next_seq_num;
               m_return_buffer.push_back({m_next_seq_num, false,
                 addr_vec[m_bankgroup_level], addr_vec[m_bank_level], entry.is_read});
@@ -668,18 +695,18 @@ class AsyncDIMMNMAController {
             m_cmd_fifo[flat_id].push_back(entry);
             s_num_cmd_received++;
             // Per-bank per-command receive counters
-            if      (command == m_dram->m_commands("ACTO")) s_per_bank_cmd[flat_id].acto++;
-            else if (command == m_dram->m_commands("PREO")) s_per_bank_cmd[flat_id].preo++;
-            else if (command == m_dram->m_commands("RDO"))  s_per_bank_cmd[flat_id].rdo++;
-            else if (command == m_dram->m_commands("WRO"))  s_per_bank_cmd[flat_id].wro++;
+            if      (command == m_dram->m_ids.cmd.ACTO) s_per_bank_cmd[flat_id].acto++;
+            else if (command == m_dram->m_ids.cmd.PREO) s_per_bank_cmd[flat_id].preo++;
+            else if (command == m_dram->m_ids.cmd.RDO)  s_per_bank_cmd[flat_id].rdo++;
+            else if (command == m_dram->m_ids.cmd.WRO)  s_per_bank_cmd[flat_id].wro++;
             // Debug: target bank command group tracking
             if (addr_vec[m_bankgroup_level] == m_debug_target_bg &&
                 addr_vec[m_bank_level] == m_debug_target_bk) {
               int row = addr_vec[m_row_level];
-              bool is_pre = (command == m_dram->m_commands("PREO"));
-              bool is_act = (command == m_dram->m_commands("ACTO"));
-              bool is_rd  = (command == m_dram->m_commands("RDO"));
-              bool is_wr  = (command == m_dram->m_commands("WRO"));
+              bool is_pre = (command == m_dram->m_ids.cmd.PREO);
+              bool is_act = (command == m_dram->m_ids.cmd.ACTO);
+              bool is_rd  = (command == m_dram->m_ids.cmd.RDO);
+              bool is_wr  = (command == m_dram->m_ids.cmd.WRO);
               if (is_pre) {
                 // PRE starts a new group (if current group has no RD/WR, flush as incomplete)
                 if (m_debug_nma_cur_group.cmd_count > 0 && !m_debug_nma_cur_group.has_rdwr) {
@@ -744,7 +771,7 @@ class AsyncDIMMNMAController {
       }
 
       // REFO in NMA mode: Host MC's RefreshManager requests refresh
-      if (command == m_dram->m_commands("REFO")) {
+      if (command == m_dram->m_ids.cmd.REFO) {
         m_nma_refresh_pending = true;
         s_num_ref_bypass++;
         return;
@@ -752,19 +779,19 @@ class AsyncDIMMNMAController {
 
       s_num_bypass_received++;
 
-      if (command == m_dram->m_commands("ACT")) {
+      if (command == m_dram->m_ids.cmd.ACT) {
         int flat_id = get_flat_bank_id(addr_vec);
         m_bank_fsm[flat_id].state = BankState::OPENED;
         m_bank_fsm[flat_id].open_row = addr_vec[m_row_level];
         s_num_act_bypass++;
       }
-      else if (command == m_dram->m_commands("PRE")) {
+      else if (command == m_dram->m_ids.cmd.PRE) {
         int flat_id = get_flat_bank_id(addr_vec);
         m_bank_fsm[flat_id].state = BankState::CLOSED;
         m_bank_fsm[flat_id].open_row = -1;
         s_num_pre_bypass++;
       }
-      else if (command == m_dram->m_commands("PREsb")) {
+      else if (command == m_dram->m_ids.cmd.PREsb) {
         int target_bank = addr_vec[m_bank_level];
         for (int bg = 0; bg < m_num_bankgroups; bg++) {
           int flat_id = bg * m_num_banks + target_bank;
@@ -773,24 +800,24 @@ class AsyncDIMMNMAController {
         }
         s_num_pre_bypass++;
       }
-      else if (command == m_dram->m_commands("PREA")) {
+      else if (command == m_dram->m_ids.cmd.PREA) {
         for (auto& bank : m_bank_fsm) {
           bank.state = BankState::CLOSED;
           bank.open_row = -1;
         }
         s_num_pre_bypass++;
       }
-      else if (command == m_dram->m_commands("RD")) {
+      else if (command == m_dram->m_ids.cmd.RD) {
         s_num_rd_bypass++;
       }
-      else if (command == m_dram->m_commands("RDA")) {
+      else if (command == m_dram->m_ids.cmd.RDA) {
         int flat_id = get_flat_bank_id(addr_vec);
         m_bank_fsm[flat_id].state = BankState::CLOSED;
         m_bank_fsm[flat_id].open_row = -1;
         s_num_rd_bypass++;
       }
-      else if (command == m_dram->m_commands("WR") ||
-               command == m_dram->m_commands("WRA")) {
+      else if (command == m_dram->m_ids.cmd.WR ||
+               command == m_dram->m_ids.cmd.WRA) {
         // ===== Magic Path Interception =====
         // If this WR targets the NMA control region, intercept the payload.
         // The NMA MC reads the DQ-bus data (payload) instead of forwarding to DRAM cells.
@@ -817,14 +844,14 @@ class AsyncDIMMNMAController {
           }
         }
 
-        if (command == m_dram->m_commands("WRA")) {
+        if (command == m_dram->m_ids.cmd.WRA) {
           int flat_id = get_flat_bank_id(addr_vec);
           m_bank_fsm[flat_id].state = BankState::CLOSED;
           m_bank_fsm[flat_id].open_row = -1;
         }
         s_num_wr_bypass++;
       }
-      else if (command == m_dram->m_commands("REFab")) {
+      else if (command == m_dram->m_ids.cmd.REFab) {
         for (auto& bank : m_bank_fsm) {
           bank.state = BankState::REFRESHING;
           bank.open_row = -1;
@@ -836,7 +863,7 @@ class AsyncDIMMNMAController {
         });
         s_num_ref_bypass++;
       }
-      else if (command == m_dram->m_commands("REFsb")) {
+      else if (command == m_dram->m_ids.cmd.REFsb) {
         int target_bank = addr_vec[m_bank_level];
         for (int bg = 0; bg < m_num_bankgroups; bg++) {
           int flat_id = bg * m_num_banks + target_bank;
@@ -1377,10 +1404,10 @@ class AsyncDIMMNMAController {
 
       const auto& bank = m_bank_fsm[bank_id];
       int front_cmd = fifo.front().command;
-      int act_cmd   = m_dram->m_commands("ACT_L");
-      int pre_cmd   = m_dram->m_commands("PRE_L");
-      int rd_cmd    = m_dram->m_commands("RD_L");
-      int wr_cmd    = m_dram->m_commands("WR_L");
+      int act_cmd   = m_dram->m_ids.cmd.ACT_L.required();
+      int pre_cmd   = m_dram->m_ids.cmd.PRE_L.required();
+      int rd_cmd    = m_dram->m_ids.cmd.RD_L.required();
+      int wr_cmd    = m_dram->m_ids.cmd.WR_L.required();
 
       // Build recovery address vector for this bank
       auto make_bank_addr = [&]() -> AddrVec_t {
@@ -1436,10 +1463,10 @@ class AsyncDIMMNMAController {
         int bg = bid / m_num_banks;
         int bk = bid % m_num_banks;
         int cmd_type = -1;
-        if      (cmd == m_dram->m_commands("ACT_L")) cmd_type = 0;
-        else if (cmd == m_dram->m_commands("PRE_L")) cmd_type = 1;
-        else if (cmd == m_dram->m_commands("RD_L"))  cmd_type = 2;
-        else if (cmd == m_dram->m_commands("WR_L"))  cmd_type = 3;
+        if      (cmd == m_dram->m_ids.cmd.ACT_L) cmd_type = 0;
+        else if (cmd == m_dram->m_ids.cmd.PRE_L) cmd_type = 1;
+        else if (cmd == m_dram->m_ids.cmd.RD_L)  cmd_type = 2;
+        else if (cmd == m_dram->m_ids.cmd.WR_L)  cmd_type = 3;
         // [DEBUG] if (cmd_type >= 0)
         //   s_cmd_fifo_issue_log.push_back({bg, bk, cmd_type, m_clk});
       };
@@ -1469,9 +1496,9 @@ class AsyncDIMMNMAController {
 
       // Case 1: Bank CLOSED but front is RD/WR → need ACT first
       if (bank.state == BankState::CLOSED &&
-          (entry.command == m_dram->m_commands("RD_L") ||
-           entry.command == m_dram->m_commands("WR_L"))) {
-        int act_cmd = m_dram->m_commands("ACT_L");
+          (entry.command == m_dram->m_ids.cmd.RD_L ||
+           entry.command == m_dram->m_ids.cmd.WR_L)) {
+        int act_cmd = m_dram->m_ids.cmd.ACT_L.required();
         if (m_dram->check_ready(act_cmd, entry.addr_vec)) {
           m_dram->issue_command(act_cmd, entry.addr_vec);
           update_fsm_on_nma_command(act_cmd, entry.addr_vec);
@@ -1485,8 +1512,8 @@ class AsyncDIMMNMAController {
 
       // Case 2: Bank OPENED but front is ACT → need PRE first (close current row)
       if (bank.state == BankState::OPENED &&
-          entry.command == m_dram->m_commands("ACT_L")) {
-        int pre_cmd = m_dram->m_commands("PRE_L");
+          entry.command == m_dram->m_ids.cmd.ACT_L) {
+        int pre_cmd = m_dram->m_ids.cmd.PRE_L.required();
         AddrVec_t pre_addr = entry.addr_vec;  // same bank address
         if (m_dram->check_ready(pre_cmd, pre_addr)) {
           m_dram->issue_command(pre_cmd, pre_addr);
@@ -1507,20 +1534,20 @@ class AsyncDIMMNMAController {
       s_num_cmd_issued++;
 
       // Per-bank per-command CMD FIFO issue counters
-      if      (entry.command == m_dram->m_commands("ACT_L")) { s_num_nma_act++; s_per_bank_cmd[bank_id].issue_act++; }
-      else if (entry.command == m_dram->m_commands("PRE_L")) { s_num_nma_pre++; s_per_bank_cmd[bank_id].issue_pre++; }
-      else if (entry.command == m_dram->m_commands("RD_L"))  { s_num_nma_rd++; s_num_cmd_fifo_rd++; s_per_bank_cmd[bank_id].issue_rd++; s_per_bank_rd[bank_id]++; }
-      else if (entry.command == m_dram->m_commands("WR_L"))  { s_num_nma_wr++; s_num_cmd_fifo_wr++; s_per_bank_cmd[bank_id].issue_wr++; s_per_bank_wr[bank_id]++; }
+      if      (entry.command == m_dram->m_ids.cmd.ACT_L) { s_num_nma_act++; s_per_bank_cmd[bank_id].issue_act++; }
+      else if (entry.command == m_dram->m_ids.cmd.PRE_L) { s_num_nma_pre++; s_per_bank_cmd[bank_id].issue_pre++; }
+      else if (entry.command == m_dram->m_ids.cmd.RD_L)  { s_num_nma_rd++; s_num_cmd_fifo_rd++; s_per_bank_cmd[bank_id].issue_rd++; s_per_bank_rd[bank_id]++; }
+      else if (entry.command == m_dram->m_ids.cmd.WR_L)  { s_num_nma_wr++; s_num_cmd_fifo_wr++; s_per_bank_cmd[bank_id].issue_wr++; s_per_bank_wr[bank_id]++; }
       log_cmd_fifo_issue(entry.command, bank_id);
 
-      bool is_pre = (entry.command == m_dram->m_commands("PRE_L"));
-      bool is_rd  = (entry.command == m_dram->m_commands("RD_L"));
+      bool is_pre = (entry.command == m_dram->m_ids.cmd.PRE_L);
+      bool is_rd  = (entry.command == m_dram->m_ids.cmd.RD_L);
 
       // Schedule completion for Return Unit interrupt generation
       if (is_rd) {
         // Read: completion after nCL + nBL (data available in buffer)
         m_pending_reads.push_back({entry.seq_num, m_clk + m_nCL + m_nBL});
-      } else if (entry.command == m_dram->m_commands("WR_L")) {
+      } else if (entry.command == m_dram->m_ids.cmd.WR_L) {
         // Write: mark done immediately in return_buffer (no data return needed)
         for (auto& rb_entry : m_return_buffer) {
           if (rb_entry.seq_num == entry.seq_num) {
@@ -1567,17 +1594,17 @@ class AsyncDIMMNMAController {
       m_dram->issue_command(cmd, req.addr_vec);
       update_fsm_on_nma_command(cmd, req.addr_vec);
 
-      bool is_pre = (cmd == m_dram->m_commands("PRE_L"));
+      bool is_pre = (cmd == m_dram->m_ids.cmd.PRE_L);
 
-      if      (cmd == m_dram->m_commands("ACT_L")) { s_num_nma_act++; }
-      else if (cmd == m_dram->m_commands("PRE_L")) { s_num_nma_pre++; }
-      else if (cmd == m_dram->m_commands("RD_L"))  {
+      if      (cmd == m_dram->m_ids.cmd.ACT_L) { s_num_nma_act++; }
+      else if (cmd == m_dram->m_ids.cmd.PRE_L) { s_num_nma_pre++; }
+      else if (cmd == m_dram->m_ids.cmd.RD_L)  {
         s_num_nma_rd++; s_num_req_fifo_rd++;
         s_per_bank_rd[bank_id]++;
         req.data_pending = true;
         req.data_complete_clk = m_clk + m_nCL + m_nBL;
       }
-      else if (cmd == m_dram->m_commands("WR_L"))  {
+      else if (cmd == m_dram->m_ids.cmd.WR_L)  {
         s_num_nma_wr++; s_num_req_fifo_wr++;
         s_per_bank_wr[bank_id]++;
         req.data_pending = true;
@@ -1866,18 +1893,18 @@ class AsyncDIMMNMAController {
         m_dram->issue_command(req.command, req.addr_vec);
         update_fsm_on_nma_command(req.command, req.addr_vec);
 
-        if (req.command == m_dram->m_commands("ACT_L")) {
+        if (req.command == m_dram->m_ids.cmd.ACT_L) {
           s_num_nma_act++;
-        } else if (req.command == m_dram->m_commands("PRE_L")) {
+        } else if (req.command == m_dram->m_ids.cmd.PRE_L) {
           s_num_nma_pre++;
-        } else if (req.command == m_dram->m_commands("RD_L")) {
+        } else if (req.command == m_dram->m_ids.cmd.RD_L) {
           s_num_nma_rd++; s_num_req_fifo_rd++;
           s_per_bank_rd[bank_id]++;
           // Don't pop — wait for data response (nCL + nBL)
           req.data_pending = true;
           req.data_complete_clk = m_clk + m_nCL + m_nBL;
           m_req_rr_bank_idx = (bank_id + 1) % m_total_banks;
-        } else if (req.command == m_dram->m_commands("WR_L")) {
+        } else if (req.command == m_dram->m_ids.cmd.WR_L) {
           s_num_nma_wr++; s_num_req_fifo_wr++;
           s_per_bank_wr[bank_id]++;
           // Don't pop — wait for write data transfer (nCWL + nBL)
@@ -1917,13 +1944,13 @@ class AsyncDIMMNMAController {
       if (bank.state == BankState::REFRESHING) return -1;
 
       if (bank.state == BankState::CLOSED)
-        return m_dram->m_commands("ACT_L");
+        return m_dram->m_ids.cmd.ACT_L.required();
 
       if (bank.state == BankState::OPENED) {
         if (bank.open_row == req.addr_vec[m_row_level])
           return req.final_command;   // Row hit → RD_L or WR_L
         else
-          return m_dram->m_commands("PRE_L");  // Row conflict
+          return m_dram->m_ids.cmd.PRE_L.required();  // Row conflict
       }
 
       return -1;
@@ -1933,23 +1960,23 @@ class AsyncDIMMNMAController {
      * Update shadow FSM after NMA MC issues a DRAM command.
      */
     void update_fsm_on_nma_command(int command, const AddrVec_t& addr_vec) {
-      if (command == m_dram->m_commands("ACT") || command == m_dram->m_commands("ACT_L")) {
+      if (command == m_dram->m_ids.cmd.ACT || command == m_dram->m_ids.cmd.ACT_L) {
         int flat_id = get_flat_bank_id(addr_vec);
         m_bank_fsm[flat_id].state = BankState::OPENED;
         m_bank_fsm[flat_id].open_row = addr_vec[m_row_level];
       }
-      else if (command == m_dram->m_commands("PRE") || command == m_dram->m_commands("PRE_L")) {
+      else if (command == m_dram->m_ids.cmd.PRE || command == m_dram->m_ids.cmd.PRE_L) {
         int flat_id = get_flat_bank_id(addr_vec);
         m_bank_fsm[flat_id].state = BankState::CLOSED;
         m_bank_fsm[flat_id].open_row = -1;
       }
-      else if (command == m_dram->m_commands("PREA") || command == m_dram->m_commands("PREA_L")) {
+      else if (command == m_dram->m_ids.cmd.PREA || command == m_dram->m_ids.cmd.PREA_L) {
         for (auto& bank : m_bank_fsm) {
           bank.state = BankState::CLOSED;
           bank.open_row = -1;
         }
       }
-      else if (command == m_dram->m_commands("REFab") || command == m_dram->m_commands("REFab_L")) {
+      else if (command == m_dram->m_ids.cmd.REFab || command == m_dram->m_ids.cmd.REFab_L) {
         for (auto& bank : m_bank_fsm) {
           bank.state = BankState::REFRESHING;
           bank.open_row = -1;
@@ -2013,8 +2040,8 @@ class AsyncDIMMNMAController {
         req.addr_vec[m_bank_level]    = slot.inst.bk;
         req.addr_vec[m_row_level]     = target_row;
         req.addr_vec[m_column_level]  = slot.current_col;
-        req.final_command = req.is_read ? m_dram->m_commands("RD_L")
-                                        : m_dram->m_commands("WR_L");
+        req.final_command = req.is_read ? m_dram->m_ids.cmd.RD_L.required()
+                                        : m_dram->m_ids.cmd.WR_L.required();
         req.arrive = m_clk;
 
         fifo.push_back(req);
@@ -2165,7 +2192,7 @@ class AsyncDIMMNMAController {
       ref_addr_vec[m_channel_level] = m_channel_id;
       ref_addr_vec[m_rank_level]    = m_rank_id;
 
-      int ref_cmd = m_dram->m_commands("REFab_L");
+      int ref_cmd = m_dram->m_ids.cmd.REFab_L.required();
       if (m_dram->check_ready(ref_cmd, ref_addr_vec)) {
         m_dram->issue_command(ref_cmd, ref_addr_vec);
         update_fsm_on_nma_command(ref_cmd, ref_addr_vec);
@@ -2190,7 +2217,7 @@ class AsyncDIMMNMAController {
       prea_addr_vec[m_channel_level] = m_channel_id;
       prea_addr_vec[m_rank_level]    = m_rank_id;
 
-      int prea_cmd = m_dram->m_commands("PREA_L");
+      int prea_cmd = m_dram->m_ids.cmd.PREA_L.required();
       if (m_dram->check_ready(prea_cmd, prea_addr_vec)) {
         m_dram->issue_command(prea_cmd, prea_addr_vec);
         update_fsm_on_nma_command(prea_cmd, prea_addr_vec);
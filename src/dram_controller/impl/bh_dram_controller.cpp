@@ -64,10 +64,10 @@ class BHDRAMController final : public IBHDRAMController, public Implementation {
     void setup(IFrontEnd* frontend, IMemorySystem* memory_system) override {
       m_llc = static_cast<BHO3*>(frontend)->get_llc();
       m_dram = memory_system->get_ifce<IDRAM>();
-      m_rank_addr_idx = m_dram->m_levels("rank");
-      m_bankgroup_addr_idx = m_dram->m_levels("bankgroup");
-      m_bank_addr_idx = m_dram->m_levels("bank");
-      m_row_addr_idx = m_dram->m_levels("row");
+      m_rank_addr_idx = m_dram->m_ids.level.rank.required();
+      m_bankgroup_addr_idx = m_dram->m_ids.level.bankgroup.required();
+      m_bank_addr_idx = m_dram->m_ids.level.bank.required();
+      m_row_addr_idx = m_dram->m_ids.level.row.required();
       m_priority_buffer.max_size = 512*3 + 32;
       
       int num_cores = static_cast<BHO3*>(frontend)->get_num_cores();
@@ -161,15 +161,14 @@ class BHDRAMController final : public IBHDRAMController, public Implementation {
         if (req_it->command == req_it->final_command) {
           if (req_it->type_id == Request::Type::Read) {
             req_it->depart = m_clk + m_dram->m_read_latency;
-            pending.push_back(*req_it);
+            pending.push_back(std::move(*req_it));
           } else if (req_it->type_id == Request::Type::Write) {
             // TODO: Add code to update statistics
           }
           buffer->remove(req_it);
         } else {
           if (m_dram->m_command_meta(req_it->command).is_opening) {
-            m_active_buffer.enqueue(*req_it);
-            buffer->remove(req_it);
+            buffer->move_to(req_it, m_active_buffer);
           }
         }
       }
@@ -1,4 +1,6 @@
 #include "dram_controller/controller.h"
+#include "dram_controller/pending_row_index.h"
+#include "dram_controller/pending_write_index.h"
 #include "memory_system/memory_system.h"
 
 //#define PRINT_DB_CNT
@@ -15,10 +17,13 @@ class GenericDRAMController final : public IDRAMController, public Implementatio
     ReqBuffer m_read_buffer;              // Read request buffer
     ReqBuffer m_write_buffer;             // Write request buffer
     ReqBuffer m_prefetched_buffer;        // Prefetched buffer
+    ReqNodePool m_req_nodes;              // The nodes of the removed requests, reused by all buffers of this controller
 
     std::vector<ReqBuffer> m_read_buffers;        // Read requestBuffers Per Rank 
     std::vector<ReqBuffer> m_write_buffers;       // Write request Buffers Per rank
     std::vector<ReqBuffer> m_priority_buffers;    // high-priority requests Buffers Per Rank
+    PendingWriteIndex m_pending_writes;           // The addresses of the requests in the write buffers
+    bool m_write_merging = true;
 
     size_t buf_size = 32;
 
@@ -53,6 +58,8 @@ class GenericDRAMController final : public IDRAMController, public Implementatio
     size_t s_num_read_reqs = 0;
     size_t s_num_write_reqs = 0;
     size_t s_num_other_reqs = 0;
+    size_t s_num_forwarded_reads = 0;   // Reads served from a queued write to the same address
+    size_t s_num_merged_writes = 0;     // Writes merged into a queued write to the same address
     // Per-bank access counters
     std::vector<size_t> s_per_bank_rd;
     std::vector<size_t> s_per_bank_wr;
@@ -116,6 +123,7 @@ class GenericDRAMController final : public IDRAMController, public Implementatio
     std::vector<int> m_open_row;
     std::vector<int> m_pre_open_row;
     std::vector<bool> m_open_row_miss;
+    PendingRowIndex m_pending_rows;       // The rows waiting in the read and write buffers of each bank
     int num_ranks = -1;    
     int num_bankgroups = -1;
     int num_banks = -1;
@@ -132,6 +140,7 @@ class GenericDRAMController final : public IDRAMController, public Implementatio
       m_wr_low_watermark =  param<float>("wr_low_watermark").desc("Threshold for switching back to read mode.").default_val(0.2f);
       m_wr_high_watermark = param<float>("wr_high_watermark").desc("Threshold for switching to write mode.").default_val(0.8f);
       m_adaptive_row_cap = param<size_t>("adaptive_row_cap").desc("Row Buffer Hit Cap for Adaptive Open-Page Policy").default_val(16);      
+      m_write_merging = param<bool>("write_merging").desc("Whether a write to the address of a queued write is merged into it.").default_val(true);
       m_scheduler = create_child_ifce<IScheduler>();
       m_refresh = create_child_ifce<IRefreshManager>();    
       m_rowpolicy = create_child_ifce<IRowPolicy>();    
@@ -147,8 +156,8 @@ class GenericDRAMController final : public IDRAMController, public Implementatio
 
     void setup(IFrontEnd* frontend, IMemorySystem* memory_system) override {
       m_dram = memory_system->get_ifce<IDRAM>();
-      m_bank_addr_idx = m_dram->m_levels("bank");
-      m_rank_addr_idx = m_dram->m_levels("rank");
+      m_bank_addr_idx = m_dram->m_ids.level.bank.required();
+      m_rank_addr_idx = m_dram->m_ids.level.rank.required();
       m_priority_buffer.max_size = 512*3 + 32;
       m_active_buffer.max_size = 32*4;
       m_prefetched_buffer.max_size = 16*4;
@@ -158,10 +167,10 @@ class GenericDRAMController final : public IDRAMController, public Implementatio
       num_ranks = m_dram->get_level_size("rank");  
       num_bankgroups = m_dram->get_level_size("bankgroup");  
       num_banks = m_dram->get_level_size("bank");  
-      rank_idx = m_dram->m_levels("rank");
-      bankgroup_idx = m_dram->m_levels("bankgroup");
-      bank_idx = m_dram->m_levels("bank"); 
-      row_idx = m_dram->m_levels("row"); 
+      rank_idx = m_dram->m_ids.level.rank.required();
+      bankgroup_idx = m_dram->m_ids.level.bankgroup.required();
+      bank_idx = m_dram->m_ids.level.bank.required(); 
+      row_idx = m_dram->m_ids.level.row.required(); 
       // std::cout<<m_active_buffer.max_size<<std::endl;
       // exit(1);
 
@@ -193,6 +202,8 @@ class GenericDRAMController final : public IDRAMController, public Implementatio
       register_stat(s_num_read_reqs).name("num_read_reqs_{}", m_channel_id);
       register_stat(s_num_write_reqs).name("num_write_reqs_{}", m_channel_id);
       register_stat(s_num_other_reqs).name("num_other_reqs_{}", m_channel_id);
+      register_stat(s_num_forwarded_reads).name("num_forwarded_reads_{}", m_channel_id);
+      register_stat(s_num_merged_writes).name("num_merged_writes_{}", m_channel_id);
       register_stat(s_queue_len).name("queue_len_{}", m_channel_id);
       register_stat(s_read_queue_len).name("read_queue_len_{}", m_channel_id);
       register_stat(s_write_queue_len).name("write_queue_len_{}", m_channel_id);
@@ -243,6 +254,16 @@ class GenericDRAMController final : public IDRAMController, public Implementatio
         rr_rk_idx.push_back(i);
         register_stat(s_num_refresh_cc_per_rank[i]).name("s_num_refresh_cc_per_rank_{}_{}", m_channel_id,i);      
       }
+      m_pending_writes.reserve(m_num_rank * (buf_size + 1));
+
+      for (ReqBuffer* buffer : {&m_active_buffer, &m_priority_buffer, &m_read_buffer, &m_write_buffer, &m_prefetched_buffer}) {
+        buffer->set_node_pool(&m_req_nodes);
+      }
+      for (auto* buffers : {&m_read_buffers, &m_write_buffers, &m_priority_buffers}) {
+        for (ReqBuffer& buffer : *buffers) {
+          buffer.set_node_pool(&m_req_nodes);
+        }
+      }
 
       #ifdef PRINT_DB_CNT
       s_rdwr_cnt.resize(m_num_rank,0);
@@ -264,6 +285,30 @@ class GenericDRAMController final : public IDRAMController, public Implementatio
       m_open_row.resize(num_ranks*num_bankgroups*num_banks, -1);
       m_pre_open_row.resize(num_ranks*num_bankgroups*num_banks, -1);
       m_open_row_miss.resize(num_ranks*num_bankgroups*num_banks, false);
+      m_pending_rows.resize(num_ranks*num_bankgroups*num_banks);
+    };
+
+    void serialize(Archive& ar) override {
+      ar & m_clk & pending;
+      ar & m_active_buffer & m_priority_buffer & m_read_buffer & m_write_buffer & m_prefetched_buffer;
+      ar & m_read_buffers & m_write_buffers & m_priority_buffers;
+      ar & m_is_write_mode & m_is_write_mode_per_rank & is_empty_priority_per_rank & rr_rk_idx;
+      ar & psuedo_ch_idx & db_prefetch_cnt_per_pch & db_prefetch_rd_cnt_per_pch & db_prefetch_wr_cnt_per_pch;
+      ar & s_per_bank_rd & s_per_bank_wr & pre_clk;
+      ar & m_host_access_cnt & m_tcore_host_access_cnt;
+      ar & m_host_acceess_rec_counter & m_host_acceess_iss_counter;
+      ar & m_host_rd_acceess_rec_counter & m_host_rd_acceess_iss_counter;
+      #ifdef PRINT_DB_CNT
+      ar & s_rdwr_cnt & s_idle_cnt & s_busy_cnt;
+      ar & s_idle_interval_10_cnt & s_idle_interval_100_cnt & s_idle_interval_250_cnt;
+      ar & s_idle_interval_500_cnt & s_idle_interval_1000_cnt & s_idle_interval_over_1000_cnt;
+      #endif
+      ar & m_open_row & m_pre_open_row & m_open_row_miss;
+      ar & s_num_forwarded_reads & s_num_merged_writes;
+      if (ar.is_loading()) {
+        rebuild_pending_indices();
+      }
+      ar & m_lat_vec;
     };
 
     bool send(Request& req) override {
@@ -273,20 +318,22 @@ class GenericDRAMController final : public IDRAMController, public Implementatio
 
       // Forward existing write requests to incoming read requests
       if (req.type_id == Request::Type::Read) {
-        // lamda function 
-        auto compare_addr = [req](const Request& wreq) {
-          return wreq.addr == req.addr;
-        };
         // if existing write request which is same address with read, send to pending request queue
-        ReqBuffer& wr_buffer = m_write_buffers[req.addr_vec[m_rank_addr_idx]];    
-        if (std::find_if(m_write_buffer.begin(), m_write_buffer.end(), compare_addr) != m_write_buffer.end()) {
+        if (m_pending_writes.contains(req.addr)) {
           // The request will depart at the next cycle
           req.arrive = m_clk;
           req.depart = m_clk + 1;
           pending.push_back(req);
           is_success_forwarding = true;
+          s_num_forwarded_reads++;
           // return true;
         }
+      } else if (req.type_id == Request::Type::Write && m_write_merging) {
+        // if existing write request which is same address with write, the queued one writes the new data
+        if (m_pending_writes.contains(req.addr)) {
+          is_success_forwarding = true;
+          s_num_merged_writes++;
+        }
       }
 
       // Else, enqueue them to corresponding buffer based on request type id
@@ -301,6 +348,12 @@ class GenericDRAMController final : public IDRAMController, public Implementatio
         } else {
           throw std::runtime_error("Invalid request type!");
         }
+        if (is_success) {
+          m_pending_rows.add(get_flat_bank_id(req.addr_vec), req.addr_vec[row_idx]);
+          if (req.type_id == Request::Type::Write) {
+            m_pending_writes.add(req.addr);
+          }
+        }
 
         #ifdef PRINT_DB_CNT
         if(is_success || is_success_forwarding) {
@@ -336,6 +389,29 @@ class GenericDRAMController final : public IDRAMController, public Implementatio
       return is_success || is_success_forwarding;
     };
 
+    void functional_access(Request& req) override {
+      // Issue the prerequisite commands (e.g., PRE, ACT) until the final one, without timing.
+      // A bank can need at most a PRE and an ACT, so the loop is bounded.
+      req.final_command = m_dram->m_request_translations(req.type_id);
+      for (int i = 0; i < 4; i++) {
+        int command = m_dram->get_preq_command(req.final_command, req.addr_vec);
+        m_dram->functional_issue_command(command, req.addr_vec);
+        track_open_row(command, req.addr_vec);
+        for (auto plugin : m_plugins) {
+          plugin->functional_update(command, req.addr_vec);
+        }
+        if (command == req.final_command) {
+          break;
+        }
+      }
+    };
+
+    void check_functional_access() override {
+      for (auto plugin : m_plugins) {
+        plugin->check_functional_access();
+      }
+    };
+
     bool priority_send(Request& req) override {
       req.final_command = m_dram->m_request_translations(req.type_id);
 
@@ -346,6 +422,7 @@ class GenericDRAMController final : public IDRAMController, public Implementatio
     }
 
     void tick() override {
+      RAMULATOR_PROFILE_SCOPE();
       m_clk++;
 
       // Update statistics
@@ -373,29 +450,31 @@ class GenericDRAMController final : public IDRAMController, public Implementatio
       }
       #endif
 
-      // Update Each Row Cap       
-      for(int rk_id=0;rk_id<(num_ranks);rk_id++) {
-        auto rd_buffer = m_read_buffers[rk_id];
-        for (auto next = std::next(rd_buffer.begin(), 1); next != rd_buffer.end(); next++) {          
-          int flat_bank_id = next->addr_vec[bank_idx] + next->addr_vec[bankgroup_idx] * num_banks + next->addr_vec[rank_idx] * num_bankgroups*num_banks;          
-          if((m_open_row[flat_bank_id] != -1) && (m_open_row[flat_bank_id] != next->addr_vec[row_idx])) {
-            // Update Cap 
-            m_open_row_miss[flat_bank_id] = true;
-            m_scheduler->update_open_row_miss(flat_bank_id,true);
-            m_rowpolicy->update_cap(0,next->addr_vec[rank_idx],next->addr_vec[bankgroup_idx],next->addr_vec[bank_idx],m_adaptive_row_cap);
-          } 
-        }
-        auto wr_buffer = m_write_buffers[rk_id];
-        for (auto next = std::next(wr_buffer.begin(), 1); next != wr_buffer.end(); next++) {          
-          int flat_bank_id = next->addr_vec[bank_idx] + next->addr_vec[bankgroup_idx] * num_banks + next->addr_vec[rank_idx] * num_bankgroups*num_banks;          
-          if((m_open_row[flat_bank_id] != -1) && (m_open_row[flat_bank_id] != next->addr_vec[row_idx])) {
-            // Update Cap 
-            m_open_row_miss[flat_bank_id] = true;
-            m_scheduler->update_open_row_miss(flat_bank_id,true);
-            m_rowpolicy->update_cap(0,next->addr_vec[rank_idx],next->addr_vec[bankgroup_idx],next->addr_vec[bank_idx],m_adaptive_row_cap);
-          } 
-        }
-      }      
+      // Update Each Row Cap: an open bank with a request waiting for another row gets the adaptive cap.
+      // Only the banks whose waiting requests or open row changed since the last cycle can change.
+      m_pending_rows.for_each_dirty([this](int flat_bank_id) {
+        int open_row = m_open_row[flat_bank_id];
+        if (open_row == -1) {
+          return;
+        }
+        int rk_id = flat_bank_id / (num_bankgroups * num_banks);
+        int num_other_row_reqs = m_pending_rows.num_reqs(flat_bank_id) - m_pending_rows.num_reqs(flat_bank_id, open_row);
+        // The request at the head of each buffer does not count
+        for (ReqBuffer* buffer : {&m_read_buffers[rk_id], &m_write_buffers[rk_id]}) {
+          if (buffer->size() != 0 && get_flat_bank_id(buffer->begin()->addr_vec) == flat_bank_id &&
+              buffer->begin()->addr_vec[row_idx] != open_row) {
+            num_other_row_reqs--;
+          }
+        }
+        if (num_other_row_reqs > 0) {
+          // Update Cap 
+          int bg_id = (flat_bank_id / num_banks) % num_bankgroups;
+          int bk_id = flat_bank_id % num_banks;
+          m_open_row_miss[flat_bank_id] = true;
+          m_scheduler->update_open_row_miss(flat_bank_id,true);
+          m_rowpolicy->update_cap(0,rk_id,bg_id,bk_id,m_adaptive_row_cap);
+        }
+      });
 
 
       // 1. Serve completed reads
@@ -427,67 +506,29 @@ class GenericDRAMController final : public IDRAMController, public Implementatio
         m_dram->issue_command(req_it->command, req_it->addr_vec);
 
         
-        if(req_it->command == m_dram->m_commands("RD") || req_it->command == m_dram->m_commands("RDA")) {
+        if(req_it->command == m_dram->m_ids.cmd.RD || req_it->command == m_dram->m_ids.cmd.RDA) {
           s_num_issue_reads++;
           int fbi = req_it->addr_vec[bank_idx] + req_it->addr_vec[bankgroup_idx] * num_banks + req_it->addr_vec[rank_idx] * num_bankgroups * num_banks;
           if (fbi >= 0 && fbi < (int)s_per_bank_rd.size()) s_per_bank_rd[fbi]++;
         }
-        if(req_it->command == m_dram->m_commands("WR") || req_it->command == m_dram->m_commands("WRA")) {
+        if(req_it->command == m_dram->m_ids.cmd.WR || req_it->command == m_dram->m_ids.cmd.WRA) {
           s_num_issue_writes++;
           int fbi = req_it->addr_vec[bank_idx] + req_it->addr_vec[bankgroup_idx] * num_banks + req_it->addr_vec[rank_idx] * num_bankgroups * num_banks;
           if (fbi >= 0 && fbi < (int)s_per_bank_wr.size()) s_per_bank_wr[fbi]++;
         }
 
-        if(req_it->command == m_dram->m_commands("REFab")) {
-          int nRFC_latency = m_dram->m_timing_vals("nRFC1");
+        if(req_it->command == m_dram->m_ids.cmd.REFab) {
+          int nRFC_latency = m_dram->m_timing_vals(m_dram->m_ids.timing.nRFC1.required());
           int rank_addr = req_it->addr_vec[m_rank_addr_idx];
           s_num_refresh_cc_per_rank[rank_addr]+=nRFC_latency;
         }
 
-        if(req_it->command == m_dram->m_commands("ACT")) {
-          int flat_bank_id = req_it->addr_vec[bank_idx] + req_it->addr_vec[bankgroup_idx] * num_banks + req_it->addr_vec[rank_idx] * num_bankgroups*num_banks;          
-          m_open_row_miss[flat_bank_id] = false;
-          m_open_row[flat_bank_id] = req_it->addr_vec[row_idx];
-          m_pre_open_row[flat_bank_id] = -1;
-          m_scheduler->update_open_row_miss(flat_bank_id,false); 
-          m_scheduler->update_open_row(flat_bank_id,req_it->addr_vec[row_idx]);
-          m_scheduler->update_pre_open_row(flat_bank_id,-1);
-          m_scheduler->update_bk_status(flat_bank_id,false);
-          m_rowpolicy->update_cap(0,req_it->addr_vec[rank_idx],req_it->addr_vec[bankgroup_idx],req_it->addr_vec[bank_idx],128);          
-        }
-        else if(req_it->command == m_dram->m_commands("PRE")) {
-          int flat_bank_id = req_it->addr_vec[bank_idx] + req_it->addr_vec[bankgroup_idx] * num_banks + req_it->addr_vec[rank_idx] * num_bankgroups*num_banks;          
-          m_pre_open_row[flat_bank_id] = m_open_row[flat_bank_id];
-          m_open_row[flat_bank_id] = -1;          
-          m_scheduler->update_open_row(flat_bank_id,-1);
-          m_scheduler->update_pre_open_row(flat_bank_id,m_pre_open_row[flat_bank_id]);   
-          m_scheduler->update_bk_status(flat_bank_id,true);       
-        } else if(req_it->command == m_dram->m_commands("PREA")) {
-          // Reset All Bank in the Rank
-          int rank_id = req_it->addr_vec[rank_idx];
-          for(int bg_idx=0;bg_idx<num_bankgroups; bg_idx++) {
-            for(int bk_idx=0;bk_idx<num_banks; bk_idx++) {
-              int flat_bank_id = bk_idx + bg_idx * num_banks + rank_id * num_bankgroups*num_banks;       
-              m_pre_open_row[flat_bank_id] = m_open_row[flat_bank_id];   
-              m_open_row[flat_bank_id] = -1;
-              m_scheduler->update_open_row(flat_bank_id,-1);
-              m_scheduler->update_pre_open_row(flat_bank_id,m_pre_open_row[flat_bank_id]);        
-              m_scheduler->update_bk_status(flat_bank_id,true);       
-            }          
-          }
-        }
+        track_open_row(req_it->command, req_it->addr_vec);
 
         // If we are issuing the last command, set depart clock cycle and move the request to the pending queue
         if (req_it->command == req_it->final_command) {
-          if (req_it->type_id == Request::Type::Read) {
-            req_it->depart = m_clk + m_dram->m_read_latency;
-            pending.push_back(*req_it);
-          } else if (req_it->type_id == Request::Type::Write) {
-            // TODO: Add code to update statistics
-          }
-          
-          if(req_it->command == m_dram->m_commands("RD")  || req_it->command == m_dram->m_commands("RDA") ||
-             req_it->command == m_dram->m_commands("WR")  || req_it->command == m_dram->m_commands("WRA")) {
+          if(req_it->command == m_dram->m_ids.cmd.RD  || req_it->command == m_dram->m_ids.cmd.RDA ||
+             req_it->command == m_dram->m_ids.cmd.WR  || req_it->command == m_dram->m_ids.cmd.WRA) {
               m_host_access_cnt++;
               if(req_it->is_trace_core_req) {
                 m_tcore_host_access_cnt++;
@@ -502,16 +543,23 @@ class GenericDRAMController final : public IDRAMController, public Implementatio
           #ifdef PRINT_DB_CNT
           s_rdwr_cnt[req_it->addr_vec[m_rank_addr_idx]]--;
           #endif
+          // Everything that reads the request is done before it is moved to the pending queue
+          untrack_request(buffer, req_it);
+          if (req_it->type_id == Request::Type::Read) {
+            req_it->depart = m_clk + m_dram->m_read_latency;
+            pending.push_back(std::move(*req_it));
+          } else if (req_it->type_id == Request::Type::Write) {
+            // TODO: Add code to update statistics
+          }
           buffer->remove(req_it);
         } else {
           if (m_dram->m_command_meta(req_it->command).is_opening) {
             bool is_success = false;
             req_it->is_actived = true;
-            is_success = m_active_buffer.enqueue(*req_it);
+            is_success = move_request(buffer, req_it, m_active_buffer);
             if(!is_success) {
               throw std::runtime_error("Fail to enque to m_active_buffer");
             }
-            buffer->remove(req_it);
           }
         }
 
@@ -519,8 +567,147 @@ class GenericDRAMController final : public IDRAMController, public Implementatio
 
     };
 
+    Clk_t get_next_event_clk() override {
+      // Any queued request (or a rank that still has to switch to write mode) keeps the controller busy
+      if (m_active_buffer.size() != 0) {
+        return m_clk + 1;
+      }
+      for (int rk_idx = 0; rk_idx < m_num_rank; rk_idx++) {
+        if (m_read_buffers[rk_idx].size() != 0 || m_write_buffers[rk_idx].size() != 0 ||
+            m_priority_buffers[rk_idx].size() != 0 || !m_is_write_mode_per_rank[rk_idx]) {
+          return m_clk + 1;
+        }
+      }
+
+      // Otherwise, only a completing read or a refresh can change the state
+      Clk_t next_clk = m_refresh->get_next_event_clk();
+      if (pending.size()) {
+        next_clk = std::min(next_clk, (Clk_t)pending[0].depart);
+      }
+      next_clk = std::min(next_clk, m_rowpolicy->get_next_event_clk());
+      for (auto plugin : m_plugins) {
+        next_clk = std::min(next_clk, plugin->get_next_event_clk());
+      }
+      return next_clk;
+    };
+
+    void fast_forward(Clk_t clk) override {
+      if (clk <= m_clk) {
+        return;
+      }
+      size_t num_idle_cycles = clk - m_clk;
+      m_clk = clk;
+
+      // Queue lengths are constant over idle cycles
+      s_queue_len += num_idle_cycles * (m_read_buffer.size() + m_write_buffer.size() + m_priority_buffer.size() + pending.size());
+      s_read_queue_len += num_idle_cycles * (m_read_buffer.size() + pending.size());
+      s_write_queue_len += num_idle_cycles * m_write_buffer.size();
+      s_priority_queue_len += num_idle_cycles * m_priority_buffer.size();
+
+      #ifdef PRINT_DB_CNT
+      // All request buffers are empty, so every rank is idle
+      for(int rk=0;rk<m_num_rank;rk++) {
+        s_idle_cnt[rk] += num_idle_cycles;
+      }
+      #endif
+
+      m_refresh->fast_forward(clk);
+      m_rowpolicy->fast_forward(clk);
+      for (auto plugin : m_plugins) {
+        plugin->fast_forward(clk);
+      }
+    };
+
 
   private:
+    int get_flat_bank_id(const AddrVec_t& addr_vec) const {
+      return addr_vec[bank_idx] + addr_vec[bankgroup_idx] * num_banks + addr_vec[rank_idx] * num_bankgroups*num_banks;
+    }
+
+    /**
+     * @brief    Removes a request from the pending-row and pending-write indices if it leaves a read/write buffer
+     */
+    void untrack_request(ReqBuffer* buffer, ReqBuffer::iterator req_it) {
+      int rk_id = req_it->addr_vec[m_rank_addr_idx];
+      if (rk_id < 0) {
+        return;
+      }
+      if (buffer == &m_read_buffers[rk_id] || buffer == &m_write_buffers[rk_id]) {
+        m_pending_rows.remove(get_flat_bank_id(req_it->addr_vec), req_it->addr_vec[row_idx]);
+      }
+      if (buffer == &m_write_buffers[rk_id]) {
+        m_pending_writes.remove(req_it->addr);
+      }
+    }
+
+    /**
+     * @brief    Moves a request to another buffer without copying it
+     */
+    bool move_request(ReqBuffer* buffer, ReqBuffer::iterator req_it, ReqBuffer& dst) {
+      if (!buffer->move_to(req_it, dst)) {
+        return false;
+      }
+      untrack_request(buffer, req_it);
+      return true;
+    }
+
+    void rebuild_pending_indices() {
+      m_pending_rows.clear();
+      m_pending_writes.clear();
+      for (int rk_id = 0; rk_id < m_num_rank; rk_id++) {
+        for (ReqBuffer* buffer : {&m_read_buffers[rk_id], &m_write_buffers[rk_id]}) {
+          for (const Request& req : *buffer) {
+            m_pending_rows.add(get_flat_bank_id(req.addr_vec), req.addr_vec[row_idx]);
+          }
+        }
+        for (const Request& req : m_write_buffers[rk_id]) {
+          m_pending_writes.add(req.addr);
+        }
+      }
+      m_pending_rows.mark_all_dirty();
+    }
+
+    /**
+     * @brief    Helper function to track the open row of each bank (for the adaptive open-page policy)
+     * @details
+     * 
+     */
+    void track_open_row(int command, const AddrVec_t& addr_vec) {
+      if(command == m_dram->m_ids.cmd.ACT) {
+        int flat_bank_id = addr_vec[bank_idx] + addr_vec[bankgroup_idx] * num_banks + addr_vec[rank_idx] * num_bankgroups*num_banks;          
+        m_open_row_miss[flat_bank_id] = false;
+        m_open_row[flat_bank_id] = addr_vec[row_idx];
+        m_pending_rows.mark_dirty(flat_bank_id);
+        m_pre_open_row[flat_bank_id] = -1;
+        m_scheduler->update_open_row_miss(flat_bank_id,false); 
+        m_scheduler->update_open_row(flat_bank_id,addr_vec[row_idx]);
+        m_scheduler->update_pre_open_row(flat_bank_id,-1);
+        m_scheduler->update_bk_status(flat_bank_id,false);
+        m_rowpolicy->update_cap(0,addr_vec[rank_idx],addr_vec[bankgroup_idx],addr_vec[bank_idx],128);          
+      }
+      else if(command == m_dram->m_ids.cmd.PRE) {
+        int flat_bank_id = addr_vec[bank_idx] + addr_vec[bankgroup_idx] * num_banks + addr_vec[rank_idx] * num_bankgroups*num_banks;          
+        m_pre_open_row[flat_bank_id] = m_open_row[flat_bank_id];
+        m_open_row[flat_bank_id] = -1;          
+        m_scheduler->update_open_row(flat_bank_id,-1);
+        m_scheduler->update_pre_open_row(flat_bank_id,m_pre_open_row[flat_bank_id]);   
+        m_scheduler->update_bk_status(flat_bank_id,true);       
+      } else if(command == m_dram->m_ids.cmd.PREA) {
+        // Reset All Bank in the Rank
+        int rank_id = addr_vec[rank_idx];
+        for(int bg_idx=0;bg_idx<num_bankgroups; bg_idx++) {
+          for(int bk_idx=0;bk_idx<num_banks; bk_idx++) {
+            int flat_bank_id = bk_idx + bg_idx * num_banks + rank_id * num_bankgroups*num_banks;       
+            m_pre_open_row[flat_bank_id] = m_open_row[flat_bank_id];   
+            m_open_row[flat_bank_id] = -1;
+            m_scheduler->update_open_row(flat_bank_id,-1);
+            m_scheduler->update_pre_open_row(flat_bank_id,m_pre_open_row[flat_bank_id]);        
+            m_scheduler->update_bk_status(flat_bank_id,true);       
+          }          
+        }
+      }
+    }
+
     /**
      * @brief    Helper function to check if a request is hitting an open row
      * @details
@@ -611,7 +798,7 @@ class GenericDRAMController final : public IDRAMController, public Implementatio
 
           if (req.callback) {
             // If the request comes from outside (e.g., processor), call its callback
-            req.callback(req);
+            complete_request(req);
           }
           // Finally, remove this request from the pending queue
           pending.pop_front();
@@ -683,7 +870,7 @@ class GenericDRAMController final : public IDRAMController, public Implementatio
       // 2.1    First, check the act buffer to serve requests that are already activating (avoid useless ACTs)
       // what is active_buffer? (opened row requesst?)
       if (req_it= m_scheduler->get_best_request(m_active_buffer); req_it != m_active_buffer.end()) {
-        if (m_dram->check_ready(req_it->command, req_it->addr_vec)) {
+        if (m_dram->check_ready(*req_it)) {
           request_found = true;
           req_buffer = &m_active_buffer;
         }
@@ -698,7 +885,7 @@ class GenericDRAMController final : public IDRAMController, public Implementatio
             req_it = m_priority_buffers[rk_idx].begin();
             req_it->command = m_dram->get_preq_command(req_it->final_command, req_it->addr_vec);
             
-            request_found = m_dram->check_ready(req_it->command, req_it->addr_vec);
+            request_found = m_dram->check_ready(*req_it);
 
             if(request_found) break;
             // if (!request_found & m_priority_buffer.size() != 0) {
@@ -715,7 +902,7 @@ class GenericDRAMController final : public IDRAMController, public Implementatio
             if(is_empty_priority_per_rank[rk_idx]) {
               auto& buffer = m_is_write_mode_per_rank[rk_idx] ? m_write_buffers[rk_idx] : m_read_buffers[rk_idx];
               if (req_it = m_scheduler->get_best_request(buffer); req_it != buffer.end()) {
-                request_found = m_dram->check_ready(req_it->command, req_it->addr_vec);
+                request_found = m_dram->check_ready(*req_it);
                 req_buffer = &buffer;
               }
               if(request_found) break;
@@ -726,7 +913,7 @@ class GenericDRAMController final : public IDRAMController, public Implementatio
           set_write_mode();
           auto& buffer = m_is_write_mode ? m_write_buffer : m_read_buffer;
           if (req_it = m_scheduler->get_best_request(buffer); req_it != buffer.end()) {
-            request_found = m_dram->check_ready(req_it->command, req_it->addr_vec);
+            request_found = m_dram->check_ready(*req_it);
             req_buffer = &buffer;
           }
           */
@@ -767,7 +954,7 @@ class GenericDRAMController final : public IDRAMController, public Implementatio
       s_priority_queue_len_avg = (float) s_priority_queue_len / (float) m_clk;
 
       // Per-bank access distribution
-      std::cout << "  === Per-Bank Access Distribution (Ch " << m_channel_id << ") ===" << std::endl;
+      report_stream() << "  === Per-Bank Access Distribution (Ch " << m_channel_id << ") ===" << std::endl;
       for (int bk = 0; bk < num_banks; bk++) {
         size_t bk_rd = 0, bk_wr = 0;
         for (int rk = 0; rk < num_ranks; rk++)
@@ -776,11 +963,11 @@ class GenericDRAMController final : public IDRAMController, public Implementatio
             bk_rd += s_per_bank_rd[flat];
             bk_wr += s_per_bank_wr[flat];
           }
-        std::cout << "  BK" << bk << ": RD=" << bk_rd << " WR=" << bk_wr
-                  << " total=" << (bk_rd + bk_wr) << std::endl;
+        report_stream() << "  BK" << bk << ": RD=" << bk_rd << " WR=" << bk_wr
+                        << " total=" << (bk_rd + bk_wr) << std::endl;
       }
       // Per-bankgroup access distribution
-      std::cout << "  === Per-BankGroup Access Distribution (Ch " << m_channel_id << ") ===" << std::endl;
+      report_stream() << "  === Per-BankGroup Access Distribution (Ch " << m_channel_id << ") ===" << std::endl;
       for (int bg = 0; bg < num_bankgroups; bg++) {
         size_t bg_rd = 0, bg_wr = 0;
         for (int rk = 0; rk < num_ranks; rk++)
@@ -789,29 +976,29 @@ class GenericDRAMController final : public IDRAMController, public Implementatio
             bg_rd += s_per_bank_rd[flat];
             bg_wr += s_per_bank_wr[flat];
           }
-        std::cout << "  BG" << bg << ": RD=" << bg_rd << " WR=" << bg_wr
-                  << " total=" << (bg_rd + bg_wr) << std::endl;
+        report_stream() << "  BG" << bg << ": RD=" << bg_rd << " WR=" << bg_wr
+                        << " total=" << (bg_rd + bg_wr) << std::endl;
       }
 
       // GB/s 
       // Request Bandwidth, DQ Bandwidth, Max DQ Bandwidth
       int tx_bytes = m_dram->m_internal_prefetch_size * m_dram->m_channel_width / 8;
-      s_bandwidth = ((float)((s_num_read_reqs + s_num_write_reqs) * tx_bytes) / (float)(m_clk * m_dram->m_timing_vals("tCK_ps"))) * 1E12 / (1024*1024*1012);
-      s_dq_bandwidth = ((float)((s_num_issue_reads + s_num_issue_writes) * tx_bytes) / (float)(m_clk * m_dram->m_timing_vals("tCK_ps"))) * 1E12 / (1024*1024*1012);
+      s_bandwidth = ((float)((s_num_read_reqs + s_num_write_reqs) * tx_bytes) / (float)(m_clk * m_dram->m_timing_vals(m_dram->m_ids.timing.tCK_ps.required()))) * 1E12 / (1024*1024*1012);
+      s_dq_bandwidth = ((float)((s_num_issue_reads + s_num_issue_writes) * tx_bytes) / (float)(m_clk * m_dram->m_timing_vals(m_dram->m_ids.timing.tCK_ps.required()))) * 1E12 / (1024*1024*1012);
       // rate unit is MT/s 
       // 10^6 T/s --> /(2^30) GB/s
-      s_max_bandwidth = (float)(m_dram->m_channel_width / 8) * (float)m_dram->m_timing_vals("rate") * 1E6 / (1024*1024*1012);      
+      s_max_bandwidth = (float)(m_dram->m_channel_width / 8) * (float)m_dram->m_timing_vals(m_dram->m_ids.timing.rate.required()) * 1E6 / (1024*1024*1012);      
     
       #ifdef PRINT_DB_CNT
       for(int rk=0;rk<m_num_rank;rk++) {
-        std::cout<<" Rank ["<<rk<<"] Idle Time Breakdown (%)"<<std::endl;
-        std::cout<<"    - Busy           : "<<(100.0 * float(s_busy_cnt[rk]) / float(m_clk))<<std::endl;
-        std::cout<<"    - IDLE(1_10)     : "<<(100.0 * float(s_idle_interval_10_cnt[rk]) / float(m_clk))<<std::endl;
-        std::cout<<"    - IDLE(10_100)   : "<<(100.0 * float(s_idle_interval_100_cnt[rk]) / float(m_clk))<<std::endl;
-        std::cout<<"    - IDLE(100_250)  : "<<(100.0 * float(s_idle_interval_250_cnt[rk]) / float(m_clk))<<std::endl;
-        std::cout<<"    - IDLE(250_500)  : "<<(100.0 * float(s_idle_interval_500_cnt[rk]) / float(m_clk))<<std::endl;
-        std::cout<<"    - IDLE(500_1000) : "<<(100.0 * float(s_idle_interval_1000_cnt[rk]) / float(m_clk))<<std::endl;
-        std::cout<<"    - IDLE(1000) -   : "<<(100.0 * float(s_idle_interval_over_1000_cnt[rk]) / float(m_clk))<<std::endl;
+        report_stream()<<" Rank ["<<rk<<"] Idle Time Breakdown (%)"<<std::endl;
+        report_stream()<<"    - Busy           : "<<(100.0 * float(s_busy_cnt[rk]) / float(m_clk))<<std::endl;
+        report_stream()<<"    - IDLE(1_10)     : "<<(100.0 * float(s_idle_interval_10_cnt[rk]) / float(m_clk))<<std::endl;
+        report_stream()<<"    - IDLE(10_100)   : "<<(100.0 * float(s_idle_interval_100_cnt[rk]) / float(m_clk))<<std::endl;
+        report_stream()<<"    - IDLE(100_250)  : "<<(100.0 * float(s_idle_interval_250_cnt[rk]) / float(m_clk))<<std::endl;
+        report_stream()<<"    - IDLE(250_500)  : "<<(100.0 * float(s_idle_interval_500_cnt[rk]) / float(m_clk))<<std::endl;
+        report_stream()<<"    - IDLE(500_1000) : "<<(100.0 * float(s_idle_interval_1000_cnt[rk]) / float(m_clk))<<std::endl;
+        report_stream()<<"    - IDLE(1000) -   : "<<(100.0 * float(s_idle_interval_over_1000_cnt[rk]) / float(m_clk))<<std::endl;
       }
       #endif
       return;
@@ -868,6 +1055,9 @@ class GenericDRAMController final : public IDRAMController, public Implementatio
       return s_read_latency;
     }    
 
+    uint64_t get_row_hit_counter() override { return s_row_hits; }
+    uint64_t get_row_access_counter() override { return s_row_hits + s_row_misses + s_row_conflicts; }
+
     std::vector<uint64_t> get_counters() override {
       std::vector<uint64_t> v;
       v.reserve(2);
@@ -30,6 +30,7 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
     std::vector<ReqBuffer> m_priority_buffers;    // high-priority requests Buffers Per Pseudo Channel    
     std::vector<ReqBuffer> m_rd_prefetch_buffers; // Read Prefetch Buffers (D2PA Buffer) Per Pseudo Channel    
     std::vector<ReqBuffer> m_wr_prefetch_buffers; // Write Prefetch Buffers (D2PA Buffer) Per Pseudo Channel    
+    ReqNodePool m_req_nodes;                      // The nodes of the removed requests, reused by all buffers of this controller
 
     std::vector<std::vector<std::pair<Request, int>>> m_to_rd_prefetch_buffers;
     std::vector<std::vector<std::pair<Request, int>>> m_to_wr_prefetch_buffers;
@@ -334,36 +335,7 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
 
     size_t buf_size = 32;
 
-    struct CmdIds {
-      int ACT = -1;
-      int P_ACT = -1;
-      int PRE = -1;
-      int PREA = -1;
-      int PREsb = -1;
-      int P_PRE = -1;
-      int RD = -1;
-      int WR = -1;
-      int RDA = -1;
-      int WRA = -1;
-      int PRE_RD = -1;
-      int PRE_WR = -1;
-      int POST_RD = -1;
-      int POST_WR = -1;
-      int PRE_RDA = -1;
-      int POST_WRA = -1;
-      int NDP_DRAM_RD = -1;
-      int NDP_DRAM_WR = -1;
-      int NDP_DRAM_RDA = -1;
-      int NDP_DRAM_WRA = -1;
-      int NDP_DB_RD = -1;
-      int NDP_DB_WR = -1;
-      int REFab = -1;
-      int REFsb = -1;
-      int REFab_end = -1;
-      int REFsb_end = -1;
-    };    
-
-    CmdIds m_cmds;
+    SpecIds::Commands m_cmds;
 
     // Memory Request Counter for Memory-System 
     uint64_t m_host_db_host_access_cnt;
@@ -474,7 +446,7 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
 
     void setup(IFrontEnd* frontend, IMemorySystem* memory_system) override {
       m_dram = memory_system->get_ifce<IDRAM>();
-      m_bank_addr_idx = m_dram->m_levels("bank");
+      m_bank_addr_idx = m_dram->m_ids.level.bank.required();
       m_priority_buffer.max_size = 512*3 + 32;
       m_active_buffer.max_size = 32*4;
       // m_prefetched_buffer.max_size = 16*4;
@@ -484,11 +456,11 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
       if(m_dram->get_level_size("pseudochannel") == -1) use_pseudo_ch = false;
       else                                              use_pseudo_ch = true;
 
-      ch_idx = m_dram->m_levels("channel");
-      psuedo_ch_idx = m_dram->m_levels("pseudochannel");
-      bankgroup_idx = m_dram->m_levels("bankgroup");
-      bank_idx = m_dram->m_levels("bank");
-      row_idx = m_dram->m_levels("row");
+      ch_idx = m_dram->m_ids.level.channel.required();
+      psuedo_ch_idx = m_dram->m_ids.level.pseudochannel.required();
+      bankgroup_idx = m_dram->m_ids.level.bankgroup.required();
+      bank_idx = m_dram->m_ids.level.bank.required();
+      row_idx = m_dram->m_ids.level.row.required();
 
       m_use_prefetch = m_dram->get_use_prefetch();
 
@@ -614,6 +586,14 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
         m_wr_prefetch_buffers[i].max_size = 8;
         rr_pch_idx.push_back(i);
       }
+      for (ReqBuffer* buffer : {&m_active_buffer, &m_priority_buffer}) {
+        buffer->set_node_pool(&m_req_nodes);
+      }
+      for (auto* buffers : {&m_read_buffers, &m_write_buffers, &m_priority_buffers, &m_rd_prefetch_buffers, &m_wr_prefetch_buffers}) {
+        for (ReqBuffer& buffer : *buffers) {
+          buffer.set_node_pool(&m_req_nodes);
+        }
+      }
       m_wr_high_threshold   = (size_t)(buf_size * m_wr_high_watermark);
       m_wr_low_threshold    = (size_t)(buf_size * m_wr_low_watermark);      
       m_max_ndp_read_reqs.resize(num_pseudochannel,(size_t)(buf_size * (m_ndp_read_high_threshold+m_ndp_read_low_threshold)/2));
@@ -708,32 +688,7 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
       m_avg_rd_prefetch_buffers.resize(num_pseudochannel,0);
       m_avg_wr_prefetch_buffers.resize(num_pseudochannel,0);
 
-      m_cmds.ACT = m_dram->m_commands("ACT");
-      m_cmds.P_ACT = m_dram->m_commands("P_ACT");
-      m_cmds.PRE = m_dram->m_commands("PRE");
-      m_cmds.PREA = m_dram->m_commands("PREA");
-      m_cmds.PREsb = m_dram->m_commands("PREsb");
-      m_cmds.P_PRE = m_dram->m_commands("P_PRE");
-      m_cmds.RD = m_dram->m_commands("RD");
-      m_cmds.WR = m_dram->m_commands("WR");
-      m_cmds.RDA = m_dram->m_commands("RDA");
-      m_cmds.WRA = m_dram->m_commands("WRA");
-      m_cmds.PRE_RD = m_dram->m_commands("PRE_RD");
-      m_cmds.PRE_WR = m_dram->m_commands("PRE_WR");
-      m_cmds.POST_RD = m_dram->m_commands("POST_RD");
-      m_cmds.POST_WR = m_dram->m_commands("POST_WR");
-      m_cmds.PRE_RDA = m_dram->m_commands("PRE_RDA");
-      m_cmds.POST_WRA = m_dram->m_commands("POST_WRA");
-      m_cmds.NDP_DRAM_RD = m_dram->m_commands("NDP_DRAM_RD");
-      m_cmds.NDP_DRAM_WR = m_dram->m_commands("NDP_DRAM_WR");
-      m_cmds.NDP_DRAM_RDA = m_dram->m_commands("NDP_DRAM_RDA");
-      m_cmds.NDP_DRAM_WRA = m_dram->m_commands("NDP_DRAM_WRA");
-      m_cmds.NDP_DB_RD = m_dram->m_commands("NDP_DB_RD");
-      m_cmds.NDP_DB_WR = m_dram->m_commands("NDP_DB_WR");
-      m_cmds.REFab = m_dram->m_commands("REFab");
-      m_cmds.REFsb = m_dram->m_commands("REFsb");
-      m_cmds.REFab_end = m_dram->m_commands("REFab_end");
-      m_cmds.REFsb_end = m_dram->m_commands("REFsb_end");
+      m_cmds = m_dram->m_ids.cmd;
 
       // Counter Init
       m_host_db_host_access_cnt       = 0;
@@ -795,11 +750,67 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
       s_per_bank_rd.resize(num_pseudochannel*num_bankgroup*num_bank, 0);
       s_per_bank_wr.resize(num_pseudochannel*num_bankgroup*num_bank, 0);      
 
-      m_ndp_read_latecny = m_dram->m_timing_vals("nCL") + m_dram->m_timing_vals("nBL");
-      m_ndp_write_latecny = m_dram->m_timing_vals("nCWL") + m_dram->m_timing_vals("nBL");
+      m_ndp_read_latecny = m_dram->m_timing_vals(m_dram->m_ids.timing.nCL.required()) + m_dram->m_timing_vals(m_dram->m_ids.timing.nBL.required());
+      m_ndp_write_latecny = m_dram->m_timing_vals(m_dram->m_ids.timing.nCWL.required()) + m_dram->m_timing_vals(m_dram->m_ids.timing.nBL.required());
 
     };
 
+    void serialize(Archive& ar) override {
+      ar & m_clk & pending;
+      ar & m_active_buffer & m_priority_buffer;
+      ar & m_read_buffers & m_write_buffers & m_priority_buffers & m_rd_prefetch_buffers & m_wr_prefetch_buffers;
+      ar & m_to_rd_prefetch_buffers & m_to_wr_prefetch_buffers & m_pending_ndp_rd & m_pending_ndp_wr;
+
+      // MC <-> DB and DB <-> DRAM mode switching
+      ar & m_mc_db_rw_modes & m_db_dram_rw_modes;
+      ar & m_num_rd_cnts & m_num_db_rd_cnts & m_num_dram_rd_cnts & m_num_wr_cnts & m_num_db_wr_cnts & m_num_dram_wr_cnts;
+      ar & m_num_post_rd_cnts & m_num_post_wr_cnts & m_num_ref_cnts & m_last_ndp_dram_wr & m_last_host_rd;
+      ar & m_num_read_req & m_num_write_req;
+      ar & m_ndp_dram_wr_timer & m_dram_rd_timer & m_mc_rd_timer & m_dram_ndp_rd_token & m_enable_pre_rd;
+      ar & m_host_access_cnt_per_bank & m_ndp_access_cnt_per_bank & m_row_cap_dirty;
+      ar & m_channel_stats & m_periodic_channel_stats;
+
+      // NDP request accounting and the adaptive NDP request limits
+      ar & num_ndp_total_rd_req & num_ndp_total_wr_req & num_ndp_rd_req & num_ndp_wr_req;
+      ar & num_ndp_wr_req_per_pch & num_ndp_rd_req_per_pch & m_max_ndp_read_reqs & m_max_ndp_write_reqs;
+      ar & m_host_starvation;
+      ar & m_normal_acc_in_per_pch & m_normal_acc_out_per_pch & m_ndp_acc_in_per_pch & m_ndp_acc_out_per_pch;
+      ar & m_post_normal_acc_in_per_pch & m_post_normal_acc_out_per_pch & m_post_ndp_acc_in_per_pch & m_post_ndp_acc_out_per_pch;
+      ar & m_long_win_post_normal_acc_in_per_pch & m_long_win_post_normal_acc_out_per_pch;
+      ar & m_long_win_post_ndp_acc_in_per_pch & m_long_win_post_ndp_acc_out_per_pch;
+      ar & m_win_normal_acc_in_per_pch & m_win_normal_acc_out_per_pch & m_win_ndp_acc_in_per_pch & m_win_ndp_acc_out_per_pch;
+      ar & m_long_win_ndp_per_pch & m_avg_max_ndp_rd & m_avg_max_ndp_wr & m_avg_rd_ndp_que_req & m_avg_wr_ndp_que_req;
+      ar & m_avg_ndp_ratio & m_pre_ndp_ratio;
+
+      // Statistics that are not registered
+      ar & cmd_cycle_per_pch & s_read_row_hits_per_core & s_read_row_misses_per_core & s_read_row_conflicts_per_core;
+      ar & s_per_bank_rd & s_per_bank_wr & s_num_trans_per_pch & s_num_refresh_cc_per_pch;
+      ar & s_narrow_io_busy_clk_per_pch & s_wide_io_busy_clk_per_pch & s_normal_read_latency;
+      ar & s_num_act & s_num_rd & s_num_wr & s_num_pre;
+      ar & s_num_p_act & s_num_pre_wr & s_num_post_wr & s_num_pre_rd & s_num_post_rd & s_num_p_pre;
+      ar & s_num_ndp_dram_rd & s_num_ndp_dram_wr & s_num_ndp_db_rd & s_num_ndp_db_wr;
+      ar & m_cur_seg_stats & m_completed_seg_stats & m_ndp_pending_per_bg;
+      ar & m_prev_num_cmd & m_prev_num_rd & m_prev_num_wr & m_prev_num_pre_wr & m_prev_num_post_wr;
+      ar & m_prev_num_pre_rd & m_prev_num_post_rd & m_prev_num_ndp_dram_rd & m_prev_num_ndp_dram_wr;
+      ar & m_prev_num_ndp_db_rd & m_prev_num_ndp_db_wr;
+      ar & m_his_num_cmd & m_his_num_rd & m_his_num_wr & m_his_num_pre_wr & m_his_num_post_wr;
+      ar & m_his_num_pre_rd & m_his_num_post_rd & m_his_num_ndp_dram_rd & m_his_num_ndp_dram_wr;
+      ar & m_his_num_ndp_db_rd & m_his_num_ndp_db_wr;
+      ar & s_cmd_io_util & cmd_io_cc & pre_clk & io_busy_clk_per_pch;
+      ar & m_avg_active_buffer & m_avg_read_buffers & m_avg_write_buffers & m_avg_priority_buffers;
+      ar & m_avg_rd_prefetch_buffers & m_avg_wr_prefetch_buffers;
+      ar & m_host_db_host_access_cnt & m_host_db_d2pa_access_cnt & m_host_db_ndp_access_access_cnt;
+      ar & m_db_dram_host_access_cnt & m_db_dram_d2pa_access_cnt & m_db_dram_ndp_access_access_cnt;
+      ar & m_tcore_host_db_host_access_cnt & m_tcore_host_db_d2pa_access_cnt & m_tcore_host_db_ndp_access_access_cnt;
+      ar & m_tcore_db_dram_host_access_cnt & m_tcore_db_dram_d2pa_access_cnt & m_tcore_db_dram_ndp_access_access_cnt;
+      ar & m_host_acceess_rec_counter & m_host_acceess_iss_counter;
+      ar & m_host_rd_acceess_rec_counter & m_host_rd_acceess_iss_counter;
+
+      ar & is_empty_priority_per_pch & ndp_config_reg_resp_per_pch & rr_pch_idx;
+      ar & db_prefetch_cnt_per_pch & db_prefetch_rd_cnt_per_pch & db_prefetch_wr_cnt_per_pch;
+      ar & m_open_row & m_pre_open_row & m_open_row_miss & m_lat_vec;
+    };
+
     bool send(Request& req) override {
       bool is_success = false;
       bool is_success_forwarding = false;
@@ -807,12 +818,12 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
       if(req.is_ndp_req) {
         if(m_dram->is_ndp_access(req.addr_vec)) {
           // NDP Access (NDP_CONF, ISNT/DAT MEM)
-          if(req.type_id == Request::Type::Read) req.final_command = m_dram->m_request_translations(m_dram->m_requests("ndp-db-read"));
-          else                                   req.final_command = m_dram->m_request_translations(m_dram->m_requests("ndp-db-write")); 
+          if(req.type_id == Request::Type::Read) req.final_command = m_dram->m_request_translations(m_dram->m_ids.req.ndp_db_read.required());
+          else                                   req.final_command = m_dram->m_request_translations(m_dram->m_ids.req.ndp_db_write.required()); 
         } else {
           // NDP Execution
-          if(req.type_id == Request::Type::Read) req.final_command = m_dram->m_request_translations(m_dram->m_requests("ndp-dram-read"));
-          else                                   req.final_command = m_dram->m_request_translations(m_dram->m_requests("ndp-dram-write")); 
+          if(req.type_id == Request::Type::Read) req.final_command = m_dram->m_request_translations(m_dram->m_ids.req.ndp_dram_read.required());
+          else                                   req.final_command = m_dram->m_request_translations(m_dram->m_ids.req.ndp_dram_write.required()); 
         }                   
       } else {
         req.final_command = m_dram->m_request_translations(req.type_id);
@@ -946,6 +957,7 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
     }
 
     void tick() override {
+      RAMULATOR_PROFILE_SCOPE();
 
       m_clk++;
 
@@ -1049,7 +1061,7 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
             m_to_rd_prefetch_buffers[pch_id][i].second-=1;
           }
           if(m_to_rd_prefetch_buffers[pch_id][0].second == 0) {
-            bool is_success = m_rd_prefetch_buffers[pch_id].enqueue(m_to_rd_prefetch_buffers[pch_id][0].first);
+            bool is_success = m_rd_prefetch_buffers[pch_id].enqueue(std::move(m_to_rd_prefetch_buffers[pch_id][0].first));
             if(!is_success) {
               throw std::runtime_error("Fail to enque to m_rd_prefetch_buffers");
             }    
@@ -1062,7 +1074,7 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
             m_to_wr_prefetch_buffers[pch_id][i].second-=1;
           }
           if(m_to_wr_prefetch_buffers[pch_id][0].second == 0) {
-            bool is_success = m_wr_prefetch_buffers[pch_id].enqueue(m_to_wr_prefetch_buffers[pch_id][0].first);
+            bool is_success = m_wr_prefetch_buffers[pch_id].enqueue(std::move(m_to_wr_prefetch_buffers[pch_id][0].first));
             if(!is_success) {
               throw std::runtime_error("Fail to enque to m_rd_prefetch_buffers");
             }    
@@ -1571,7 +1583,7 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
         }
 
         if(req_it->command == m_cmds.REFab) {
-          int nRFC_latency = m_dram->m_timing_vals("nRFC1");
+          int nRFC_latency = m_dram->m_timing_vals(m_dram->m_ids.timing.nRFC1.required());
           int pch_addr = req_it->addr_vec[psuedo_ch_idx];
           s_num_refresh_cc_per_pch[pch_addr]+=nRFC_latency;
         }
@@ -1823,11 +1835,12 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
 
 
 
-          // Move issued Read Request to pending buffer
+          // Move issued Read Request to pending buffer (when it is removed below, as it is still read until then)
+          bool is_pending_read = false;
           if (req_it->type_id == Request::Type::Read) {
             if(req_it->command == m_cmds.RD || req_it->command == m_cmds.RDA || req_it->command == m_cmds.POST_RD) {
               req_it->depart = m_clk + m_dram->m_read_latency;
-              pending.push_back(*req_it);  
+              is_pending_read = true;
             }
             else if(req_it->command == m_cmds.NDP_DRAM_RD || req_it->command == m_cmds.NDP_DRAM_RDA) {
               m_pending_ndp_rd[req_it->addr_vec[psuedo_ch_idx]].push_back(std::make_pair(*req_it,m_ndp_read_latecny));
@@ -1844,7 +1857,7 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
             Request new_req = Request(req_it->addr_vec, Request::Type::Write);
             new_req.addr              = req_it->addr;
             new_req.arrive            = req_it->arrive;
-            new_req.final_command     = m_cmds.POST_WR;
+            new_req.final_command     = m_cmds.POST_WR.required();
             new_req.is_trace_core_req = req_it->is_trace_core_req;
             new_req.is_host_req       = req_it->is_host_req;
             
@@ -1853,7 +1866,7 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
             DEBUG_PRINT(m_clk, "Memory Controller", new_req.addr_vec[ch_idx], new_req.addr_vec[psuedo_ch_idx], msg);              
             buffer->remove(req_it);
             // std::cout<<"[NDP_DRAM_CTRL] Generate POST_WR and Enqueue to WR_PREFETCH_BUFFER"<<std::endl;
-            m_to_wr_prefetch_buffers[new_req.addr_vec[psuedo_ch_idx]].push_back(std::make_pair(new_req, (m_dram->m_timing_vals("nBL")*4)));            
+            m_to_wr_prefetch_buffers[new_req.addr_vec[psuedo_ch_idx]].push_back(std::make_pair(new_req, (m_dram->m_timing_vals(m_dram->m_ids.timing.nBL.required())*4)));            
           } else if(req_it->command == m_cmds.PRE_RD || req_it->command == m_cmds.PRE_RDA) {
             // Generate POST_RD and Enqueue to Prefetched Buffer
             Request new_req = Request(req_it->addr_vec, Request::Type::Read);
@@ -1861,7 +1874,7 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
             new_req.arrive            = req_it->arrive;
             new_req.source_id         = req_it->source_id;
             new_req.callback          = req_it->callback;
-            new_req.final_command     = m_cmds.POST_RD;
+            new_req.final_command     = m_cmds.POST_RD.required();
             new_req.is_trace_core_req = req_it->is_trace_core_req;
             new_req.is_host_req       = req_it->is_host_req;
             m_num_post_rd_cnts[req_it->addr_vec[psuedo_ch_idx]]++;
@@ -1870,7 +1883,7 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
             std::string msg = std::string(" Remove Request (PRE_WR) from Buffer (remained ") + std::to_string(buffer->size()) + std::string(" )");
             DEBUG_PRINT(m_clk, "Memory Controller", new_req.addr_vec[ch_idx], new_req.addr_vec[psuedo_ch_idx], msg);              
             buffer->remove(req_it);
-            m_to_rd_prefetch_buffers[new_req.addr_vec[psuedo_ch_idx]].push_back(std::make_pair(new_req, (m_dram->m_timing_vals("nBL"))));
+            m_to_rd_prefetch_buffers[new_req.addr_vec[psuedo_ch_idx]].push_back(std::make_pair(new_req, (m_dram->m_timing_vals(m_dram->m_ids.timing.nBL.required()))));
             // is_success = m_rd_prefetch_buffers[new_req.addr_vec[psuedo_ch_idx]].enqueue(new_req);
             // if(!is_success) {
             //   throw std::runtime_error("Fail to enque to m_rd_prefetch_buffers");
@@ -1878,6 +1891,9 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
           } else {
             std::string msg = std::string(" Remove Request from Buffer (remained ") + std::to_string(buffer->size()) + std::string(" )");
             DEBUG_PRINT(m_clk, "Memory Controller", req_it->addr_vec[ch_idx], req_it->addr_vec[psuedo_ch_idx], msg);                        
+            if (is_pending_read) {
+              pending.push_back(std::move(*req_it));
+            }
             buffer->remove(req_it);
           }
 
@@ -1886,11 +1902,10 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
           if (m_dram->m_command_meta(req_it->command).is_opening) {
             bool is_success = false;
             req_it->is_actived = true;
-            is_success = m_active_buffer.enqueue(*req_it);
+            is_success = buffer->move_to(req_it, m_active_buffer);
             if(!is_success) {
               throw std::runtime_error("Fail to enque to m_active_buffer");
             }
-            buffer->remove(req_it);
           }
         }
       }
@@ -2010,7 +2025,7 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
 
           if (req.callback) {
             // If the request comes from outside (e.g., processor), call its callback
-            req.callback(req);
+            complete_request(req);
           }
           // Finally, remove this request from the pending queue
           pending.pop_front();
@@ -2181,7 +2196,7 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
       // 2.1    First, check the act buffer to serve requests that are already activating (avoid useless ACTs)
       // what is active_buffer? (opened row requesst?)
       if (req_it= m_scheduler->get_best_request(m_active_buffer); req_it != m_active_buffer.end()) {
-        if (m_dram->check_ready(req_it->command, req_it->addr_vec)) {
+        if (m_dram->check_ready(*req_it)) {
           request_found = true;
           req_buffer = &m_active_buffer;
         }
@@ -2197,7 +2212,7 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
             req_it = m_priority_buffers[pch_idx].begin();
             req_it->command = m_dram->get_preq_command(req_it->final_command, req_it->addr_vec);
             
-            request_found = m_dram->check_ready(req_it->command, req_it->addr_vec);
+            request_found = m_dram->check_ready(*req_it);
           }
           if(request_found) break;
         }
@@ -2219,13 +2234,13 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
                 if(m_mc_db_rw_modes[pch_idx] == DB_WR && m_db_dram_rw_modes[pch_idx] == DRAM_WR) {
                   // Only WR
                   if (req_it = m_scheduler->get_best_request_with_priority(m_write_buffers[pch_idx],4); req_it != m_write_buffers[pch_idx].end()) {
-                    request_found = m_dram->check_ready(req_it->command, req_it->addr_vec);
+                    request_found = m_dram->check_ready(*req_it);
                     req_buffer = &m_write_buffers[pch_idx];                                  
                   }                     
                 } else {
                   // Only RD
                     if (req_it = m_scheduler->get_best_request_with_priority(m_read_buffers[pch_idx],0); req_it != m_read_buffers[pch_idx].end()) {
-                      request_found = m_dram->check_ready(req_it->command, req_it->addr_vec);
+                      request_found = m_dram->check_ready(*req_it);
                       req_buffer = &m_read_buffers[pch_idx];                                  
                     }   
                 }
@@ -2237,7 +2252,7 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
                   // Seach Buffer: WR_BUF (DB_WR)
                   // 2 std::vector<int> cmd_list = {m_cmds.NDP_DB_WR};
                   if (req_it = m_scheduler->get_best_request_with_priority(m_write_buffers[pch_idx],2); req_it != m_write_buffers[pch_idx].end()) {
-                    request_found = m_dram->check_ready(req_it->command, req_it->addr_vec);
+                    request_found = m_dram->check_ready(*req_it);
                     req_buffer = &m_write_buffers[pch_idx];                                  
                   }   
 
@@ -2248,18 +2263,18 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
                   if(!request_found) {
                     // 2 std::vector<int> cmd_list = {m_cmds.NDP_DB_WR};
                     if (req_it = m_scheduler->get_best_request_with_priority(m_write_buffers[pch_idx],2); req_it != m_write_buffers[pch_idx].end()) {
-                      request_found = m_dram->check_ready(req_it->command, req_it->addr_vec);
+                      request_found = m_dram->check_ready(*req_it);
                       req_buffer = &m_write_buffers[pch_idx];                                  
                     }   
                   }
                   // Search Issuable PRE_RD
                   if(!request_found && m_enable_pre_rd[pch_idx]) {
                     if (req_it = m_scheduler->get_best_pre_request(m_read_buffers[pch_idx]); req_it != m_read_buffers[pch_idx].end()) {
-                      request_found = m_dram->check_ready(req_it->command, req_it->addr_vec);
+                      request_found = m_dram->check_ready(*req_it);
                       req_buffer = &m_read_buffers[pch_idx];   
                       if(request_found) {
                         if(req_it->final_command == m_cmds.RD || req_it->final_command == m_cmds.RDA) {
-                          req_it->final_command = m_cmds.PRE_RD;
+                          req_it->final_command = m_cmds.PRE_RD.required();
                           req_it->is_db_cmd = true;  
                         } else {
                           throw std::runtime_error("DB_WR/DB_NDP_WR Mode - Wrong Pick up DDR Command (Not RD/RDA)");
@@ -2271,7 +2286,7 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
                   if(!request_found) {
                     // 3 std::vector<int> cmd_list = {m_cmds.NDP_DRAM_RD,m_cmds.NDP_DRAM_RDA};
                     if (req_it = m_scheduler->get_best_request_with_priority(m_read_buffers[pch_idx],3); req_it != m_read_buffers[pch_idx].end()) {
-                      request_found = m_dram->check_ready(req_it->command, req_it->addr_vec);
+                      request_found = m_dram->check_ready(*req_it);
                       req_buffer = &m_read_buffers[pch_idx];                                  
                     }   
                   }
@@ -2282,14 +2297,14 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
                   if(!request_found) {
                     // 2 std::vector<int> cmd_list = {m_cmds.NDP_DB_WR};
                     if (req_it = m_scheduler->get_best_request_with_priority(m_write_buffers[pch_idx],2); req_it != m_write_buffers[pch_idx].end()) {
-                      request_found = m_dram->check_ready(req_it->command, req_it->addr_vec);
+                      request_found = m_dram->check_ready(*req_it);
                       req_buffer = &m_write_buffers[pch_idx];                                  
                     }   
                   }
                   // Search Issuable POST_WR
                   if(!request_found) {
                     if (req_it = m_scheduler->get_best_request(m_wr_prefetch_buffers[pch_idx]); req_it != m_wr_prefetch_buffers[pch_idx].end()) {
-                      request_found = m_dram->check_ready(req_it->command, req_it->addr_vec);
+                      request_found = m_dram->check_ready(*req_it);
                       req_buffer = &m_wr_prefetch_buffers[pch_idx];                                                                       
                     }  
                   }
@@ -2297,7 +2312,7 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
                   if(!request_found) {
                     // 4 std::vector<int> cmd_list = {m_cmds.NDP_DRAM_WR,m_cmds.NDP_DRAM_WRA};
                     if (req_it = m_scheduler->get_best_request_with_priority(m_write_buffers[pch_idx],4); req_it != m_write_buffers[pch_idx].end()) {
-                      request_found = m_dram->check_ready(req_it->command, req_it->addr_vec);
+                      request_found = m_dram->check_ready(*req_it);
                       req_buffer = &m_write_buffers[pch_idx];                                  
                     }   
                   }
@@ -2312,7 +2327,7 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
                   // Search Issuable POST_RD
                   if(!request_found) {
                     if (req_it = m_scheduler->get_best_request(m_rd_prefetch_buffers[pch_idx]); req_it != m_rd_prefetch_buffers[pch_idx].end()) {
-                      request_found = m_dram->check_ready(req_it->command, req_it->addr_vec);
+                      request_found = m_dram->check_ready(*req_it);
                       req_buffer = &m_rd_prefetch_buffers[pch_idx];                                                                       
                     }  
                   }    
@@ -2320,7 +2335,7 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
                   if(!request_found) {
                     // 1 std::vector<int> cmd_list = {m_cmds.NDP_DB_RD};
                     if (req_it = m_scheduler->get_best_request_with_priority(m_read_buffers[pch_idx],1); req_it != m_read_buffers[pch_idx].end()) {
-                      request_found = m_dram->check_ready(req_it->command, req_it->addr_vec);
+                      request_found = m_dram->check_ready(*req_it);
                       req_buffer = &m_read_buffers[pch_idx];                                  
                     }   
                   }                  
@@ -2331,7 +2346,7 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
                   // Search Issuable POST_RD
                   if(!request_found) {
                     if (req_it = m_scheduler->get_best_request(m_rd_prefetch_buffers[pch_idx]); req_it != m_rd_prefetch_buffers[pch_idx].end()) {
-                      request_found = m_dram->check_ready(req_it->command, req_it->addr_vec);
+                      request_found = m_dram->check_ready(*req_it);
                       req_buffer = &m_rd_prefetch_buffers[pch_idx];                                                                       
                     }  
                   }    
@@ -2339,18 +2354,18 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
                   if(!request_found) {
                     // 0 std::vector<int> cmd_list = {m_cmds.RD};
                     if (req_it = m_scheduler->get_best_request_with_priority(m_read_buffers[pch_idx],0); req_it != m_read_buffers[pch_idx].end()) {
-                      request_found = m_dram->check_ready(req_it->command, req_it->addr_vec);
+                      request_found = m_dram->check_ready(*req_it);
                       req_buffer = &m_read_buffers[pch_idx];                                  
                     }   
                   } 
                   // Search Issuable PRE_RD
                   if(!request_found && m_enable_pre_rd[pch_idx]) {
                     if (req_it = m_scheduler->get_best_pre_request(m_read_buffers[pch_idx]); req_it != m_read_buffers[pch_idx].end()) {
-                      request_found = m_dram->check_ready(req_it->command, req_it->addr_vec);
+                      request_found = m_dram->check_ready(*req_it);
                       req_buffer = &m_read_buffers[pch_idx];   
                       if(request_found) {
                         if(req_it->final_command == m_cmds.RD || req_it->final_command == m_cmds.RDA) {
-                          req_it->final_command = m_cmds.PRE_RD;
+                          req_it->final_command = m_cmds.PRE_RD.required();
                           req_it->is_db_cmd = true;  
                         } else {
                           throw std::runtime_error("DB_WR/DRAM_RD Mode - Wrong Pick up DDR Command (Not RD/RDA)");
@@ -2362,7 +2377,7 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
                   if(!request_found) {
                     // 3 std::vector<int> cmd_list = {m_cmds.NDP_DRAM_RD,m_cmds.NDP_DRAM_RDA};
                     if (req_it = m_scheduler->get_best_request_with_priority(m_read_buffers[pch_idx],3); req_it != m_read_buffers[pch_idx].end()) {
-                      request_found = m_dram->check_ready(req_it->command, req_it->addr_vec);
+                      request_found = m_dram->check_ready(*req_it);
                       req_buffer = &m_read_buffers[pch_idx];                                  
                     }   
                   }                  
@@ -2373,7 +2388,7 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
                   // Search Issuable POST_RD
                   if(!request_found) {
                     if (req_it = m_scheduler->get_best_request(m_rd_prefetch_buffers[pch_idx]); req_it != m_rd_prefetch_buffers[pch_idx].end()) {
-                      request_found = m_dram->check_ready(req_it->command, req_it->addr_vec);
+                      request_found = m_dram->check_ready(*req_it);
                       req_buffer = &m_rd_prefetch_buffers[pch_idx];                                                                       
                     }  
                   }    
@@ -2381,14 +2396,14 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
                   if(!request_found) {
                     // 1 std::vector<int> cmd_list = {m_cmds.NDP_DB_RD};
                     if (req_it = m_scheduler->get_best_request_with_priority(m_read_buffers[pch_idx],1); req_it != m_read_buffers[pch_idx].end()) {
-                      request_found = m_dram->check_ready(req_it->command, req_it->addr_vec);
+                      request_found = m_dram->check_ready(*req_it);
                       req_buffer = &m_read_buffers[pch_idx];                                  
                     }   
                   } 
                   // Search Issuable POST_WR
                   if(!request_found) {
                     if (req_it = m_scheduler->get_best_request(m_wr_prefetch_buffers[pch_idx]); req_it != m_wr_prefetch_buffers[pch_idx].end()) {
-                      request_found = m_dram->check_ready(req_it->command, req_it->addr_vec);
+                      request_found = m_dram->check_ready(*req_it);
                       req_buffer = &m_wr_prefetch_buffers[pch_idx];                                                                       
                     }  
                   }
@@ -2396,7 +2411,7 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
                   if(!request_found) {
                     // 4 std::vector<int> cmd_list = {m_cmds.NDP_DRAM_WR,m_cmds.NDP_DRAM_WRA};
                     if (req_it = m_scheduler->get_best_request_with_priority(m_write_buffers[pch_idx],4); req_it != m_write_buffers[pch_idx].end()) {
-                      request_found = m_dram->check_ready(req_it->command, req_it->addr_vec);
+                      request_found = m_dram->check_ready(*req_it);
                       req_buffer = &m_write_buffers[pch_idx];                                  
                     }   
                   }                                    
@@ -2410,11 +2425,11 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
                   // Search Issuable PRE_WR
                   if(!request_found) {
                     if (req_it = m_scheduler->get_best_pre_request(m_write_buffers[pch_idx]); req_it != m_write_buffers[pch_idx].end()) {
-                      request_found = m_dram->check_ready(req_it->command, req_it->addr_vec);
+                      request_found = m_dram->check_ready(*req_it);
                       req_buffer = &m_write_buffers[pch_idx];   
                       if(request_found) {
                         if(req_it->final_command == m_cmds.WR || req_it->final_command == m_cmds.WRA) {
-                          req_it->final_command = m_cmds.PRE_WR;
+                          req_it->final_command = m_cmds.PRE_WR.required();
                           req_it->is_db_cmd = true;  
                         } else {
                           m_dram->print_req(*req_it);
@@ -2430,11 +2445,11 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
                   // Search Issuable PRE_WR
                   if(!request_found) {
                     if (req_it = m_scheduler->get_best_pre_request(m_write_buffers[pch_idx]); req_it != m_write_buffers[pch_idx].end()) {
-                      request_found = m_dram->check_ready(req_it->command, req_it->addr_vec);
+                      request_found = m_dram->check_ready(*req_it);
                       req_buffer = &m_write_buffers[pch_idx];   
                       if(request_found) {
                         if(req_it->final_command == m_cmds.WR || req_it->final_command == m_cmds.WRA) {
-                          req_it->final_command = m_cmds.PRE_WR;
+                          req_it->final_command = m_cmds.PRE_WR.required();
                           req_it->is_db_cmd = true;  
                         } else {
                           m_dram->print_req(*req_it);
@@ -2446,11 +2461,11 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
                   // Search Issuable PRE_RD
                   if(!request_found && m_enable_pre_rd[pch_idx]) {
                     if (req_it = m_scheduler->get_best_pre_request(m_read_buffers[pch_idx]); req_it != m_read_buffers[pch_idx].end()) {
-                      request_found = m_dram->check_ready(req_it->command, req_it->addr_vec);
+                      request_found = m_dram->check_ready(*req_it);
                       req_buffer = &m_read_buffers[pch_idx];   
                       if(request_found) {
                         if(req_it->final_command == m_cmds.RD || req_it->final_command == m_cmds.RDA) {
-                          req_it->final_command = m_cmds.PRE_RD;
+                          req_it->final_command = m_cmds.PRE_RD.required();
                           req_it->is_db_cmd = true;  
                         } else {
                           throw std::runtime_error("DB_WR/DRAM_RD Mode - Wrong Pick up DDR Command (Not RD/RDA)");
@@ -2462,7 +2477,7 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
                   if(!request_found) {
                     // 3 std::vector<int> cmd_list = {m_cmds.NDP_DRAM_RD,m_cmds.NDP_DRAM_RDA};
                     if (req_it = m_scheduler->get_best_request_with_priority(m_read_buffers[pch_idx],3); req_it != m_read_buffers[pch_idx].end()) {
-                      request_found = m_dram->check_ready(req_it->command, req_it->addr_vec);
+                      request_found = m_dram->check_ready(*req_it);
                       req_buffer = &m_read_buffers[pch_idx];                                  
                     }   
                   }                  
@@ -2473,11 +2488,11 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
                   // Search Issuable PRE_WR
                   if(!request_found) {
                     if (req_it = m_scheduler->get_best_pre_request(m_write_buffers[pch_idx]); req_it != m_write_buffers[pch_idx].end()) {
-                      request_found = m_dram->check_ready(req_it->command, req_it->addr_vec);
+                      request_found = m_dram->check_ready(*req_it);
                       req_buffer = &m_write_buffers[pch_idx];   
                       if(request_found) {
                         if(req_it->final_command == m_cmds.WR || req_it->final_command == m_cmds.WRA) {
-                          req_it->final_command = m_cmds.PRE_WR;
+                          req_it->final_command = m_cmds.PRE_WR.required();
                           req_it->is_db_cmd = true;  
                         } else {
                           m_dram->print_req(*req_it);
@@ -2489,7 +2504,7 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
                   // Search Issuable POST_WR
                   if(!request_found) {
                     if (req_it = m_scheduler->get_best_request(m_wr_prefetch_buffers[pch_idx]); req_it != m_wr_prefetch_buffers[pch_idx].end()) {
-                      request_found = m_dram->check_ready(req_it->command, req_it->addr_vec);
+                      request_found = m_dram->check_ready(*req_it);
                       req_buffer = &m_wr_prefetch_buffers[pch_idx];                                                                       
                     }  
                   }
@@ -2497,7 +2512,7 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
                   if(!request_found) {
                     // 4 std::vector<int> cmd_list = {m_cmds.NDP_DRAM_WR,m_cmds.NDP_DRAM_WRA};
                     if (req_it = m_scheduler->get_best_request_with_priority(m_write_buffers[pch_idx],4); req_it != m_write_buffers[pch_idx].end()) {
-                      request_found = m_dram->check_ready(req_it->command, req_it->addr_vec);
+                      request_found = m_dram->check_ready(*req_it);
                       req_buffer = &m_write_buffers[pch_idx];                                  
                     }   
                   }                                                    
@@ -2555,7 +2570,7 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
       s_write_prefetch_queue_len_avg = (float) s_write_prefetch_queue_len / (float) m_clk;
 
       // Per-bank access distribution
-      std::cout << "  === Per-Bank Access Distribution (Ch " << m_channel_id << ") ===" << std::endl;
+      report_stream() << "  === Per-Bank Access Distribution (Ch " << m_channel_id << ") ===" << std::endl;
       for (int bk = 0; bk < num_bank; bk++) {
         size_t bk_rd = 0, bk_wr = 0;
         for (int pch = 0; pch < num_pseudochannel; pch++)
@@ -2564,11 +2579,11 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
             bk_rd += s_per_bank_rd[flat];
             bk_wr += s_per_bank_wr[flat];
           }
-        std::cout << "  BK" << bk << ": RD=" << bk_rd << " WR=" << bk_wr
-                  << " total=" << (bk_rd + bk_wr) << std::endl;
+        report_stream() << "  BK" << bk << ": RD=" << bk_rd << " WR=" << bk_wr
+                        << " total=" << (bk_rd + bk_wr) << std::endl;
       }
       // Per-bankgroup access distribution
-      std::cout << "  === Per-BankGroup Access Distribution (Ch " << m_channel_id << ") ===" << std::endl;
+      report_stream() << "  === Per-BankGroup Access Distribution (Ch " << m_channel_id << ") ===" << std::endl;
       for (int bg = 0; bg < num_bankgroup; bg++) {
         size_t bg_rd = 0, bg_wr = 0;
         for (int pch = 0; pch < num_pseudochannel; pch++)
@@ -2577,18 +2592,18 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
             bg_rd += s_per_bank_rd[flat];
             bg_wr += s_per_bank_wr[flat];
           }
-        std::cout << "  BG" << bg << ": RD=" << bg_rd << " WR=" << bg_wr
-                  << " total=" << (bg_rd + bg_wr) << std::endl;
+        report_stream() << "  BG" << bg << ": RD=" << bg_rd << " WR=" << bg_wr
+                        << " total=" << (bg_rd + bg_wr) << std::endl;
       }
 
       // GB/s 
       // Request Bandwidth, DQ Bandwidth, Max DQ Bandwidth
       int tx_bytes = m_dram->m_internal_prefetch_size * m_dram->m_channel_width / 8;
-      s_bandwidth = ((float)((s_num_read_reqs + s_num_write_reqs) * tx_bytes) / (float)(m_clk * m_dram->m_timing_vals("tCK_ps"))) * 1E12 / (1024*1024*1012);
-      s_dq_bandwidth = ((float)((s_num_issue_reads + s_num_issue_writes) * tx_bytes) / (float)(m_clk * m_dram->m_timing_vals("tCK_ps"))) * 1E12 / (1024*1024*1012);
+      s_bandwidth = ((float)((s_num_read_reqs + s_num_write_reqs) * tx_bytes) / (float)(m_clk * m_dram->m_timing_vals(m_dram->m_ids.timing.tCK_ps.required()))) * 1E12 / (1024*1024*1012);
+      s_dq_bandwidth = ((float)((s_num_issue_reads + s_num_issue_writes) * tx_bytes) / (float)(m_clk * m_dram->m_timing_vals(m_dram->m_ids.timing.tCK_ps.required()))) * 1E12 / (1024*1024*1012);
       // rate unit is MT/s 
       // 10^6 T/s --> /(2^30) GB/s
-      s_max_bandwidth = (float)(m_dram->m_channel_width / 8) * (float)m_dram->m_timing_vals("rate") * 1E6 / (1024*1024*1012);      
+      s_max_bandwidth = (float)(m_dram->m_channel_width / 8) * (float)m_dram->m_timing_vals(m_dram->m_ids.timing.rate.required()) * 1E6 / (1024*1024*1012);      
 
       // I/O Utilization (%)
       s_cmd_io_util = 100 * (float) cmd_io_cc / (float) m_clk;    
@@ -2600,10 +2615,10 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
         // Double Data Rate 
         total_transfer_data += 2 * m_dram->m_organization.dq * 4 * io_busy_clk * 2;
       }
-      s_effective_bandwidth = ((float)(total_transfer_data/8)/(float)(m_clk * m_dram->m_timing_vals("tCK_ps"))) * 1E12 / (1024*1024*1012);
+      s_effective_bandwidth = ((float)(total_transfer_data/8)/(float)(m_clk * m_dram->m_timing_vals(m_dram->m_ids.timing.tCK_ps.required()))) * 1E12 / (1024*1024*1012);
 
       // Max Effective Bandwidth (except refresh)
-      float refresh_ratio = ((float)m_dram->m_timing_vals("nRFC1")/(float)m_dram->m_timing_vals("nREFI"));
+      float refresh_ratio = ((float)m_dram->m_timing_vals(m_dram->m_ids.timing.nRFC1.required())/(float)m_dram->m_timing_vals(m_dram->m_ids.timing.nREFI.required()));
       s_max_effective_bandwidth = s_max_bandwidth * (float)num_pseudochannel * (1.0 - refresh_ratio);      
       
       /*
@@ -2620,19 +2635,19 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
       }
       */     
 
-        std::cout<<"------------------------------------------------"<<std::endl;
-        std::cout<<"Command IO Utilization (Channel: "<<m_channel_id<<")"<<std::endl;
+        report_stream()<<"------------------------------------------------"<<std::endl;
+        report_stream()<<"Command IO Utilization (Channel: "<<m_channel_id<<")"<<std::endl;
         for(int i=0;i<num_pseudochannel;i++) {
           float val = (float)cmd_cycle_per_pch[i]/(float)m_clk;
-          std::cout<<val;
+          report_stream()<<val;
           if (i != (num_pseudochannel-1))
-            std::cout<<" | ";
+            report_stream()<<" | ";
         }
-        std::cout<<std::endl;
-        std::cout<<"------------------------------------------------"<<std::endl;
+        report_stream()<<std::endl;
+        report_stream()<<"------------------------------------------------"<<std::endl;
 
-        std::cout << "\n========== Decoupled Scheduling Mode Statistics ==========" << std::endl;
-        std::cout << std::fixed << std::setprecision(2);
+        report_stream() << "\n========== Decoupled Scheduling Mode Statistics ==========" << std::endl;
+        report_stream() << std::fixed << std::setprecision(2);
         
         for (int ch = 0; ch < num_pseudochannel; ch++) {
             print_channel_stats(ch);
@@ -2641,78 +2656,78 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
 
         print_interval_statistics();
 
-        std::cout<<"Host Access In/Out - NDP Access In/Out"<<std::endl;
+        report_stream()<<"Host Access In/Out - NDP Access In/Out"<<std::endl;
         for(int i=0;i<num_pseudochannel;i++) {
-          std::cout<<"["<<i<<"] "<<m_normal_acc_in_per_pch[i]<<" / "
+          report_stream()<<"["<<i<<"] "<<m_normal_acc_in_per_pch[i]<<" / "
                                  <<m_normal_acc_out_per_pch[i]<<" - "
                                  <<m_ndp_acc_in_per_pch[i]<<" / "
                                  <<m_ndp_acc_out_per_pch[i]<<std::endl;        
         }
 
 
-        std::cout<<"Average NDP Issue Ratio (NDP/Host Access)"<<std::endl;
+        report_stream()<<"Average NDP Issue Ratio (NDP/Host Access)"<<std::endl;
         for(int i=0;i<num_pseudochannel;i++) {
-          std::cout<<"["<<i<<"] "<<((float)m_avg_ndp_ratio[i]*(float)long_win_sz/(float)m_clk)<<std::endl;        
+          report_stream()<<"["<<i<<"] "<<((float)m_avg_ndp_ratio[i]*(float)long_win_sz/(float)m_clk)<<std::endl;        
         }
 
 
-        std::cout<<"Max NDP RD/WR"<<std::endl;
+        report_stream()<<"Max NDP RD/WR"<<std::endl;
         for(int i=0;i<num_pseudochannel;i++) {
-          std::cout<<"["<<i<<"] "<<((float)m_avg_max_ndp_rd[i]*(float)win_sz/(float)m_clk)<<" / "
+          report_stream()<<"["<<i<<"] "<<((float)m_avg_max_ndp_rd[i]*(float)win_sz/(float)m_clk)<<" / "
                                  <<((float)m_avg_max_ndp_wr[i]*(float)win_sz/(float)m_clk)<<std::endl;        
         }
         
-        std::cout<<"Average NDP Queue Request "<<std::endl;
+        report_stream()<<"Average NDP Queue Request "<<std::endl;
         for(int i=0;i<num_pseudochannel;i++) {
-          std::cout<<"["<<i<<"] "<<((float)m_avg_rd_ndp_que_req[i]/(float)m_clk)<<" / "
+          report_stream()<<"["<<i<<"] "<<((float)m_avg_rd_ndp_que_req[i]/(float)m_clk)<<" / "
                                  <<((float)m_avg_wr_ndp_que_req[i]/(float)m_clk)<<std::endl;
         }
 
         // ===== NDP CAS Instrumentation Report (per-segment BLP & RW Switch) =====
         if (m_enable_ndp_cas_instrumentation) {
-        std::cout << "\n=== NDP CAS Instrumentation Report (Channel " << m_channel_id << ") ===" << std::endl;
+        report_stream() << "\n=== NDP CAS Instrumentation Report (Channel " << m_channel_id << ") ===" << std::endl;
         for (int pch = 0; pch < num_pseudochannel; pch++) {
           // Flush current segment if it has data
           notify_segment_boundary(pch, -1);
           auto& segs = m_completed_seg_stats[pch];
           if (segs.empty()) continue;
-          std::cout << "\n--- PCH[" << pch << "] (" << segs.size() << " segments) ---" << std::endl;
-          std::cout << "  Seg | RD_CAS | WR_CAS | RW_sw | AvgBLP |"
-                    << " BG[0:7] CAS distribution          |"
-                    << " MaxSameBG | SameBGPairs |"
-                    << "   PRE |   ACT | AvgOccBk" << std::endl;
-          std::cout << "------+--------+--------+-------+--------+"
-                    << "-------------------------------------+"
-                    << "-----------+-------------+"
-                    << "-------+-------+---------" << std::endl;
+          report_stream() << "\n--- PCH[" << pch << "] (" << segs.size() << " segments) ---" << std::endl;
+          report_stream() << "  Seg | RD_CAS | WR_CAS | RW_sw | AvgBLP |"
+                          << " BG[0:7] CAS distribution          |"
+                          << " MaxSameBG | SameBGPairs |"
+                          << "   PRE |   ACT | AvgOccBk" << std::endl;
+          report_stream() << "------+--------+--------+-------+--------+"
+                          << "-------------------------------------+"
+                          << "-----------+-------------+"
+                          << "-------+-------+---------" << std::endl;
           for (auto& s : segs) {
             float avg_blp = (s.blp_sample_cnt > 0) ? (float)s.blp_sum / s.blp_sample_cnt : 0;
             float avg_occ_bk = (s.occupied_bank_sample_cnt > 0) ? (float)s.occupied_bank_sum / s.occupied_bank_sample_cnt : 0;
-            std::cout << std::setw(5) << s.seg_id << " |"
-                      << std::setw(7) << s.ndp_dram_rd_cnt << " |"
-                      << std::setw(7) << s.ndp_dram_wr_cnt << " |"
-                      << std::setw(6) << s.rw_switch_cnt << " |"
-                      << std::fixed << std::setprecision(2) << std::setw(7) << avg_blp << " |";
+            report_stream() << std::setw(5) << s.seg_id << " |"
+                            << std::setw(7) << s.ndp_dram_rd_cnt << " |"
+                            << std::setw(7) << s.ndp_dram_wr_cnt << " |"
+                            << std::setw(6) << s.rw_switch_cnt << " |"
+                            << std::fixed << std::setprecision(2) << std::setw(7) << avg_blp << " |";
             for (int g = 0; g < 8; g++)
-              std::cout << std::setw(4) << s.per_bg_cas_cnt[g];
-            std::cout << "   |"
-                      << std::setw(10) << s.max_consec_same_bg << " |"
-                      << std::setw(11) << s.consec_same_bg_pairs << " |"
-                      << std::setw(6) << s.pre_cnt << " |"
-                      << std::setw(6) << s.act_cnt << " |"
-                      << std::fixed << std::setprecision(2) << std::setw(8) << avg_occ_bk
-                      << std::endl;
+              report_stream() << std::setw(4) << s.per_bg_cas_cnt[g];
+            report_stream() << "   |"
+                            << std::setw(10) << s.max_consec_same_bg << " |"
+                            << std::setw(11) << s.consec_same_bg_pairs << " |"
+                            << std::setw(6) << s.pre_cnt << " |"
+                            << std::setw(6) << s.act_cnt << " |"
+                            << std::fixed << std::setprecision(2) << std::setw(8) << avg_occ_bk
+                            << std::endl;
           }
           // BLP histogram summary across all segments
-          std::cout << "  BLP histogram (all segs): ";
+          report_stream() << "  BLP histogram (all segs): ";
           std::array<uint32_t, 9> total_blp_hist = {};
           for (auto& s : segs)
             for (int i = 0; i <= 8; i++) total_blp_hist[i] += s.blp_histogram[i];
           for (int i = 0; i <= 8; i++) {
             if (total_blp_hist[i] > 0)
-              std::cout << "[" << i << "]=" << total_blp_hist[i] << " ";
+              report_stream() << "[" << i << "]=" << total_blp_hist[i] << " ";
           }
-          std::cout << std::endl;
+          report_stream() << std::endl;
           // Summary: average across RD vs WR segments
           uint32_t rd_segs = 0, wr_segs = 0;
           float rd_avg_blp_sum = 0, wr_avg_blp_sum = 0;
@@ -2740,28 +2755,28 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
               wr_avg_occ_bk_sum += (s.occupied_bank_sample_cnt > 0) ? (float)s.occupied_bank_sum / s.occupied_bank_sample_cnt : 0;
             }
           }
-          std::cout << "  RD segs: " << rd_segs
-                    << ", avg BLP=" << std::fixed << std::setprecision(2)
-                    << (rd_segs > 0 ? rd_avg_blp_sum / rd_segs : 0)
-                    << ", total CAS=" << rd_total_cas
-                    << ", same-BG pairs=" << rd_same_bg
-                    << " (" << std::setprecision(1) << (rd_total_cas > 0 ? 100.0f * rd_same_bg / rd_total_cas : 0) << "%)"
-                    << ", total PRE=" << rd_total_pre
-                    << ", total ACT=" << rd_total_act
-                    << ", avg OccBk=" << std::setprecision(2) << (rd_segs > 0 ? rd_avg_occ_bk_sum / rd_segs : 0)
-                    << std::endl;
-          std::cout << "  WR segs: " << wr_segs
-                    << ", avg BLP=" << std::fixed << std::setprecision(2)
-                    << (wr_segs > 0 ? wr_avg_blp_sum / wr_segs : 0)
-                    << ", total CAS=" << wr_total_cas
-                    << ", same-BG pairs=" << wr_same_bg
-                    << " (" << std::setprecision(1) << (wr_total_cas > 0 ? 100.0f * wr_same_bg / wr_total_cas : 0) << "%)"
-                    << ", total PRE=" << wr_total_pre
-                    << ", total ACT=" << wr_total_act
-                    << ", avg OccBk=" << std::setprecision(2) << (wr_segs > 0 ? wr_avg_occ_bk_sum / wr_segs : 0)
-                    << std::endl;
-        }
-        std::cout << "=== End NDP CAS Instrumentation Report ===\n" << std::endl;
+          report_stream() << "  RD segs: " << rd_segs
+                          << ", avg BLP=" << std::fixed << std::setprecision(2)
+                          << (rd_segs > 0 ? rd_avg_blp_sum / rd_segs : 0)
+                          << ", total CAS=" << rd_total_cas
+                          << ", same-BG pairs=" << rd_same_bg
+                          << " (" << std::setprecision(1) << (rd_total_cas > 0 ? 100.0f * rd_same_bg / rd_total_cas : 0) << "%)"
+                          << ", total PRE=" << rd_total_pre
+                          << ", total ACT=" << rd_total_act
+                          << ", avg OccBk=" << std::setprecision(2) << (rd_segs > 0 ? rd_avg_occ_bk_sum / rd_segs : 0)
+                          << std::endl;
+          report_stream() << "  WR segs: " << wr_segs
+                          << ", avg BLP=" << std::fixed << std::setprecision(2)
+                          << (wr_segs > 0 ? wr_avg_blp_sum / wr_segs : 0)
+                          << ", total CAS=" << wr_total_cas
+                          << ", same-BG pairs=" << wr_same_bg
+                          << " (" << std::setprecision(1) << (wr_total_cas > 0 ? 100.0f * wr_same_bg / wr_total_cas : 0) << "%)"
+                          << ", total PRE=" << wr_total_pre
+                          << ", total ACT=" << wr_total_act
+                          << ", avg OccBk=" << std::setprecision(2) << (wr_segs > 0 ? wr_avg_occ_bk_sum / wr_segs : 0)
+                          << std::endl;
+        }
+        report_stream() << "=== End NDP CAS Instrumentation Report ===\n" << std::endl;
         } // end m_enable_ndp_cas_instrumentation
         // ===== End NDP CAS Instrumentation Report =====
 
@@ -2871,41 +2886,41 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
     void print_channel_stats(int ch) const {
         const auto& stats = m_channel_stats[ch];
         
-        std::cout << "\n[Pseudo Channel " << ch << "]" << std::endl;
+        report_stream() << "\n[Pseudo Channel " << ch << "]" << std::endl;
 
         // Request counts
-        std::cout << "  --- Request Counts ---" << std::endl;
-        std::cout << "    " << std::setw(12) << std::left << "Read Requests" << ": "
-                  << std::setw(12) << std::right << m_num_read_req[ch] << std::endl;
-        std::cout << "    " << std::setw(12) << std::left << "Write Requests" << ": "
-                  << std::setw(12) << std::right << m_num_write_req[ch] << std::endl;
-        std::cout << "    " << std::setw(12) << std::left << "Total Requests" << ": "
-                  << std::setw(12) << std::right << (m_num_read_req[ch] + m_num_write_req[ch]) << std::endl;
+        report_stream() << "  --- Request Counts ---" << std::endl;
+        report_stream() << "    " << std::setw(12) << std::left << "Read Requests" << ": "
+                        << std::setw(12) << std::right << m_num_read_req[ch] << std::endl;
+        report_stream() << "    " << std::setw(12) << std::left << "Write Requests" << ": "
+                        << std::setw(12) << std::right << m_num_write_req[ch] << std::endl;
+        report_stream() << "    " << std::setw(12) << std::left << "Total Requests" << ": "
+                        << std::setw(12) << std::right << (m_num_read_req[ch] + m_num_write_req[ch]) << std::endl;
 
               
-        std::cout << "  --- MC <-> DB Modes ---" << std::endl;
+        report_stream() << "  --- MC <-> DB Modes ---" << std::endl;
         
         // Print MC <-> DB mode statistics
         for (int mode = 0; mode < 3; mode++) {
             uint64_t cycles = stats.mc_db_mode_cycles[mode];
             double ratio = (m_clk > 0) ? (100.0 * cycles / m_clk) : 0.0;
             
-            std::cout << "    " << std::setw(12) << std::left << MC_DB_MODE_NAMES[mode] << ": "
-                      << std::setw(12) << std::right << cycles 
-                      << " cycles (" << std::setw(6) << ratio << "%)" << std::endl;
+            report_stream() << "    " << std::setw(12) << std::left << MC_DB_MODE_NAMES[mode] << ": "
+                            << std::setw(12) << std::right << cycles 
+                            << " cycles (" << std::setw(6) << ratio << "%)" << std::endl;
         }
         
         
-        std::cout << "\n  --- DB <-> DRAM Modes ---" << std::endl;
+        report_stream() << "\n  --- DB <-> DRAM Modes ---" << std::endl;
         
         // Print DB <-> DRAM mode statistics
         for (int mode = 0; mode < 4; mode++) {
             uint64_t cycles = stats.db_dram_mode_cycles[mode];
             double ratio = (m_clk > 0) ? (100.0 * cycles / m_clk) : 0.0;
             
-            std::cout << "    " << std::setw(12) << std::left << DB_DRAM_MODE_NAMES[mode] << ": "
-                      << std::setw(12) << std::right << cycles 
-                      << " cycles (" << std::setw(6) << ratio << "%)" << std::endl;
+            report_stream() << "    " << std::setw(12) << std::left << DB_DRAM_MODE_NAMES[mode] << ": "
+                            << std::setw(12) << std::right << cycles 
+                            << " cycles (" << std::setw(6) << ratio << "%)" << std::endl;
         }
               
     } 
@@ -2970,38 +2985,41 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
     void print_interval_statistics() {
         size_t num_intervals = m_his_num_rd.size();
         
-        std::cout << "=== Interval Statistics ===" << std::endl;
-        std::cout << std::setw(10) << "Interval"
-                  << std::setw(12) << "CMD"
-                  << std::setw(12) << "RD"
-                  << std::setw(12) << "WR"
-                  << std::setw(12) << "PRE_WR"
-                  << std::setw(12) << "POST_WR"
-                  << std::setw(12) << "PRE_RD"
-                  << std::setw(12) << "POST_RD"
-                  << std::setw(12) << "NDP_D_RD"
-                  << std::setw(12) << "NDP_D_WR"
-                  << std::setw(12) << "NDP_DB_RD"
-                  << std::setw(12) << "NDP_DB_WR"
-                  << std::endl;
+        report_stream() << "=== Interval Statistics ===" << std::endl;
+        report_stream() << std::setw(10) << "Interval"
+                        << std::setw(12) << "CMD"
+                        << std::setw(12) << "RD"
+                        << std::setw(12) << "WR"
+                        << std::setw(12) << "PRE_WR"
+                        << std::setw(12) << "POST_WR"
+                        << std::setw(12) << "PRE_RD"
+                        << std::setw(12) << "POST_RD"
+                        << std::setw(12) << "NDP_D_RD"
+                        << std::setw(12) << "NDP_D_WR"
+                        << std::setw(12) << "NDP_DB_RD"
+                        << std::setw(12) << "NDP_DB_WR"
+                        << std::endl;
         
         for (size_t i = 0; i < num_intervals; i++) {
-            std::cout << std::setw(10) << i
-                      << std::setw(12) << m_his_num_cmd[i]
-                      << std::setw(12) << m_his_num_rd[i]
-                      << std::setw(12) << m_his_num_wr[i]
-                      << std::setw(12) << m_his_num_pre_wr[i]
-                      << std::setw(12) << m_his_num_post_wr[i]
-                      << std::setw(12) << m_his_num_pre_rd[i]
-                      << std::setw(12) << m_his_num_post_rd[i]
-                      << std::setw(12) << m_his_num_ndp_dram_rd[i]
-                      << std::setw(12) << m_his_num_ndp_dram_wr[i]
-                      << std::setw(12) << m_his_num_ndp_db_rd[i]
-                      << std::setw(12) << m_his_num_ndp_db_wr[i]
-                      << std::endl;
+            report_stream() << std::setw(10) << i
+                            << std::setw(12) << m_his_num_cmd[i]
+                            << std::setw(12) << m_his_num_rd[i]
+                            << std::setw(12) << m_his_num_wr[i]
+                            << std::setw(12) << m_his_num_pre_wr[i]
+                            << std::setw(12) << m_his_num_post_wr[i]
+                            << std::setw(12) << m_his_num_pre_rd[i]
+                            << std::setw(12) << m_his_num_post_rd[i]
+                            << std::setw(12) << m_his_num_ndp_dram_rd[i]
+                            << std::setw(12) << m_his_num_ndp_dram_wr[i]
+                            << std::setw(12) << m_his_num_ndp_db_rd[i]
+                            << std::setw(12) << m_his_num_ndp_db_wr[i]
+                            << std::endl;
         }
     }    
 
+    uint64_t get_row_hit_counter() override { return s_row_hits; }
+    uint64_t get_row_access_counter() override { return s_row_hits + s_row_misses + s_row_conflicts; }
+
     std::vector<uint64_t> get_counters() override {
       std::vector<uint64_t> v;
       v.reserve(12);
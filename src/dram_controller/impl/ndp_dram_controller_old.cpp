@@ -170,7 +170,7 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
 
     void setup(IFrontEnd* frontend, IMemorySystem* memory_system) override {
       m_dram = memory_system->get_ifce<IDRAM>();
-      m_bank_addr_idx = m_dram->m_levels("bank");
+      m_bank_addr_idx = m_dram->m_ids.level.bank.required();
       m_priority_buffer.max_size = 512*3 + 32;
       m_active_buffer.max_size = 32*4;
       m_prefetched_buffer.max_size = 16*4;
@@ -182,7 +182,7 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
       if(m_dram->get_level_size("pseudochannel") == -1) use_pseudo_ch = false;
       else                                              use_pseudo_ch = true;
 
-      if(use_pseudo_ch) psuedo_ch_idx = m_dram->m_levels("pseudochannel");
+      if(use_pseudo_ch) psuedo_ch_idx = m_dram->m_ids.level.pseudochannel.required();
 
       m_use_prefetch = m_dram->get_use_prefetch();
 
@@ -325,12 +325,12 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
       if(req.is_ndp_req) {
         if(m_dram->is_ndp_access(req.addr_vec)) {
           // NDP Access (NDP_CONF, ISNT/DAT MEM)
-          if(req.type_id == Request::Type::Read) req.final_command = m_dram->m_request_translations(m_dram->m_requests("ndp-db-read"));
-          else                                   req.final_command = m_dram->m_request_translations(m_dram->m_requests("ndp-db-write")); 
+          if(req.type_id == Request::Type::Read) req.final_command = m_dram->m_request_translations(m_dram->m_ids.req.ndp_db_read.required());
+          else                                   req.final_command = m_dram->m_request_translations(m_dram->m_ids.req.ndp_db_write.required()); 
         } else {
           // NDP Execution
-          if(req.type_id == Request::Type::Read) req.final_command = m_dram->m_request_translations(m_dram->m_requests("ndp-dram-read"));
-          else                                   req.final_command = m_dram->m_request_translations(m_dram->m_requests("ndp-dram-write")); 
+          if(req.type_id == Request::Type::Read) req.final_command = m_dram->m_request_translations(m_dram->m_ids.req.ndp_dram_read.required());
+          else                                   req.final_command = m_dram->m_request_translations(m_dram->m_ids.req.ndp_dram_write.required()); 
         }                   
       } else {
         req.final_command = m_dram->m_request_translations(req.type_id);
@@ -471,23 +471,23 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
         if(use_pseudo_ch) {
           
           int req_pch_idx = req_it->addr_vec[psuedo_ch_idx];
-          if(prefetch_mode_before_ref_per_ch[req_pch_idx] && (req_it->command == m_dram->m_commands("RD") || req_it->command == m_dram->m_commands("RDA")) && 
+          if(prefetch_mode_before_ref_per_ch[req_pch_idx] && (req_it->command == m_dram->m_ids.cmd.RD || req_it->command == m_dram->m_ids.cmd.RDA) && 
              db_prefetch_rd_cnt_per_pch[req_pch_idx] < m_rd_prefetch_buffers[req_pch_idx].max_size) {
             // Convert RD or RDA to PRE_RD when the pseudo channel is high priority mode of prefetch
-            if(req_it->command == m_dram->m_commands("RD")) req_it->command = m_dram->m_commands("PRE_RD");
-            else                                            req_it->command = m_dram->m_commands("PRE_RDA");
+            if(req_it->command == m_dram->m_ids.cmd.RD) req_it->command = m_dram->m_ids.cmd.PRE_RD.required();
+            else                                            req_it->command = m_dram->m_ids.cmd.PRE_RDA.required();
             req_it->is_db_cmd = false;
           }
 
           // Update PRE_WR from Normal WR/WRA
-          if((req_it->command == m_dram->m_commands("P_ACT") || req_it->command == m_dram->m_commands("PRE_WR")) &&
-             (req_it->final_command == m_dram->m_commands("WR") || req_it->final_command == m_dram->m_commands("WRA"))) {
+          if((req_it->command == m_dram->m_ids.cmd.P_ACT || req_it->command == m_dram->m_ids.cmd.PRE_WR) &&
+             (req_it->final_command == m_dram->m_ids.cmd.WR || req_it->final_command == m_dram->m_ids.cmd.WRA)) {
               // PRE_WR from WRITE_BUFFER --> Update PRE_WR Counter
               s_num_pre_wr++;
               db_prefetch_cnt_per_pch[req_it->addr_vec[psuedo_ch_idx]]++;
               db_prefetch_wr_cnt_per_pch[req_it->addr_vec[psuedo_ch_idx]]++;       
               // Change Final Command from WR/WRA to PRE_WR 
-              req_it->final_command = m_dram->m_commands("PRE_WR");      
+              req_it->final_command = m_dram->m_ids.cmd.PRE_WR.required();      
               #ifdef PRINT_DB_CNT
               std::cout<<"PRE_WR ["<<req_it->addr_vec[0]<<"]["<<req_it->addr_vec[1]<<"] |";
               std::cout<<" db cnt "<<db_prefetch_cnt_per_pch[req_it->addr_vec[psuedo_ch_idx]];
@@ -497,7 +497,7 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
           }
 
           // Update POST_WR 
-          if(req_it->command == m_dram->m_commands("POST_WR")) {
+          if(req_it->command == m_dram->m_ids.cmd.POST_WR) {
             // Issued DDR commands related with PRE_WR
             s_num_post_wr++;
             db_prefetch_cnt_per_pch[req_it->addr_vec[psuedo_ch_idx]]--;
@@ -511,17 +511,17 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
           }
 
           // Update PRE_RD
-          if((req_it->command == m_dram->m_commands("ACT")  || req_it->command == m_dram->m_commands("RD") ||
-              req_it->command  == m_dram->m_commands("RDA") || req_it->command  == m_dram->m_commands("PRE_RD") ||
-              req_it->command  == m_dram->m_commands("PRE_RDA")) && (req_it->final_command == m_dram->m_commands("RD") || 
-              req_it->final_command == m_dram->m_commands("RDA")) && req_it->is_db_cmd) {                
+          if((req_it->command == m_dram->m_ids.cmd.ACT  || req_it->command == m_dram->m_ids.cmd.RD ||
+              req_it->command  == m_dram->m_ids.cmd.RDA || req_it->command  == m_dram->m_ids.cmd.PRE_RD ||
+              req_it->command  == m_dram->m_ids.cmd.PRE_RDA) && (req_it->final_command == m_dram->m_ids.cmd.RD || 
+              req_it->final_command == m_dram->m_ids.cmd.RDA) && req_it->is_db_cmd) {                
             // PRE_RD from READ_BUFFER --> update PRD_RD Counter
             s_num_pre_rd++;
             db_prefetch_cnt_per_pch[req_it->addr_vec[psuedo_ch_idx]]++;
             db_prefetch_rd_cnt_per_pch[req_it->addr_vec[psuedo_ch_idx]]++;
             // Change Final Command from RD/RDA to PRE_RD/PRE_RDA 
-            if(req_it->final_command == m_dram->m_commands("RD")) req_it->final_command = m_dram->m_commands("PRE_RD");
-            else                                                  req_it->final_command = m_dram->m_commands("PRE_RDA");
+            if(req_it->final_command == m_dram->m_ids.cmd.RD) req_it->final_command = m_dram->m_ids.cmd.PRE_RD.required();
+            else                                                  req_it->final_command = m_dram->m_ids.cmd.PRE_RDA.required();
             #ifdef PRINT_DB_CNT
             std::cout<<"PRE_RD ["<<req_it->addr_vec[0]<<"]["<<req_it->addr_vec[1]<<"] |";
             std::cout<<" db cnt "<<db_prefetch_cnt_per_pch[req_it->addr_vec[psuedo_ch_idx]];
@@ -531,7 +531,7 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
           }
           
           // Update POST_RD
-          if(req_it->command  == m_dram->m_commands("POST_RD")) {
+          if(req_it->command  == m_dram->m_ids.cmd.POST_RD) {
             s_num_post_rd++;
             db_prefetch_cnt_per_pch[req_it->addr_vec[psuedo_ch_idx]]--;
             db_prefetch_rd_cnt_per_pch[req_it->addr_vec[psuedo_ch_idx]]--;
@@ -555,15 +555,15 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
             
               
           if(false) {
-            if(req_it->command == m_dram->m_commands("PRE_WR"))  std::cout<<"["<<m_clk<<"] ISSUE PRE_WR CH["<<req_it->addr_vec[0]<<"]PCH["<<req_it->addr_vec[1]<<"] / "<<s_num_pre_wr  << "/" <<s_num_post_wr
+            if(req_it->command == m_dram->m_ids.cmd.PRE_WR)  std::cout<<"["<<m_clk<<"] ISSUE PRE_WR CH["<<req_it->addr_vec[0]<<"]PCH["<<req_it->addr_vec[1]<<"] / "<<s_num_pre_wr  << "/" <<s_num_post_wr
             <<" db cnt : "<<db_prefetch_cnt_per_pch[req_it->addr_vec[psuedo_ch_idx]]<<" / "<<m_dram->get_db_fetch_per_pch(req_it->addr_vec)<<std::endl;
-            if(req_it->command == m_dram->m_commands("POST_WR")) std::cout<<"["<<m_clk<<"] ISSUE POST_WR CH["<<req_it->addr_vec[0]<<"]PCH["<<req_it->addr_vec[1]<<"] / "<<s_num_pre_wr  << "/" <<s_num_post_wr
+            if(req_it->command == m_dram->m_ids.cmd.POST_WR) std::cout<<"["<<m_clk<<"] ISSUE POST_WR CH["<<req_it->addr_vec[0]<<"]PCH["<<req_it->addr_vec[1]<<"] / "<<s_num_pre_wr  << "/" <<s_num_post_wr
             <<" db cnt : "<<db_prefetch_cnt_per_pch[req_it->addr_vec[psuedo_ch_idx]]<<" / "<<m_dram->get_db_fetch_per_pch(req_it->addr_vec)<<std::endl;
-            if(req_it->command == m_dram->m_commands("PRE_RD")) std::cout<<"["<<m_clk<<"] ISSUE PRE_RD CH["<<req_it->addr_vec[0]<<"]PCH["<<req_it->addr_vec[1]<<"] / "<<s_num_pre_rd  << "/" <<s_num_post_rd
+            if(req_it->command == m_dram->m_ids.cmd.PRE_RD) std::cout<<"["<<m_clk<<"] ISSUE PRE_RD CH["<<req_it->addr_vec[0]<<"]PCH["<<req_it->addr_vec[1]<<"] / "<<s_num_pre_rd  << "/" <<s_num_post_rd
             <<" db cnt : "<<db_prefetch_cnt_per_pch[req_it->addr_vec[psuedo_ch_idx]]<<" / "<<m_dram->get_db_fetch_per_pch(req_it->addr_vec)<<std::endl;              
-            if(req_it->command == m_dram->m_commands("PRE_RDA")) std::cout<<"["<<m_clk<<"] ISSUE PRE_RDA CH["<<req_it->addr_vec[0]<<"]PCH["<<req_it->addr_vec[1]<<"] / "<<s_num_pre_rd  << "/" <<s_num_post_rd
+            if(req_it->command == m_dram->m_ids.cmd.PRE_RDA) std::cout<<"["<<m_clk<<"] ISSUE PRE_RDA CH["<<req_it->addr_vec[0]<<"]PCH["<<req_it->addr_vec[1]<<"] / "<<s_num_pre_rd  << "/" <<s_num_post_rd
             <<" db cnt : "<<db_prefetch_cnt_per_pch[req_it->addr_vec[psuedo_ch_idx]]<<" / "<<m_dram->get_db_fetch_per_pch(req_it->addr_vec)<<std::endl;                            
-            if(req_it->command == m_dram->m_commands("POST_RD")) std::cout<<"["<<m_clk<<"] ISSUE POST_RD CH["<<req_it->addr_vec[0]<<"]PCH["<<req_it->addr_vec[1]<<"] / "<<s_num_pre_rd  << "/" <<s_num_post_rd
+            if(req_it->command == m_dram->m_ids.cmd.POST_RD) std::cout<<"["<<m_clk<<"] ISSUE POST_RD CH["<<req_it->addr_vec[0]<<"]PCH["<<req_it->addr_vec[1]<<"] / "<<s_num_pre_rd  << "/" <<s_num_post_rd
             <<" db cnt : "<<db_prefetch_cnt_per_pch[req_it->addr_vec[psuedo_ch_idx]]<<" / "<<m_dram->get_db_fetch_per_pch(req_it->addr_vec)<<std::endl;                                          
           }
           // Exception 
@@ -589,14 +589,14 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
           ======================= Update Stats =====================
         */
 
-        if(req_it->command == m_dram->m_commands("P_ACT")     ||
-           req_it->command == m_dram->m_commands("PRE")       ||
-           req_it->command == m_dram->m_commands("PREA")      ||
-           req_it->command == m_dram->m_commands("P_PRE")     ||
-           req_it->command == m_dram->m_commands("REFab")     ||
-           req_it->command == m_dram->m_commands("REFsb")     ||
-           req_it->command == m_dram->m_commands("REFab_end") ||
-           req_it->command == m_dram->m_commands("REFsb_end")) {
+        if(req_it->command == m_dram->m_ids.cmd.P_ACT     ||
+           req_it->command == m_dram->m_ids.cmd.PRE       ||
+           req_it->command == m_dram->m_ids.cmd.PREA      ||
+           req_it->command == m_dram->m_ids.cmd.P_PRE     ||
+           req_it->command == m_dram->m_ids.cmd.REFab     ||
+           req_it->command == m_dram->m_ids.cmd.REFsb     ||
+           req_it->command == m_dram->m_ids.cmd.REFab_end ||
+           req_it->command == m_dram->m_ids.cmd.REFsb_end) {
           // Single Cycle Command
           cmd_io_cc+=1;
           cmd_cycle_per_pch[req_it->addr_vec[psuedo_ch_idx]]+=1;
@@ -606,8 +606,8 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
           cmd_cycle_per_pch[req_it->addr_vec[psuedo_ch_idx]]+=2;
         }
 
-        if(req_it->command == m_dram->m_commands("RD") || req_it->command == m_dram->m_commands("RDA") || 
-        req_it->command == m_dram->m_commands("WR") || req_it->command == m_dram->m_commands("WRA")) {
+        if(req_it->command == m_dram->m_ids.cmd.RD || req_it->command == m_dram->m_ids.cmd.RDA || 
+        req_it->command == m_dram->m_ids.cmd.WR || req_it->command == m_dram->m_ids.cmd.WRA) {
           s_narrow_io_busy_clk_per_pch[req_it->addr_vec[1]]+=(32);
           s_wide_io_busy_clk_per_pch[req_it->addr_vec[1]]+=(8);
           if(current_sch_mode_per_pch[req_it->addr_vec[1]] == 0)      busy_read_mode_cycle_per_pch[req_it->addr_vec[1]]+=32;
@@ -616,8 +616,8 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
           else if(current_sch_mode_per_pch[req_it->addr_vec[1]] == 3) busy_refresh_mode_cycle_per_pch[req_it->addr_vec[1]]+=32;                              
         }
 
-        if(req_it->command == m_dram->m_commands("POST_RD") || req_it->command == m_dram->m_commands("PRE_WR") || 
-           req_it->command == m_dram->m_commands("NDP_DB_RD") || req_it->command == m_dram->m_commands("NDP_DB_WR")) {
+        if(req_it->command == m_dram->m_ids.cmd.POST_RD || req_it->command == m_dram->m_ids.cmd.PRE_WR || 
+           req_it->command == m_dram->m_ids.cmd.NDP_DB_RD || req_it->command == m_dram->m_ids.cmd.NDP_DB_WR) {
           s_narrow_io_busy_clk_per_pch[req_it->addr_vec[1]]+=(32);
           if(current_sch_mode_per_pch[req_it->addr_vec[1]] == 0)      busy_read_mode_cycle_per_pch[req_it->addr_vec[1]]+=32;
           else if(current_sch_mode_per_pch[req_it->addr_vec[1]] == 1) busy_write_mode_cycle_per_pch[req_it->addr_vec[1]]+=32;
@@ -625,34 +625,34 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
           else if(current_sch_mode_per_pch[req_it->addr_vec[1]] == 3) busy_refresh_mode_cycle_per_pch[req_it->addr_vec[1]]+=32;                    
         }
 
-        if(req_it->command == m_dram->m_commands("PRE_RD") || req_it->command == m_dram->m_commands("PRE_RDA")          || 
-           req_it->command == m_dram->m_commands("POST_WR") || req_it->command == m_dram->m_commands("POST_WRA")        ||
-           req_it->command == m_dram->m_commands("NDP_DRAM_RD") || req_it->command == m_dram->m_commands("NDP_DRAM_WR") ||
-           req_it->command == m_dram->m_commands("NDP_DRAM_RDA") || req_it->command == m_dram->m_commands("NDP_DRAM_WRA")) {
+        if(req_it->command == m_dram->m_ids.cmd.PRE_RD || req_it->command == m_dram->m_ids.cmd.PRE_RDA          || 
+           req_it->command == m_dram->m_ids.cmd.POST_WR || req_it->command == m_dram->m_ids.cmd.POST_WRA        ||
+           req_it->command == m_dram->m_ids.cmd.NDP_DRAM_RD || req_it->command == m_dram->m_ids.cmd.NDP_DRAM_WR ||
+           req_it->command == m_dram->m_ids.cmd.NDP_DRAM_RDA || req_it->command == m_dram->m_ids.cmd.NDP_DRAM_WRA) {
             s_wide_io_busy_clk_per_pch[req_it->addr_vec[1]]+=(8);
         }
 
-        if(req_it->command == m_dram->m_commands("ACT"))                                                                  s_num_act++;
-        if(req_it->command == m_dram->m_commands("PRE") || req_it->command == m_dram->m_commands("PREA"))                 s_num_pre++;
-        if(req_it->command == m_dram->m_commands("P_ACT"))                                                                s_num_p_act++;
-        if(req_it->command == m_dram->m_commands("P_PRE"))                                                                s_num_p_pre++;
-        if(req_it->command == m_dram->m_commands("RD") || req_it->command == m_dram->m_commands("RDA"))                   s_num_rd++;
-        if(req_it->command == m_dram->m_commands("WR") || req_it->command == m_dram->m_commands("WRA"))                   s_num_wr++;
-        if(req_it->command == m_dram->m_commands("NDP_DRAM_RD") || req_it->command == m_dram->m_commands("NDP_DRAM_RDA")) s_num_ndp_dram_rd++;
-        if(req_it->command == m_dram->m_commands("NDP_DRAM_WR") || req_it->command == m_dram->m_commands("NDP_DRAM_WRA")) s_num_ndp_dram_wr++;
-        if(req_it->command == m_dram->m_commands("NDP_DB_RD"))                                                            s_num_ndp_db_rd++;
-        if(req_it->command == m_dram->m_commands("NDP_DB_WR"))                                                            s_num_ndp_db_wr++;              
-
-        if(req_it->command == m_dram->m_commands("RD") || req_it->command == m_dram->m_commands("RDA") || req_it->command == m_dram->m_commands("POST_RD")) s_num_issue_reads++;
-        if(req_it->command == m_dram->m_commands("WR") || req_it->command == m_dram->m_commands("WRA") || req_it->command == m_dram->m_commands("PRE_WR"))  s_num_issue_writes++;
-        if((req_it->command == m_dram->m_commands("RD") || req_it->command == m_dram->m_commands("RDA") || req_it->command == m_dram->m_commands("POST_RD")) || 
-            (req_it->command == m_dram->m_commands("WR") || req_it->command == m_dram->m_commands("WRA") || req_it->command == m_dram->m_commands("PRE_WR"))) {
+        if(req_it->command == m_dram->m_ids.cmd.ACT)                                                                  s_num_act++;
+        if(req_it->command == m_dram->m_ids.cmd.PRE || req_it->command == m_dram->m_ids.cmd.PREA)                 s_num_pre++;
+        if(req_it->command == m_dram->m_ids.cmd.P_ACT)                                                                s_num_p_act++;
+        if(req_it->command == m_dram->m_ids.cmd.P_PRE)                                                                s_num_p_pre++;
+        if(req_it->command == m_dram->m_ids.cmd.RD || req_it->command == m_dram->m_ids.cmd.RDA)                   s_num_rd++;
+        if(req_it->command == m_dram->m_ids.cmd.WR || req_it->command == m_dram->m_ids.cmd.WRA)                   s_num_wr++;
+        if(req_it->command == m_dram->m_ids.cmd.NDP_DRAM_RD || req_it->command == m_dram->m_ids.cmd.NDP_DRAM_RDA) s_num_ndp_dram_rd++;
+        if(req_it->command == m_dram->m_ids.cmd.NDP_DRAM_WR || req_it->command == m_dram->m_ids.cmd.NDP_DRAM_WRA) s_num_ndp_dram_wr++;
+        if(req_it->command == m_dram->m_ids.cmd.NDP_DB_RD)                                                            s_num_ndp_db_rd++;
+        if(req_it->command == m_dram->m_ids.cmd.NDP_DB_WR)                                                            s_num_ndp_db_wr++;              
+
+        if(req_it->command == m_dram->m_ids.cmd.RD || req_it->command == m_dram->m_ids.cmd.RDA || req_it->command == m_dram->m_ids.cmd.POST_RD) s_num_issue_reads++;
+        if(req_it->command == m_dram->m_ids.cmd.WR || req_it->command == m_dram->m_ids.cmd.WRA || req_it->command == m_dram->m_ids.cmd.PRE_WR)  s_num_issue_writes++;
+        if((req_it->command == m_dram->m_ids.cmd.RD || req_it->command == m_dram->m_ids.cmd.RDA || req_it->command == m_dram->m_ids.cmd.POST_RD) || 
+            (req_it->command == m_dram->m_ids.cmd.WR || req_it->command == m_dram->m_ids.cmd.WRA || req_it->command == m_dram->m_ids.cmd.PRE_WR)) {
             s_num_trans_per_pch[req_it->addr_vec[psuedo_ch_idx]]++;
         }
 
-        if(req_it->command == m_dram->m_commands("REFab")) {
+        if(req_it->command == m_dram->m_ids.cmd.REFab) {
           if(use_pseudo_ch) {        
-            int nRFC_latency = m_dram->m_timing_vals("nRFC1");
+            int nRFC_latency = m_dram->m_timing_vals(m_dram->m_ids.timing.nRFC1.required());
             int pch_addr = req_it->addr_vec[psuedo_ch_idx];
             s_num_refresh_cc_per_pch[pch_addr]+=nRFC_latency;
           }    
@@ -695,14 +695,14 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
         if(false 
            /*
            true && req_it->addr_vec[0]==0 && req_it->addr_vec[1]==0 && (
-           req_it->command == m_dram->m_commands("RD") ||
-           req_it->command == m_dram->m_commands("RDA") ||
-           req_it->command == m_dram->m_commands("WR") ||
-           req_it->command == m_dram->m_commands("WRA") ||
-           req_it->command == m_dram->m_commands("POST_RD") ||
-           req_it->command == m_dram->m_commands("POST_WR") ||
-           req_it->command == m_dram->m_commands("PRE_RD") ||
-           req_it->command == m_dram->m_commands("PRE_WR"))*/ 
+           req_it->command == m_dram->m_ids.cmd.RD ||
+           req_it->command == m_dram->m_ids.cmd.RDA ||
+           req_it->command == m_dram->m_ids.cmd.WR ||
+           req_it->command == m_dram->m_ids.cmd.WRA ||
+           req_it->command == m_dram->m_ids.cmd.POST_RD ||
+           req_it->command == m_dram->m_ids.cmd.POST_WR ||
+           req_it->command == m_dram->m_ids.cmd.PRE_RD ||
+           req_it->command == m_dram->m_ids.cmd.PRE_WR)*/ 
           ) {
             std::cout<<"["<<m_clk<<"]["<<(m_clk-pre_clk)<<"] ";
             pre_clk = m_clk;          
@@ -736,7 +736,7 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
             // std::cout<<"["<<m_clk<<"]"<<"[NDP-MC] num_ndp_rd_req ["<<num_ndp_rd_req<<"] num_ndp_wr_req ["<<num_ndp_wr_req<<"]"<<std::endl;
           }
 
-          if(req_it->command == m_dram->m_commands("PRE_WR") || req_it->command == m_dram->m_commands("POST_RD")) {
+          if(req_it->command == m_dram->m_ids.cmd.PRE_WR || req_it->command == m_dram->m_ids.cmd.POST_RD) {
             if(m_dram->check_ch_refrsehing(req_it->addr_vec)) {
               s_num_busy_refresh_cc_per_pch[req_it->addr_vec[psuedo_ch_idx]]+=(8*4);
             }
@@ -744,8 +744,8 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
 
           // Move issued Read Request to pending buffer
           if (req_it->type_id == Request::Type::Read) {
-            if(!(req_it->command == m_dram->m_commands("PRE_RD") || req_it->command == m_dram->m_commands("PRE_RDA") ||   
-                 req_it->command == m_dram->m_commands("NDP_DRAM_RD") || req_it->command == m_dram->m_commands("NDP_DRAM_RDA"))) {
+            if(!(req_it->command == m_dram->m_ids.cmd.PRE_RD || req_it->command == m_dram->m_ids.cmd.PRE_RDA ||   
+                 req_it->command == m_dram->m_ids.cmd.NDP_DRAM_RD || req_it->command == m_dram->m_ids.cmd.NDP_DRAM_RDA)) {
               req_it->depart = m_clk + m_dram->m_read_latency;
               pending.push_back(*req_it);  
             }
@@ -753,12 +753,12 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
             // TODO: Add code to update statistics
           }
           
-          if(req_it->command == m_dram->m_commands("PRE_WR")) {
+          if(req_it->command == m_dram->m_ids.cmd.PRE_WR) {
             // Generate POST_WR and Enqueue to Prefetched Buffer
             Request new_req = Request(req_it->addr_vec, Request::Type::Write);
             new_req.addr          = req_it->addr;
             new_req.arrive        = req_it->arrive;
-            new_req.final_command = m_dram->m_commands("POST_WR");
+            new_req.final_command = m_dram->m_ids.cmd.POST_WR.required();
             bool is_success = false;              
 
             buffer->remove(req_it);
@@ -770,14 +770,14 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
             if(!is_success) {
               throw std::runtime_error("Fail to enque to m_wr_prefetch_buffers");
             }                    
-          } else if(req_it->command == m_dram->m_commands("PRE_RD") || req_it->command == m_dram->m_commands("PRE_RDA")) {
+          } else if(req_it->command == m_dram->m_ids.cmd.PRE_RD || req_it->command == m_dram->m_ids.cmd.PRE_RDA) {
             // Generate POST_RD and Enqueue to Prefetched Buffer
             Request new_req = Request(req_it->addr_vec, Request::Type::Read);
             new_req.addr          = req_it->addr;
             new_req.arrive        = req_it->arrive;
             new_req.source_id     = req_it->source_id;
             new_req.callback      = req_it->callback;
-            new_req.final_command = m_dram->m_commands("POST_RD");
+            new_req.final_command = m_dram->m_ids.cmd.POST_RD.required();
             bool is_success = false;              
 
             buffer->remove(req_it);
@@ -899,7 +899,7 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
             // Check if this requests accesses the DRAM or is being forwarded.
             // TODO add the stats back
             s_read_latency += req.depart - req.arrive;
-            if((req.command == m_dram->m_commands("RD")) || (req.command == m_dram->m_commands("RDA"))) {
+            if((req.command == m_dram->m_ids.cmd.RD) || (req.command == m_dram->m_ids.cmd.RDA)) {
               s_normal_read_latency += req.depart - req.arrive;
             }
             // std::cout<<" RD latency ["<<(req.depart - req.arrive)<<"] ";
@@ -1032,8 +1032,8 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
                     request_found = m_dram->check_ready(req_it->command, req_it->addr_vec);
                     req_buffer = &m_read_buffers[pch_idx];   
                     if(request_found) {
-                      if(req_it->final_command == m_dram->m_commands("RD") || req_it->final_command == m_dram->m_commands("RDA")) {
-                        if(!(req_it->command == m_dram->m_commands("PRE") || req_it->command == m_dram->m_commands("P_PRE"))) {
+                      if(req_it->final_command == m_dram->m_ids.cmd.RD || req_it->final_command == m_dram->m_ids.cmd.RDA) {
+                        if(!(req_it->command == m_dram->m_ids.cmd.PRE || req_it->command == m_dram->m_ids.cmd.P_PRE)) {
                           req_it->is_db_cmd = true;  
                         }
                       }
@@ -1107,8 +1107,8 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
                     request_found = m_dram->check_ready(req_it->command, req_it->addr_vec);
                     req_buffer = &m_read_buffers[pch_idx];   
                     if(request_found) {
-                      if(req_it->final_command == m_dram->m_commands("RD") || req_it->final_command == m_dram->m_commands("RDA")) {
-                        if(!(req_it->command == m_dram->m_commands("PRE") || req_it->command == m_dram->m_commands("P_PRE"))) {
+                      if(req_it->final_command == m_dram->m_ids.cmd.RD || req_it->final_command == m_dram->m_ids.cmd.RDA) {
+                        if(!(req_it->command == m_dram->m_ids.cmd.PRE || req_it->command == m_dram->m_ids.cmd.P_PRE)) {
                           req_it->is_db_cmd = true;  
                         }
                       }
@@ -1195,7 +1195,7 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
             if (is_matching) {
               request_found = false;
               if(use_pseudo_ch) {
-                if(req_it->command == m_dram->m_commands("P_PRE")) req_it->is_db_cmd = false;
+                if(req_it->command == m_dram->m_ids.cmd.P_PRE) req_it->is_db_cmd = false;
                   // m_dram->print_req(*req_it);
               }
               break;
@@ -1220,11 +1220,11 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
       // GB/s 
       // Request Bandwidth, DQ Bandwidth, Max DQ Bandwidth
       int tx_bytes = m_dram->m_internal_prefetch_size * m_dram->m_channel_width / 8;
-      s_bandwidth = ((float)((s_num_read_reqs + s_num_write_reqs) * tx_bytes) / (float)(m_clk * m_dram->m_timing_vals("tCK_ps"))) * 1E12 / (1024*1024*1012);
-      s_dq_bandwidth = ((float)((s_num_issue_reads + s_num_issue_writes) * tx_bytes) / (float)(m_clk * m_dram->m_timing_vals("tCK_ps"))) * 1E12 / (1024*1024*1012);
+      s_bandwidth = ((float)((s_num_read_reqs + s_num_write_reqs) * tx_bytes) / (float)(m_clk * m_dram->m_timing_vals(m_dram->m_ids.timing.tCK_ps.required()))) * 1E12 / (1024*1024*1012);
+      s_dq_bandwidth = ((float)((s_num_issue_reads + s_num_issue_writes) * tx_bytes) / (float)(m_clk * m_dram->m_timing_vals(m_dram->m_ids.timing.tCK_ps.required()))) * 1E12 / (1024*1024*1012);
       // rate unit is MT/s 
       // 10^6 T/s --> /(2^30) GB/s
-      s_max_bandwidth = (float)(m_dram->m_channel_width / 8) * (float)m_dram->m_timing_vals("rate") * 1E6 / (1024*1024*1012);      
+      s_max_bandwidth = (float)(m_dram->m_channel_width / 8) * (float)m_dram->m_timing_vals(m_dram->m_ids.timing.rate.required()) * 1E6 / (1024*1024*1012);      
 
       // I/O Utilization (%)
       s_cmd_io_util = 100 * (float) cmd_io_cc / (float) m_clk;    
@@ -1236,10 +1236,10 @@ class NDPDRAMController final : public IDRAMController, public Implementation {
         // Double Data Rate 
         total_transfer_data += 2 * m_dram->m_organization.dq * 4 * io_busy_clk * 2;
       }
-      s_effective_bandwidth = ((float)(total_transfer_data/8)/(float)(m_clk * m_dram->m_timing_vals("tCK_ps"))) * 1E12 / (1024*1024*1012);
+      s_effective_bandwidth = ((float)(total_transfer_data/8)/(float)(m_clk * m_dram->m_timing_vals(m_dram->m_ids.timing.tCK_ps.required()))) * 1E12 / (1024*1024*1012);
 
       // Max Effective Bandwidth (except refresh)
-      float refresh_ratio = ((float)m_dram->m_timing_vals("nRFC1")/(float)m_dram->m_timing_vals("nREFI"));
+      float refresh_ratio = ((float)m_dram->m_timing_vals(m_dram->m_ids.timing.nRFC1.required())/(float)m_dram->m_timing_vals(m_dram->m_ids.timing.nREFI.required()));
       s_max_effective_bandwidth = s_max_bandwidth * (float)num_pseudochannel * (1.0 - refresh_ratio);      
       
       /*
@@ -44,8 +44,8 @@ public:
 
         m_consequtive_src_id = 0;
 
-        m_cmd_rd = m_cfg.m_dram->m_commands("RD");
-        m_cmd_wr = m_cfg.m_dram->m_commands("WR");
+        m_cmd_rd = m_cfg.m_dram->m_ids.cmd.RD.required();
+        m_cmd_wr = m_cfg.m_dram->m_ids.cmd.WR.required();
 
         register_stat(s_blacklist_count).name("bliss_blacklist_count");
     }
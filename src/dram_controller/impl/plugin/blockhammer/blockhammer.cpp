@@ -105,10 +105,10 @@ class BlockHammer : public IControllerPlugin, public Implementation, public IBlo
       m_ctrl = cast_parent<IDRAMController>();
       m_dram = m_ctrl->m_dram;
 
-      m_rank_level = m_dram->m_levels("rank");
-      m_bank_group_level = m_dram->m_levels("bankgroup");
-      m_bank_level = m_dram->m_levels("bank");
-      m_row_level = m_dram->m_levels("row");
+      m_rank_level = m_dram->m_ids.level.rank.required();
+      m_bank_group_level = m_dram->m_ids.level.bankgroup.required();
+      m_bank_level = m_dram->m_ids.level.bank.required();
+      m_row_level = m_dram->m_ids.level.row.required();
 
       m_num_ranks = m_dram->get_level_size("rank");
       m_num_banks_per_rank = m_dram->get_level_size("bankgroup") == -1 ? 
@@ -120,12 +120,12 @@ class BlockHammer : public IControllerPlugin, public Implementation, public IBlo
 
       m_num_mshr_per_core = m_llc->get_mshrs_per_core();
 
-      m_bf_len_epoch_clk = m_bf_len_epoch / ((float) m_dram->m_timing_vals("tCK_ps") / 1000.0f);
+      m_bf_len_epoch_clk = m_bf_len_epoch / ((float) m_dram->m_timing_vals(m_dram->m_ids.timing.tCK_ps.required()) / 1000.0f);
 
       float tDelay = (m_bf_len_epoch - (m_bf_ctr_thresh * m_bf_trc));
       tDelay /= ((float) (m_bf_len_epoch / m_bf_trefw) * m_bf_num_rh - m_bf_ctr_thresh);
 
-      m_bf_hist_size = tDelay / ((float) m_dram->m_timing_vals("tCK_ps") / 1000.0f);
+      m_bf_hist_size = tDelay / ((float) m_dram->m_timing_vals(m_dram->m_ids.timing.tCK_ps.required()) / 1000.0f);
 
       if (m_bf_hist_size < 0) {
         std::cout << "[Ramulator::BlockHammerPlugin] Row History Buffer size must be positive." << std::endl;
@@ -48,11 +48,25 @@ class CommandCounter : public IControllerPlugin, public Implementation {
     };
 
     void update(bool request_found, ReqBuffer::iterator& req_it) override {
+      RAMULATOR_PROFILE_SCOPE();
       if (request_found) {
         m_command_counters[req_it->command]++;
       }
     };
 
+    // Only the commands of the detailed simulation are counted
+    void functional_update(int command, const AddrVec_t& addr_vec) override { };
+
+    void check_functional_access() override { };
+
+    Clk_t get_next_event_clk() override {
+      return std::numeric_limits<Clk_t>::max();
+    };
+
+    void serialize(Archive& ar) override {
+      ar & m_command_counters;
+    };
+
     void finalize() override {
       std::ofstream output(m_save_path);
       for (const auto& [cmd_id, count] : m_command_counters) {
@@ -13,11 +13,11 @@ DeviceConfig::~DeviceConfig() { /* Currently no-op */ }
 void DeviceConfig::set_device(IDRAMController* ctrl) {
     m_ctrl = ctrl;
     m_dram = ctrl->m_dram;
-    m_rank_level = m_dram->m_levels("rank");
-    m_bank_level = m_dram->m_levels("bank");
-    m_bankgroup_level = m_dram->m_levels("bankgroup");
-    m_row_level = m_dram->m_levels("row");
-    m_col_level = m_dram->m_levels("column");
+    m_rank_level = m_dram->m_ids.level.rank.required();
+    m_bank_level = m_dram->m_ids.level.bank.required();
+    m_bankgroup_level = m_dram->m_ids.level.bankgroup.required();
+    m_row_level = m_dram->m_ids.level.row.required();
+    m_col_level = m_dram->m_ids.level.column.required();
 
     m_num_ranks = m_dram->get_level_size("rank");
     m_num_bankgroups = m_dram->get_level_size("bankgroup");
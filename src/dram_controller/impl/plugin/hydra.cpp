@@ -136,17 +136,17 @@ class Hydra : public IControllerPlugin, public Implementation {
         throw ConfigurationError("Hydra is not compatible with the DRAM implementation that does not have Victim-Row-Refresh (VRR) command!");
       }
 
-      m_reset_period_clk = m_reset_period_ns / ((float) m_dram->m_timing_vals("tCK_ps") / 1000.0f);
+      m_reset_period_clk = m_reset_period_ns / ((float) m_dram->m_timing_vals(m_dram->m_ids.timing.tCK_ps.required()) / 1000.0f);
 
-      m_VRR_req_id = m_dram->m_requests("victim-row-refresh");
-      m_RD_req_id = m_dram->m_requests("read");
-      m_WR_req_id = m_dram->m_requests("write");
+      m_VRR_req_id = m_dram->m_ids.req.victim_row_refresh.required();
+      m_RD_req_id = m_dram->m_ids.req.read.required();
+      m_WR_req_id = m_dram->m_ids.req.write.required();
 
-      m_rank_level = m_dram->m_levels("rank");
-      m_bank_group_level = m_dram->m_levels("bankgroup");
-      m_bank_level = m_dram->m_levels("bank");
-      m_row_level = m_dram->m_levels("row");
-      m_col_level = m_dram->m_levels("column");
+      m_rank_level = m_dram->m_ids.level.rank.required();
+      m_bank_group_level = m_dram->m_ids.level.bankgroup.required();
+      m_bank_level = m_dram->m_ids.level.bank.required();
+      m_row_level = m_dram->m_ids.level.row.required();
+      m_col_level = m_dram->m_ids.level.column.required();
 
       m_num_ranks = m_dram->get_level_size("rank");
       m_num_banks_per_rank = m_dram->get_level_size("bankgroup") == -1 ? 
@@ -368,7 +368,7 @@ class Hydra : public IControllerPlugin, public Implementation {
               }
               // generate write request to DRAM for rct
               for (int i = 0; i < m_group_rct_cl_size; i++){
-                std::vector<int> rct_init_addr_vec;
+                AddrVec_t rct_init_addr_vec;
                 for (int j = 0; j < req_it->addr_vec.size(); j++){
                   rct_init_addr_vec.push_back(req_it->addr_vec[j]);
                 }
@@ -415,7 +415,7 @@ class Hydra : public IControllerPlugin, public Implementation {
                   std::cout << "Hydra: RCC full, evicting " << tag_to_evict << std::endl;
                 }
                 // generate write request to DRAM for evicted entry
-                std::vector<int> evicted_entry_addr_vec;
+                AddrVec_t evicted_entry_addr_vec;
                 for (int i = 0; i < req_it->addr_vec.size(); i++){
                   evicted_entry_addr_vec.push_back(req_it->addr_vec[i]);
                 }
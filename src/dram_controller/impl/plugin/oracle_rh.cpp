@@ -47,11 +47,11 @@ class OracleRH : public IControllerPlugin, public Implementation {
         throw ConfigurationError("OracleRH is not compatible with the DRAM implementation that does not have Victim-Row-Refresh (VRR) command!");
       }
 
-      m_VRR_req_id = m_dram->m_requests("victim-row-refresh");
+      m_VRR_req_id = m_dram->m_ids.req.victim_row_refresh.required();
 
-      m_rank_level = m_dram->m_levels("rank");
-      m_bank_level = m_dram->m_levels("bank");
-      m_row_level = m_dram->m_levels("row");
+      m_rank_level = m_dram->m_ids.level.rank.required();
+      m_bank_level = m_dram->m_ids.level.bank.required();
+      m_row_level = m_dram->m_ids.level.row.required();
 
       m_num_ranks = m_dram->get_level_size("rank");
       m_num_banks_per_rank = m_dram->get_level_size("bankgroup") == -1 ? 
@@ -47,9 +47,9 @@ class PARA : public IControllerPlugin, public Implementation {
         throw ConfigurationError("PARA is not compatible with the DRAM implementation that does not have Victim-Row-Refresh (VRR) command!");
       }
 
-      m_VRR_req_id = m_dram->m_requests("victim-row-refresh");
-      m_bank_level = m_dram->m_levels("bank");
-      m_row_level = m_dram->m_levels("row");
+      m_VRR_req_id = m_dram->m_ids.req.victim_row_refresh.required();
+      m_bank_level = m_dram->m_ids.level.bank.required();
+      m_row_level = m_dram->m_ids.level.row.required();
     };
 
     void update(bool request_found, ReqBuffer::iterator& req_it) override {
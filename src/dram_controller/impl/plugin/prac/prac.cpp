@@ -57,7 +57,7 @@ public:
         init_dram_params(m_cfg.m_dram);
 
         m_is_abo_needed = false;
-        m_abo_act_cycles = m_abo_act_ns / ((float) m_cfg.m_dram->m_timing_vals("tCK_ps") / 1000.0f);
+        m_abo_act_cycles = m_abo_act_ns / ((float) m_cfg.m_dram->m_timing_vals(m_cfg.m_dram->m_ids.timing.tCK_ps.required()) / 1000.0f);
 
         m_bank_counters.reserve(m_cfg.m_num_banks);
         for (int i = 0; i < m_cfg.m_num_banks; i++) {
@@ -117,10 +117,10 @@ public:
             {ABOState::RECOVERY, "ABOState::RECOVERY"},
             {ABOState::DELAY, "ABOState::DELAY"}
         };
-        auto cmd_prea = m_cfg.m_dram->m_commands("PREA");
-        auto cmd_rfmab = m_cfg.m_dram->m_commands("RFMab");
-        auto cmd_rfmsb = m_cfg.m_dram->m_commands("RFMsb");
-        auto cmd_act = m_cfg.m_dram->m_commands("ACT");
+        auto cmd_prea = m_cfg.m_dram->m_ids.cmd.PREA.required();
+        auto cmd_rfmab = m_cfg.m_dram->m_ids.cmd.RFMab.required();
+        auto cmd_rfmsb = m_cfg.m_dram->m_ids.cmd.RFMsb.required();
+        auto cmd_act = m_cfg.m_dram->m_ids.cmd.ACT.required();
         auto cur_state = m_state;
         switch(m_state) {
         case ABOState::NORMAL:
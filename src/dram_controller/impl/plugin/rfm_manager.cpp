@@ -47,13 +47,13 @@ public:
             std::cout << "[Ramulator::RFMManager] [CRITICAL ERROR] DRAM Device does not support request: rfm" << std::endl; 
             exit(0);
         }
-        m_rfm_req_id = m_dram->m_requests("rfm");
+        m_rfm_req_id = m_dram->m_ids.req.rfm.required();
 
-        m_rank_level = m_dram->m_levels("rank");
-        m_bank_level = m_dram->m_levels("bank");
-        m_bankgroup_level = m_dram->m_levels("bankgroup");
-        m_row_level = m_dram->m_levels("row");
-        m_col_level = m_dram->m_levels("column");
+        m_rank_level = m_dram->m_ids.level.rank.required();
+        m_bank_level = m_dram->m_ids.level.bank.required();
+        m_bankgroup_level = m_dram->m_ids.level.bankgroup.required();
+        m_row_level = m_dram->m_ids.level.row.required();
+        m_col_level = m_dram->m_ids.level.column.required();
 
         m_num_ranks = m_dram->get_level_size("rank");
         m_num_bankgroups = m_dram->get_level_size("bankgroup");
@@ -74,6 +74,7 @@ public:
     }
 
     void update(bool request_found, ReqBuffer::iterator& req_it) override {
+        RAMULATOR_PROFILE_SCOPE();
         m_clk++;
 
         if (!request_found) {
@@ -81,45 +82,80 @@ public:
         }
 
         auto& req = *req_it;
-        auto& req_meta = m_dram->m_command_meta(req.command);
-        auto& req_scope = m_dram->m_command_scopes(req.command);
-        if (!(req_meta.is_opening && req_scope == m_row_level)) {
-            return; 
+        if (!count_activation(req.command, req.addr_vec)) {
+            return;
         }
 
-        int flat_bank_id = req_it->addr_vec[m_bank_level];
+        Request rfm(req.addr_vec, m_rfm_req_id);
+        rfm.addr_vec[m_bankgroup_level] = -1;
+        rfm.addr_vec[m_bank_level] = -1;
+        // TODO: Add a buffer to retry later
+        if (!m_ctrl->priority_send(rfm)) {
+            std::cout << "[Ramulator::RFMManager] [CRITICAL ERROR] Could not send request: rfm" << std::endl; 
+            exit(0);
+        }
+        s_rfm_counter++;
+    }
+
+    void functional_update(int command, const AddrVec_t& addr_vec) override {
+        if (!count_activation(command, addr_vec)) {
+            return;
+        }
+
+        // The RFM is applied functionally as well, so that it closes the banks as in a detailed run
+        Request rfm(addr_vec, m_rfm_req_id);
+        rfm.addr_vec[m_bankgroup_level] = -1;
+        rfm.addr_vec[m_bank_level] = -1;
+        m_ctrl->functional_access(rfm);
+    }
+
+    void check_functional_access() override { }
+
+    Clk_t get_next_event_clk() override {
+        return std::numeric_limits<Clk_t>::max();
+    }
+
+    void fast_forward(Clk_t clk) override {
+        m_clk = clk;
+    }
+
+    void serialize(Archive& ar) override {
+        ar & m_bank_ctrs & m_clk;
+    }
+
+private:
+    // Counts the command if it activates a row. Returns true (and resets the counters) when an RFM is due.
+    bool count_activation(int command, const AddrVec_t& addr_vec) {
+        auto& cmd_meta = m_dram->m_command_meta(command);
+        auto& cmd_scope = m_dram->m_command_scopes(command);
+        if (!(cmd_meta.is_opening && cmd_scope == m_row_level)) {
+            return false;
+        }
+
+        int flat_bank_id = addr_vec[m_bank_level];
         int accumulated_dimension = 1;
         for (int i = m_bank_level - 1; i >= m_rank_level; i--) {
             accumulated_dimension *= m_dram->m_organization.count[i + 1];
-            flat_bank_id += req_it->addr_vec[i] * accumulated_dimension;
+            flat_bank_id += addr_vec[i] * accumulated_dimension;
         }
 
         m_bank_ctrs[flat_bank_id]++;
 
         if (m_debug) {
-            std::cout << "Rank     : " << req_it->addr_vec[m_rank_level] << std::endl;
-            std::cout << "Bank     : " << req_it->addr_vec[m_bank_level] << std::endl;
-            std::cout << "BankGroup: " << req_it->addr_vec[m_bankgroup_level] << std::endl;
+            std::cout << "Rank     : " << addr_vec[m_rank_level] << std::endl;
+            std::cout << "Bank     : " << addr_vec[m_bank_level] << std::endl;
+            std::cout << "BankGroup: " << addr_vec[m_bankgroup_level] << std::endl;
             std::cout << "Flat Bank: " << flat_bank_id << std::endl;
         }
 
         if (m_bank_ctrs[flat_bank_id] < m_rfm_thresh) {
-            return;
+            return false;
         }
-         
+
         for (int i = 0; i < m_bank_ctrs.size(); i++) {
             m_bank_ctrs[i] = 0;
         }
-
-        Request rfm(req.addr_vec, m_rfm_req_id);
-        rfm.addr_vec[m_bankgroup_level] = -1;
-        rfm.addr_vec[m_bank_level] = -1;
-        // TODO: Add a buffer to retry later
-        if (!m_ctrl->priority_send(rfm)) {
-            std::cout << "[Ramulator::RFMManager] [CRITICAL ERROR] Could not send request: rfm" << std::endl; 
-            exit(0);
-        }
-        s_rfm_counter++;
+        return true;
     }
 };
 
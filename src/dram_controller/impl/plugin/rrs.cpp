@@ -71,15 +71,15 @@ class RRS : public IControllerPlugin, public Implementation {
       m_dram = m_ctrl->m_dram;
       m_addr_mapper = (LinearMapperBase_with_rit*) memory_system->get_ifce<IAddrMapper>();
 
-      m_reset_period_clk = m_reset_period_ns / ((float) m_dram->m_timing_vals("tCK_ps") / 1000.0f);
+      m_reset_period_clk = m_reset_period_ns / ((float) m_dram->m_timing_vals(m_dram->m_ids.timing.tCK_ps.required()) / 1000.0f);
 
-      m_RD_req_id = m_dram->m_requests("read");
-      m_WR_req_id = m_dram->m_requests("write");
+      m_RD_req_id = m_dram->m_ids.req.read.required();
+      m_WR_req_id = m_dram->m_ids.req.write.required();
 
-      m_rank_level = m_dram->m_levels("rank");
-      m_bank_level = m_dram->m_levels("bank");
-      m_row_level = m_dram->m_levels("row");
-      m_col_level = m_dram->m_levels("column");
+      m_rank_level = m_dram->m_ids.level.rank.required();
+      m_bank_level = m_dram->m_ids.level.bank.required();
+      m_row_level = m_dram->m_ids.level.row.required();
+      m_col_level = m_dram->m_ids.level.column.required();
 
       m_num_ranks = m_dram->get_level_size("rank");
       m_num_banks_per_rank = m_dram->get_level_size("bankgroup") == -1 ? 
@@ -363,7 +363,7 @@ class RRS : public IControllerPlugin, public Implementation {
 
     void issue_swap(ReqBuffer::iterator& req_it, int src_row, int dst_row) {
       // load addr_vec
-      std::vector<int> addr_vec;
+      AddrVec_t addr_vec;
       for (int i = 0; i < req_it->addr_vec.size(); i++){
         addr_vec.push_back(req_it->addr_vec[i]);
       }
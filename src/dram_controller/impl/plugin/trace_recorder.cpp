@@ -44,6 +44,7 @@ class TraceRecorder : public IControllerPlugin, public Implementation {
     };
 
     void update(bool request_found, ReqBuffer::iterator& req_it) override {
+      RAMULATOR_PROFILE_SCOPE();
       m_clk++;
 
       if (request_found) {
@@ -57,6 +58,19 @@ class TraceRecorder : public IControllerPlugin, public Implementation {
 
     };
 
+    Clk_t get_next_event_clk() override {
+      return std::numeric_limits<Clk_t>::max();
+    };
+
+    void fast_forward(Clk_t clk) override {
+      m_clk = clk;
+    };
+
+    void serialize(Archive& ar) override {
+      // The commands issued before the checkpoint are in the trace of the checkpointed run
+      ar & m_clk;
+    };
+
 };
 
 }       // namespace Ramulator
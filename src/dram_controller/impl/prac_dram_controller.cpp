@@ -78,22 +78,22 @@ public:
     void setup(IFrontEnd* frontend, IMemorySystem* memory_system) override {
         m_llc = static_cast<BHO3*>(frontend)->get_llc();
         m_dram = memory_system->get_ifce<IDRAM>();
-        m_rank_addr_idx = m_dram->m_levels("rank");
-        m_bankgroup_addr_idx = m_dram->m_levels("bankgroup");
-        m_bank_addr_idx = m_dram->m_levels("bank");
-        m_row_addr_idx = m_dram->m_levels("row");
+        m_rank_addr_idx = m_dram->m_ids.level.rank.required();
+        m_bankgroup_addr_idx = m_dram->m_ids.level.bankgroup.required();
+        m_bank_addr_idx = m_dram->m_ids.level.bank.required();
+        m_row_addr_idx = m_dram->m_ids.level.row.required();
         m_priority_buffer.max_size = 512*3 + 32;
 
-        std::vector<int> all_bank_addr_vec(m_dram->m_levels.size(), -1);
-        all_bank_addr_vec[m_dram->m_levels("channel")] = m_channel_id;
-        int m_prea_id = m_dram->m_commands("PREA");
-        int m_rfmab_id = m_dram->m_commands("RFMab");
+        AddrVec_t all_bank_addr_vec(m_dram->m_levels.size(), -1);
+        all_bank_addr_vec[m_dram->m_ids.level.channel.required()] = m_channel_id;
+        int m_prea_id = m_dram->m_ids.cmd.PREA.required();
+        int m_rfmab_id = m_dram->m_ids.cmd.RFMab.required();
         
-        m_prea_template = new Request(all_bank_addr_vec, m_dram->m_requests("close-all-bank"));
+        m_prea_template = new Request(all_bank_addr_vec, m_dram->m_ids.req.close_all_bank.required());
         m_prea_template->command = m_prea_id;
         m_prea_template->final_command = m_prea_id;
 
-        m_rfmab_template = new Request(all_bank_addr_vec, m_dram->m_requests("rfm"));
+        m_rfmab_template = new Request(all_bank_addr_vec, m_dram->m_ids.req.rfm.required());
         m_rfmab_template->command = m_rfmab_id;
         m_rfmab_template->final_command = m_rfmab_id;
         
@@ -167,17 +167,17 @@ public:
         m_scheduler->tick();
 
         // Do we need to setup for the ABO recovery period?
-        bool is_recovery_starting = m_prac->next_recovery_cycle() - m_clk <= m_dram->m_timing_vals("nRP") + 5;
+        bool is_recovery_starting = m_prac->next_recovery_cycle() - m_clk <= m_dram->m_timing_vals(m_dram->m_ids.timing.nRP.required()) + 5;
         bool is_recovery_setup = m_prac_buffer.size() != 0;
         if (is_recovery_starting && !is_recovery_setup) {
             for (int i = 0; i < m_dram->get_level_size("rank"); i++) {
-                m_prea_template->addr_vec[m_dram->m_levels("rank")] = i;
+                m_prea_template->addr_vec[m_dram->m_ids.level.rank.required()] = i;
                 m_prac_buffer.enqueue(*m_prea_template);
             }
             for (int i = 0; i < m_prac->get_num_abo_recovery_refs(); i++) {
                 // Alternate ranks, as PRIO/PRAC queue is served FCFS
                 for (int j = 0; j < m_dram->get_level_size("rank"); j++) {
-                    m_rfmab_template->addr_vec[m_dram->m_levels("rank")] = j;
+                    m_rfmab_template->addr_vec[m_dram->m_ids.level.rank.required()] = j;
                     m_prac_buffer.enqueue(*m_rfmab_template);
                 }
             }
@@ -204,7 +204,7 @@ public:
             if (req_it->command == req_it->final_command) {
                 if (req_it->type_id == Request::Type::Read) {
                     req_it->depart = m_clk + m_dram->m_read_latency;
-                    pending.push_back(*req_it);
+                    pending.push_back(std::move(*req_it));
                 }
                 else if (req_it->type_id == Request::Type::Write) {
                     // TODO: Add code to update statistics
@@ -212,8 +212,7 @@ public:
                 buffer->remove(req_it);
             }
             else if (m_dram->m_command_meta(req_it->command).is_opening) {
-                m_active_buffer.enqueue(*req_it);
-                buffer->remove(req_it);
+                buffer->move_to(req_it, m_active_buffer);
             }
         }
 
@@ -288,7 +287,7 @@ private:
                 req_it = m_prac_buffer.begin();
                 req_it->command = m_dram->get_preq_command(req_it->final_command, req_it->addr_vec);
 
-                bool is_rfm = req_it->command == m_dram->m_commands("RFMab");
+                bool is_rfm = req_it->command == m_dram->m_ids.cmd.RFMab;
                 bool is_pre_rec = m_prac->get_state() == IPRAC::ABOState::PRE_RECOVERY;
                 bool early_issue = is_rfm && is_pre_rec; // Prevent controller from issuing RFMab before recovery starts
                 request_found = !early_issue && m_dram->check_ready(req_it->command, req_it->addr_vec);
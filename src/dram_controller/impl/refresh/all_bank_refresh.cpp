@@ -31,19 +31,20 @@ class AllBankRefresh : public IRefreshManager, public Implementation {
       m_dram_org_levels = m_dram->m_levels.size();
       m_num_ranks = m_dram->get_level_size("rank");
 
-      m_nrefi = m_dram->m_timing_vals("nREFI");
-      m_ref_req_id = m_dram->m_requests("all-bank-refresh");
+      m_nrefi = m_dram->m_timing_vals(m_dram->m_ids.timing.nREFI.required());
+      m_ref_req_id = m_dram->m_ids.req.all_bank_refresh.required();
 
       m_next_refresh_cycle = m_nrefi/8;
     };
 
     void tick() {
+      RAMULATOR_PROFILE_SCOPE();
       m_clk++;
 
       if (m_clk == m_next_refresh_cycle) {
         m_next_refresh_cycle += m_nrefi;
         for (int r = 0; r < m_num_ranks; r++) {
-          std::vector<int> addr_vec(m_dram_org_levels, -1);
+          AddrVec_t addr_vec(m_dram_org_levels, -1);
           addr_vec[0] = m_ctrl->m_channel_id;
           addr_vec[1] = r;
           Request req(addr_vec, m_ref_req_id);
@@ -56,6 +57,19 @@ class AllBankRefresh : public IRefreshManager, public Implementation {
       }
     };
 
+
+    Clk_t get_next_event_clk() override {
+      return m_next_refresh_cycle;
+    };
+
+    void fast_forward(Clk_t clk) override {
+      m_clk = clk;
+    };
+
+    void serialize(Archive& ar) override {
+      ar & m_clk & m_next_refresh_cycle;
+    };
+
 };
 
 }       // namespace Ramulator
@@ -36,9 +36,9 @@ class DR5PCHAllBankRefresh : public IRefreshManager, public Implementation {
       m_num_pseudochannels = m_dram->get_level_size("pseudochannel");
       m_num_ranks = m_dram->get_level_size("rank");
 
-      m_nrefi = m_dram->m_timing_vals("nREFI");
-      m_nrfc  = m_dram->m_timing_vals("nRFC1");
-      m_ref_req_id = m_dram->m_requests("all-bank-refresh");
+      m_nrefi = m_dram->m_timing_vals(m_dram->m_ids.timing.nREFI.required());
+      m_nrfc  = m_dram->m_timing_vals(m_dram->m_ids.timing.nRFC1.required());
+      m_ref_req_id = m_dram->m_ids.req.all_bank_refresh.required();
 
       // Prefetch Cycle (Max 8*16*1.5)
 
@@ -46,13 +46,14 @@ class DR5PCHAllBankRefresh : public IRefreshManager, public Implementation {
     };
 
     void tick() {
+      RAMULATOR_PROFILE_SCOPE();
       m_clk++;
     
       if (m_clk == m_next_refresh_cycle) {
         m_next_refresh_cycle += m_nrefi;
         for (int p = 0; p < m_num_pseudochannels; p++) {
           for (int r = 0; r < m_num_ranks; r++) {
-            std::vector<int> addr_vec(m_dram_org_levels, -1);
+            AddrVec_t addr_vec(m_dram_org_levels, -1);
             addr_vec[0] = m_ctrl->m_channel_id;
             addr_vec[1] = p; // pseudo channel 
             addr_vec[2] = 0; // narrow-I/O
@@ -69,6 +70,19 @@ class DR5PCHAllBankRefresh : public IRefreshManager, public Implementation {
       }
     };
 
+
+    Clk_t get_next_event_clk() override {
+      return m_next_refresh_cycle;
+    };
+
+    void fast_forward(Clk_t clk) override {
+      m_clk = clk;
+    };
+
+    void serialize(Archive& ar) override {
+      ar & m_clk & m_next_refresh_cycle & m_next_enable_rd_prefetch_cycle;
+    };
+
 };
 
 }       // namespace Ramulator
@@ -16,10 +16,19 @@ class OpenRowPolicy : public IRowPolicy, public Implementation {
 
     void setup(IFrontEnd* frontend, IMemorySystem* memory_system) override { };
 
+    void serialize(Archive& ar) override {
+      // OpenRowPolicy has no state
+    };
+
     void update(bool request_found, ReqBuffer::iterator& req_it) override { 
       // OpenRowPolicy does not need to take any actions
     };
 
+    Clk_t get_next_event_clk() override {
+      // No action is taken when no request is scheduled
+      return std::numeric_limits<Clk_t>::max();
+    };
+
     void update_cap(int pch, int rank, int bg, int bk, uint64_t cap) override {
       // DO NOT ANYTHING
     };
@@ -58,12 +67,12 @@ class ClosedRowPolicy : public IRowPolicy, public Implementation {
 
       m_cap = param<int>("cap").default_val(10000000); // TODO
 
-      m_rank_level = m_dram->m_levels("rank");
-      m_bankgroup_level = m_dram->m_levels("bankgroup");
-      m_bank_level = m_dram->m_levels("bank");
-      m_row_level = m_dram->m_levels("row");
+      m_rank_level = m_dram->m_ids.level.rank.required();
+      m_bankgroup_level = m_dram->m_ids.level.bankgroup.required();
+      m_bank_level = m_dram->m_ids.level.bank.required();
+      m_row_level = m_dram->m_ids.level.row.required();
 
-      m_PRE_req_id = m_dram->m_requests("close-row");
+      m_PRE_req_id = m_dram->m_ids.req.close_row.required();
 
       m_num_ranks = m_dram->get_level_size("rank");
       m_num_bankgroups = m_dram->get_level_size("bankgroup");
@@ -75,7 +84,12 @@ class ClosedRowPolicy : public IRowPolicy, public Implementation {
       register_stat(s_num_close_reqs).name("num_close_reqs");
     };
 
+    void serialize(Archive& ar) override {
+      ar & m_col_accesses & m_cap_per_bank;
+    };
+
     void update(bool request_found, ReqBuffer::iterator& req_it) override {
+      RAMULATOR_PROFILE_SCOPE();
 
       if (!request_found)
         return;
@@ -123,6 +137,11 @@ class ClosedRowPolicy : public IRowPolicy, public Implementation {
       }
     };
 
+    Clk_t get_next_event_clk() override {
+      // No action is taken when no request is scheduled
+      return std::numeric_limits<Clk_t>::max();
+    };
+
     void update_cap(int pch, int rank, int bg, int bk, uint64_t cap) override {
       int flat_bank_id = bk + bg * m_num_banks + rank * m_num_banks * m_num_bankgroups;
       m_cap_per_bank[flat_bank_id] = cap;
@@ -162,13 +181,13 @@ class ClosedRowPolicyPch : public IRowPolicy, public Implementation {
 
       m_cap = param<int>("cap").default_val(10000000); // TODO
 
-      m_pseudochannel_level = m_dram->m_levels("pseudochannel");
-      m_rank_level = m_dram->m_levels("rank");
-      m_bankgroup_level = m_dram->m_levels("bankgroup");
-      m_bank_level = m_dram->m_levels("bank");
-      m_row_level = m_dram->m_levels("row");
+      m_pseudochannel_level = m_dram->m_ids.level.pseudochannel.required();
+      m_rank_level = m_dram->m_ids.level.rank.required();
+      m_bankgroup_level = m_dram->m_ids.level.bankgroup.required();
+      m_bank_level = m_dram->m_ids.level.bank.required();
+      m_row_level = m_dram->m_ids.level.row.required();
 
-      m_PRE_req_id = m_dram->m_requests("close-row");
+      m_PRE_req_id = m_dram->m_ids.req.close_row.required();
 
       m_num_pseudochannels = m_dram->get_level_size("pseudochannel");
       m_num_ranks = m_dram->get_level_size("rank");
@@ -181,7 +200,12 @@ class ClosedRowPolicyPch : public IRowPolicy, public Implementation {
       register_stat(s_num_close_reqs).name("num_close_reqs");
     };
 
+    void serialize(Archive& ar) override {
+      ar & m_col_accesses & m_cap_per_bank;
+    };
+
     void update(bool request_found, ReqBuffer::iterator& req_it) override {
+      RAMULATOR_PROFILE_SCOPE();
 
       if (!request_found)
         return;
@@ -233,6 +257,11 @@ class ClosedRowPolicyPch : public IRowPolicy, public Implementation {
       }
     };
 
+    Clk_t get_next_event_clk() override {
+      // No action is taken when no request is scheduled
+      return std::numeric_limits<Clk_t>::max();
+    };
+
     void update_cap(int pch, int rank, int bg, int bk, uint64_t cap) override {
       int flat_bank_id = bk + bg * m_num_banks + 0 * m_num_banks * m_num_bankgroups + pch * m_num_banks * m_num_bankgroups * m_num_ranks;
       m_cap_per_bank[flat_bank_id] = cap;
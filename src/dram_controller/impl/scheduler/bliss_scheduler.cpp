@@ -32,8 +32,8 @@ class BLISSScheduler : public IBHScheduler, public Implementation {
       m_dram = ctrl->m_dram;
       m_bliss = ctrl->get_plugin<IBLISS>();
 
-      m_req_rd = m_dram->m_requests("read");
-      m_req_wr = m_dram->m_requests("write");
+      m_req_rd = m_dram->m_ids.req.read.required();
+      m_req_wr = m_dram->m_ids.req.write.required();
 
       if (!m_bliss) {
         throw ConfigurationError("[Ramulator::BLISSScheduler] Implementation requires BLISS plugin to be active.");
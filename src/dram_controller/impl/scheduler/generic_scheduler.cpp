@@ -25,8 +25,33 @@ class FRFCFS : public IScheduler, public Implementation {
     int bank_idx = 0;
     int row_idx = 0;
 
+    // Per-bank candidate selection (see get_best_request_per_bank())
+    struct Candidate {
+      ReqBuffer::iterator req;
+      size_t pos;                 // The position of the request in the buffer (breaks ties in the arrival time)
+      int path_id;                // The bank of the request (-1 if the request does not target a single bank)
+    };
+    struct RowGroup {
+      int row;
+      int final_command;
+      int command;
+      size_t candidate;           // The index of the oldest request of the group in m_candidates
+    };
+    struct BankCandidates {
+      uint64_t stamp = 0;         // The call of get_best_request() the groups belong to
+      std::vector<RowGroup> groups;
+      std::vector<std::pair<int, bool>> ready_commands;   // (command, whether it is ready) checked in this call
+    };
+    bool m_per_bank_candidates = false;
+    uint64_t m_stamp = 0;
+    std::vector<int> m_path_sizes;                // The size of each level above the row level
+    std::vector<BankCandidates> m_banks;          // Indexed by the flat id of all levels above the row level
+    std::vector<Candidate> m_candidates;
+
   public:
-    void init() override { };
+    void init() override {
+      m_per_bank_candidates = param<bool>("per_bank_candidates").desc("Evaluate only the oldest request of each (bank, row, type) and check the timing once per (bank, command).").default_val(false);
+    };
 
     void setup(IFrontEnd* frontend, IMemorySystem* memory_system) override {
       m_dram = cast_parent<IDRAMController>()->m_dram;
@@ -34,16 +59,29 @@ class FRFCFS : public IScheduler, public Implementation {
       num_ranks = m_dram->get_level_size("rank");  
       num_bankgroups = m_dram->get_level_size("bankgroup");  
       num_banks = m_dram->get_level_size("bank");  
-      rank_idx = m_dram->m_levels("rank");
-      bankgroup_idx = m_dram->m_levels("bankgroup");
-      bank_idx = m_dram->m_levels("bank"); 
-      row_idx = m_dram->m_levels("row"); 
+      rank_idx = m_dram->m_ids.level.rank.required();
+      bankgroup_idx = m_dram->m_ids.level.bankgroup.required();
+      bank_idx = m_dram->m_ids.level.bank.required(); 
+      row_idx = m_dram->m_ids.level.row.required(); 
 
       // Record Row address per bank for Adaptive Open-Page Policy
       m_open_row.resize(num_ranks*num_bankgroups*num_banks, -1);
       m_pre_open_row.resize(num_ranks*num_bankgroups*num_banks, -1);
       m_open_row_miss.resize(num_ranks*num_bankgroups*num_banks, false);      
       m_open_idle.resize(num_ranks*num_bankgroups*num_banks, true);      
+
+      int num_paths = 1;
+      for (int level = 0; level < row_idx; level++) {
+        m_path_sizes.push_back(m_dram->m_organization.count[level]);
+        num_paths *= m_path_sizes[level];
+      }
+      if (m_per_bank_candidates) {
+        m_banks.resize(num_paths);
+      }
+    };
+
+    void serialize(Archive& ar) override {
+      ar & m_open_row & m_pre_open_row & m_open_row_miss & m_open_idle;
     };
 
     void update_open_row(int flat_bank_id, int row) override {
@@ -67,26 +105,8 @@ class FRFCFS : public IScheduler, public Implementation {
       bool ready2;      
 
       // BK Status Check 
-      bool req1_not_low_pri = true;
-      int req1_flat_bank_id = req1->addr_vec[bank_idx] + req1->addr_vec[bankgroup_idx] * num_banks + req1->addr_vec[rank_idx] * num_bankgroups*num_banks;  
-      if(req1->command == m_dram->m_commands("ACT") && m_open_idle[req1_flat_bank_id]) {
-        
-        if(m_open_row_miss[req1_flat_bank_id] && m_pre_open_row[req1_flat_bank_id] == req1->addr_vec[row_idx]) {
-          req1_not_low_pri = false;
-        }
-      }
-
-      bool req2_not_low_pri = true;
-      int req2_flat_bank_id = req2->addr_vec[bank_idx] + req2->addr_vec[bankgroup_idx] * num_banks + req2->addr_vec[rank_idx] * num_bankgroups*num_banks;  
-      if(req2->command == m_dram->m_commands("ACT") && m_open_idle[req2_flat_bank_id]) {
-        
-        if(m_open_row_miss[req2_flat_bank_id] && m_pre_open_row[req2_flat_bank_id] == req2->addr_vec[row_idx]) {
-          req2_not_low_pri = false;
-        }
-      }
-
-      ready1 = req1_not_low_pri && m_dram->check_ready(req1->command, req1->addr_vec);
-      ready2 = req2_not_low_pri && m_dram->check_ready(req2->command, req2->addr_vec);
+      ready1 = !is_low_priority(*req1) && m_dram->check_ready(*req1);
+      ready2 = !is_low_priority(*req2) && m_dram->check_ready(*req2);
 
       ready1 = ready1 && req1_ready;
       ready2 = ready2 && req2_ready;
@@ -116,9 +136,13 @@ class FRFCFS : public IScheduler, public Implementation {
     }    
 
     ReqBuffer::iterator get_best_request(ReqBuffer& buffer) override {
+      RAMULATOR_PROFILE_SCOPE();
       if (buffer.size() == 0) {
         return buffer.end();
       }
+      if (m_per_bank_candidates) {
+        return get_best_request_per_bank(buffer);
+      }
 
       for (auto& req : buffer) {
         // Specifies a command (preq_cmd) for all requests in the buffer to be fulfilled 
@@ -170,6 +194,108 @@ class FRFCFS : public IScheduler, public Implementation {
       return req1;      
     };    
 
+  private:
+    /**
+     * @brief    Whether the request would re-activate the row that was just closed for a row miss (it is never ready then)
+     */
+    bool is_low_priority(const Request& req) {
+      int flat_bank_id = req.addr_vec[bank_idx] + req.addr_vec[bankgroup_idx] * num_banks + req.addr_vec[rank_idx] * num_bankgroups*num_banks;  
+      return req.command == m_dram->m_ids.cmd.ACT && m_open_idle[flat_bank_id] &&
+             m_open_row_miss[flat_bank_id] && m_pre_open_row[flat_bank_id] == req.addr_vec[row_idx];
+    }
+
+    int get_path_id(const AddrVec_t& addr_vec) {
+      int path_id = 0;
+      for (int level = 0; level < row_idx; level++) {
+        if (addr_vec[level] < 0) {
+          return -1;
+        }
+        path_id = path_id * m_path_sizes[level] + addr_vec[level];
+      }
+      return path_id;
+    }
+
+    /**
+     * @brief    Selects the same request as get_best_request() with fewer command and timing checks
+     * @details
+     * The prerequisite command, its timing check, and the priority of a request only depend on its bank, row, and
+     * final command, so of the requests with the same (bank, row, final command) only the oldest one can be picked.
+     * These requests are grouped per bank in one pass over the buffer, and only the oldest request of each group
+     * is a candidate. The timing of a command is the same for all rows of a bank, so it is checked once per
+     * (bank, command), e.g., once for all requests that miss the open row of a bank. The candidates are then
+     * compared as in compare(): ready first, then the earliest arrival, then the position in the buffer.
+     *
+     */
+    ReqBuffer::iterator get_best_request_per_bank(ReqBuffer& buffer) {
+      m_stamp++;
+      m_candidates.clear();
+
+      size_t pos = 0;
+      for (auto it = buffer.begin(); it != buffer.end(); it++, pos++) {
+        int path_id = get_path_id(it->addr_vec);
+        if (path_id == -1) {
+          it->command = m_dram->get_preq_command(it->final_command, it->addr_vec);
+          m_candidates.push_back({it, pos, -1});
+          continue;
+        }
+
+        BankCandidates& bank = m_banks[path_id];
+        if (bank.stamp != m_stamp) {
+          bank.stamp = m_stamp;
+          bank.groups.clear();
+          bank.ready_commands.clear();
+        }
+        int row = it->addr_vec[row_idx];
+        RowGroup* group = nullptr;
+        for (auto& g : bank.groups) {
+          if (g.row == row && g.final_command == it->final_command) {
+            group = &g;
+            break;
+          }
+        }
+        if (group == nullptr) {
+          it->command = m_dram->get_preq_command(it->final_command, it->addr_vec);
+          bank.groups.push_back({row, it->final_command, it->command, m_candidates.size()});
+          m_candidates.push_back({it, pos, path_id});
+          continue;
+        }
+
+        it->command = group->command;
+        Candidate& oldest = m_candidates[group->candidate];
+        if (it->arrive < oldest.req->arrive) {
+          oldest.req = it;
+          oldest.pos = pos;
+        }
+      }
+
+      Candidate* best = nullptr;
+      bool best_ready = false;
+      for (auto& candidate : m_candidates) {
+        bool ready = !is_low_priority(*candidate.req) && check_ready(candidate);
+        if (best == nullptr || (ready && !best_ready) ||
+            (ready == best_ready && (candidate.req->arrive < best->req->arrive ||
+                                     (candidate.req->arrive == best->req->arrive && candidate.pos < best->pos)))) {
+          best = &candidate;
+          best_ready = ready;
+        }
+      }
+      return best->req;
+    }
+
+    bool check_ready(Candidate& candidate) {
+      if (candidate.path_id == -1) {
+        return m_dram->check_ready(*candidate.req);
+      }
+      auto& ready_commands = m_banks[candidate.path_id].ready_commands;
+      for (const auto& [command, ready] : ready_commands) {
+        if (command == candidate.req->command) {
+          return ready;
+        }
+      }
+      bool ready = m_dram->check_ready(*candidate.req);
+      ready_commands.push_back({candidate.req->command, ready});
+      return ready;
+    }
 };
 
 }       // namespace Ramulator
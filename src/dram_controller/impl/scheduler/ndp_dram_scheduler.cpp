@@ -27,19 +27,7 @@ class NDPFRFCFS : public IScheduler, public Implementation {
     int bank_idx = 0;
     int row_idx = 0;
 
-    struct CmdIds {
-      int RD = -1;
-      int RDA = -1;
-      int WR = -1;
-      int WRA = -1;
-      int NDP_DB_RD = -1;
-      int NDP_DB_WR = -1;
-      int NDP_DRAM_RD = -1;
-      int NDP_DRAM_RDA = -1;
-      int NDP_DRAM_WR = -1;
-      int NDP_DRAM_WRA = -1;
-    };    
-    CmdIds m_cmd;
+    SpecIds::Commands m_cmd;
     uint32_t m_prio_idx = -1;    
   public:
     void init() override { };
@@ -47,51 +35,42 @@ class NDPFRFCFS : public IScheduler, public Implementation {
     void setup(IFrontEnd* frontend, IMemorySystem* memory_system) override {
       m_dram = cast_parent<IDRAMController>()->m_dram;
       
-      m_cmd.RD = m_dram->m_commands("RD");
-      m_cmd.RDA = m_dram->m_commands("RDA");
-      m_cmd.WR = m_dram->m_commands("WR");
-      m_cmd.WRA = m_dram->m_commands("WRA");
-      m_cmd.NDP_DB_RD = m_dram->m_commands("NDP_DB_RD");
-      m_cmd.NDP_DB_WR = m_dram->m_commands("NDP_DB_WR");
-      m_cmd.NDP_DRAM_RD = m_dram->m_commands("NDP_DRAM_RD");
-      m_cmd.NDP_DRAM_RDA = m_dram->m_commands("NDP_DRAM_RDA");
-      m_cmd.NDP_DRAM_WR = m_dram->m_commands("NDP_DRAM_WR");
-      m_cmd.NDP_DRAM_WRA = m_dram->m_commands("NDP_DRAM_WRA");
+      m_cmd = m_dram->m_ids.cmd;
 
       // Init m_cmd_prio_luts 
       // m_cmd_prio_luts[0]
       m_cmd_prio_luts[0].assign(m_dram->m_commands.size(), 0);
-      m_cmd_prio_luts[0][m_cmd.RD] = 1;
+      m_cmd_prio_luts[0][m_cmd.RD.required()] = 1;
       // m_cmd_prio_luts[1] 
       m_cmd_prio_luts[1].assign(m_dram->m_commands.size(), 0);
-      m_cmd_prio_luts[1][m_cmd.NDP_DB_RD] = 1;
+      m_cmd_prio_luts[1][m_cmd.NDP_DB_RD.required()] = 1;
       // m_cmd_prio_luts[2] 
       m_cmd_prio_luts[2].assign(m_dram->m_commands.size(), 0);
-      m_cmd_prio_luts[2][m_cmd.NDP_DB_WR] = 1;
+      m_cmd_prio_luts[2][m_cmd.NDP_DB_WR.required()] = 1;
       // m_cmd_prio_luts[3] 
       m_cmd_prio_luts[3].assign(m_dram->m_commands.size(), 0);
-      m_cmd_prio_luts[3][m_cmd.NDP_DRAM_RD] = 2;      
-      m_cmd_prio_luts[3][m_cmd.NDP_DRAM_RDA] = 1;      
+      m_cmd_prio_luts[3][m_cmd.NDP_DRAM_RD.required()] = 2;      
+      m_cmd_prio_luts[3][m_cmd.NDP_DRAM_RDA.required()] = 1;      
       // m_cmd_prio_luts[4] 
       m_cmd_prio_luts[4].assign(m_dram->m_commands.size(), 0);
-      m_cmd_prio_luts[4][m_cmd.NDP_DRAM_WR] = 2;      
-      m_cmd_prio_luts[4][m_cmd.NDP_DRAM_WRA] = 1;            
+      m_cmd_prio_luts[4][m_cmd.NDP_DRAM_WR.required()] = 2;      
+      m_cmd_prio_luts[4][m_cmd.NDP_DRAM_WRA.required()] = 1;            
       // m_cmd_prio_luts[5] 
       m_cmd_prio_luts[5].assign(m_dram->m_commands.size(), 0);
-      m_cmd_prio_luts[5][m_cmd.NDP_DB_RD] = 3;      
-      m_cmd_prio_luts[5][m_cmd.NDP_DRAM_RD] = 2;      
-      m_cmd_prio_luts[5][m_cmd.NDP_DRAM_RDA] = 1;             
+      m_cmd_prio_luts[5][m_cmd.NDP_DB_RD.required()] = 3;      
+      m_cmd_prio_luts[5][m_cmd.NDP_DRAM_RD.required()] = 2;      
+      m_cmd_prio_luts[5][m_cmd.NDP_DRAM_RDA.required()] = 1;             
       // m_cmd_prio_luts[6] 
       m_cmd_prio_luts[6].assign(m_dram->m_commands.size(), 0);   
-      m_cmd_prio_luts[6][m_cmd.WR] = 1;     
+      m_cmd_prio_luts[6][m_cmd.WR.required()] = 1;     
     
       num_pseudochannel = m_dram->get_level_size("pseudochannel");  
       num_bankgroup = m_dram->get_level_size("bankgroup");  
       num_bank = m_dram->get_level_size("bank");  
-      psuedo_ch_idx = m_dram->m_levels("pseudochannel");
-      bankgroup_idx = m_dram->m_levels("bankgroup");
-      bank_idx = m_dram->m_levels("bank"); 
-      row_idx = m_dram->m_levels("row"); 
+      psuedo_ch_idx = m_dram->m_ids.level.pseudochannel.required();
+      bankgroup_idx = m_dram->m_ids.level.bankgroup.required();
+      bank_idx = m_dram->m_ids.level.bank.required(); 
+      row_idx = m_dram->m_ids.level.row.required(); 
 
       // Record Row address per bank for Adaptive Open-Page Policy
       m_open_row.resize(num_pseudochannel*num_bankgroup*num_bank, -1);
@@ -101,6 +80,10 @@ class NDPFRFCFS : public IScheduler, public Implementation {
             
     };
 
+    void serialize(Archive& ar) override {
+      ar & m_open_row & m_pre_open_row & m_open_row_miss & m_open_idle & m_prio_idx;
+    };
+
     void update_open_row(int flat_bank_id, int row) override {
       m_open_row[flat_bank_id] = row;
     };
@@ -137,7 +120,7 @@ class NDPFRFCFS : public IScheduler, public Implementation {
   
       bool req1_not_low_pri = true;
       int req1_flat_bank_id = req1->addr_vec[bank_idx] + req1->addr_vec[bankgroup_idx] * num_bank + req1->addr_vec[psuedo_ch_idx] * num_bankgroup*num_bank;  
-      if(req1->command == m_dram->m_commands("ACT") && m_open_idle[req1_flat_bank_id]) {
+      if(req1->command == m_dram->m_ids.cmd.ACT && m_open_idle[req1_flat_bank_id]) {
         
         if(m_open_row_miss[req1_flat_bank_id] && m_pre_open_row[req1_flat_bank_id] == req1->addr_vec[row_idx]) {
           req1_not_low_pri = false;
@@ -146,15 +129,15 @@ class NDPFRFCFS : public IScheduler, public Implementation {
 
       bool req2_not_low_pri = true;
       int req2_flat_bank_id = req2->addr_vec[bank_idx] + req2->addr_vec[bankgroup_idx] * num_bank + req2->addr_vec[psuedo_ch_idx] * num_bankgroup*num_bank;  
-      if(req2->command == m_dram->m_commands("ACT") && m_open_idle[req2_flat_bank_id]) {
+      if(req2->command == m_dram->m_ids.cmd.ACT && m_open_idle[req2_flat_bank_id]) {
         
         if(m_open_row_miss[req2_flat_bank_id] && m_pre_open_row[req2_flat_bank_id] == req2->addr_vec[row_idx]) {
           req2_not_low_pri = false;
         }
       }
 
-      ready1 = req1_not_low_pri && m_dram->check_ready(req1->command, req1->addr_vec);
-      ready2 = req2_not_low_pri && m_dram->check_ready(req2->command, req2->addr_vec);
+      ready1 = req1_not_low_pri && m_dram->check_ready(*req1);
+      ready2 = req2_not_low_pri && m_dram->check_ready(*req2);
 
       ready1 = ready1 && req1_ready;
       ready2 = ready2 && req2_ready;
@@ -181,7 +164,7 @@ class NDPFRFCFS : public IScheduler, public Implementation {
 
       bool req1_not_low_pri = true;
       int req1_flat_bank_id = req1->addr_vec[bank_idx] + req1->addr_vec[bankgroup_idx] * num_bank + req1->addr_vec[psuedo_ch_idx] * num_bankgroup*num_bank;  
-      if(req1->command == m_dram->m_commands("ACT") && m_open_idle[req1_flat_bank_id]) {
+      if(req1->command == m_dram->m_ids.cmd.ACT && m_open_idle[req1_flat_bank_id]) {
         
         if(m_open_row_miss[req1_flat_bank_id] && m_pre_open_row[req1_flat_bank_id] == req1->addr_vec[row_idx]) {
           req1_not_low_pri = false;
@@ -190,15 +173,15 @@ class NDPFRFCFS : public IScheduler, public Implementation {
 
       bool req2_not_low_pri = true;
       int req2_flat_bank_id = req2->addr_vec[bank_idx] + req2->addr_vec[bankgroup_idx] * num_bank + req2->addr_vec[psuedo_ch_idx] * num_bankgroup*num_bank;  
-      if(req2->command == m_dram->m_commands("ACT") && m_open_idle[req2_flat_bank_id]) {
+      if(req2->command == m_dram->m_ids.cmd.ACT && m_open_idle[req2_flat_bank_id]) {
         
         if(m_open_row_miss[req2_flat_bank_id] && m_pre_open_row[req2_flat_bank_id] == req2->addr_vec[row_idx]) {
           req2_not_low_pri = false;
         }
       }
 
-      ready1 = req1_not_low_pri && m_dram->check_ready(req1->command, req1->addr_vec);
-      ready2 = req2_not_low_pri && m_dram->check_ready(req2->command, req2->addr_vec);
+      ready1 = req1_not_low_pri && m_dram->check_ready(*req1);
+      ready2 = req2_not_low_pri && m_dram->check_ready(*req2);
       
       priority1 = get_command_priority(req1->command);
       priority2 = get_command_priority(req2->command);
@@ -264,6 +247,7 @@ class NDPFRFCFS : public IScheduler, public Implementation {
     
     // Call by Active Buffer, Priority Buffer, Prefetch Buffer
     ReqBuffer::iterator get_best_request(ReqBuffer& buffer) override {
+      RAMULATOR_PROFILE_SCOPE();
       if (buffer.size() == 0) {
         return buffer.end();
       }
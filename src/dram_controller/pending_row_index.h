@@ -0,0 +1,117 @@
+#ifndef RAMULATOR_CONTROLLER_PENDING_ROW_INDEX_H
+#define RAMULATOR_CONTROLLER_PENDING_ROW_INDEX_H
+
+#include <vector>
+#include <utility>
+
+namespace Ramulator {
+
+/**
+ * @brief     Index of the rows the queued requests of each bank are waiting for
+ *
+ * @details
+ * Counts the queued requests of each (flat) bank per row, so whether a bank has requests waiting
+ * for a row other than its open one is an O(1) query instead of a scan of the request buffers.
+ * The controller adds a request when it is enqueued and removes it when it is dequeued. The banks
+ * whose requests changed are marked dirty, and the controller can mark the banks whose open row
+ * changed, so that only these banks need to be checked again.
+ *
+ */
+class PendingRowIndex {
+  private:
+    struct Bank {
+      int num_reqs = 0;
+      std::vector<std::pair<int, int>> row_counts;    // (row, number of requests) of each row with requests
+    };
+
+    std::vector<Bank> m_banks;
+    std::vector<int> m_dirty_banks;
+    std::vector<bool> m_is_dirty;
+
+  public:
+    void resize(int num_banks) {
+      m_banks.assign(num_banks, Bank());
+      m_dirty_banks.clear();
+      m_is_dirty.assign(num_banks, false);
+    };
+
+    void clear() {
+      resize(m_banks.size());
+    };
+
+    void add(int bank_id, int row) {
+      Bank& bank = m_banks[bank_id];
+      bank.num_reqs++;
+      mark_dirty(bank_id);
+      for (auto& [r, count] : bank.row_counts) {
+        if (r == row) {
+          count++;
+          return;
+        }
+      }
+      bank.row_counts.push_back({row, 1});
+    };
+
+    void remove(int bank_id, int row) {
+      Bank& bank = m_banks[bank_id];
+      bank.num_reqs--;
+      mark_dirty(bank_id);
+      for (size_t i = 0; i < bank.row_counts.size(); i++) {
+        if (bank.row_counts[i].first == row) {
+          if (--bank.row_counts[i].second == 0) {
+            bank.row_counts[i] = bank.row_counts.back();
+            bank.row_counts.pop_back();
+          }
+          return;
+        }
+      }
+    };
+
+    /**
+     * @brief     Returns the number of queued requests of the bank
+     */
+    int num_reqs(int bank_id) const {
+      return m_banks[bank_id].num_reqs;
+    };
+
+    /**
+     * @brief     Returns the number of queued requests of the bank that are waiting for the given row
+     */
+    int num_reqs(int bank_id, int row) const {
+      for (const auto& [r, count] : m_banks[bank_id].row_counts) {
+        if (r == row) {
+          return count;
+        }
+      }
+      return 0;
+    };
+
+    void mark_dirty(int bank_id) {
+      if (!m_is_dirty[bank_id]) {
+        m_is_dirty[bank_id] = true;
+        m_dirty_banks.push_back(bank_id);
+      }
+    };
+
+    void mark_all_dirty() {
+      for (size_t bank_id = 0; bank_id < m_banks.size(); bank_id++) {
+        mark_dirty(bank_id);
+      }
+    };
+
+    /**
+     * @brief     Calls func(bank_id) for each dirty bank (in the order they were marked) and clears the marks
+     */
+    template<typename Func_t>
+    void for_each_dirty(Func_t&& func) {
+      for (int bank_id : m_dirty_banks) {
+        m_is_dirty[bank_id] = false;
+        func(bank_id);
+      }
+      m_dirty_banks.clear();
+    };
+};
+
+}        // namespace Ramulator
+
+#endif   // RAMULATOR_CONTROLLER_PENDING_ROW_INDEX_H
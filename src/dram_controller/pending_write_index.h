@@ -0,0 +1,116 @@
+#ifndef RAMULATOR_CONTROLLER_PENDING_WRITE_INDEX_H
+#define RAMULATOR_CONTROLLER_PENDING_WRITE_INDEX_H
+
+#include <vector>
+
+#include "base/type.h"
+
+namespace Ramulator {
+
+/**
+ * @brief     Hash index of the addresses of the queued write requests
+ *
+ * @details
+ * An open-addressing (linear probing) hash table from an address to the number of queued writes to it,
+ * so checking whether a read can be forwarded from (or a write merged into) a queued write does not scan
+ * the write buffers. Deletion shifts the following entries of the probe sequence back instead of leaving
+ * tombstones, so lookups never slow down. The table doubles when it becomes half full.
+ *
+ */
+class PendingWriteIndex {
+  private:
+    struct Slot {
+      Addr_t addr = -1;
+      int count = 0;      // 0 = empty slot
+    };
+
+    std::vector<Slot> m_slots;
+    size_t m_num_addrs = 0;
+
+  public:
+    /**
+     * @brief     Sizes the table for the given number of queued writes
+     */
+    void reserve(size_t num_writes) {
+      size_t num_slots = 16;
+      while (num_slots < 2 * num_writes) {
+        num_slots *= 2;
+      }
+      m_slots.assign(num_slots, Slot());
+      m_num_addrs = 0;
+    };
+
+    void clear() {
+      m_slots.assign(m_slots.size(), Slot());
+      m_num_addrs = 0;
+    };
+
+    bool contains(Addr_t addr) const {
+      return m_slots[find(addr)].count != 0;
+    };
+
+    void add(Addr_t addr) {
+      if (2 * (m_num_addrs + 1) > m_slots.size()) {
+        grow();
+      }
+      Slot& slot = m_slots[find(addr)];
+      if (slot.count == 0) {
+        slot.addr = addr;
+        m_num_addrs++;
+      }
+      slot.count++;
+    };
+
+    void remove(Addr_t addr) {
+      size_t pos = find(addr);
+      if (m_slots[pos].count == 0 || --m_slots[pos].count != 0) {
+        return;
+      }
+      m_num_addrs--;
+
+      // Shift back the entries after the removed one that would not be found anymore
+      size_t mask = m_slots.size() - 1;
+      size_t hole = pos;
+      for (size_t next = (hole + 1) & mask; m_slots[next].count != 0; next = (next + 1) & mask) {
+        size_t home = hash(m_slots[next].addr) & mask;
+        if (((next - home) & mask) >= ((next - hole) & mask)) {
+          m_slots[hole] = m_slots[next];
+          hole = next;
+        }
+      }
+      m_slots[hole] = Slot();
+    };
+
+  private:
+    static size_t hash(Addr_t addr) {
+      // Fibonacci hashing spreads the (mostly aligned) addresses over the table
+      return ((uint64_t)addr * 0x9E3779B97F4A7C15ull) >> 32;
+    };
+
+    /**
+     * @brief     Returns the slot of the address, or the empty slot where it would be inserted
+     */
+    size_t find(Addr_t addr) const {
+      size_t mask = m_slots.size() - 1;
+      size_t pos = hash(addr) & mask;
+      while (m_slots[pos].count != 0 && m_slots[pos].addr != addr) {
+        pos = (pos + 1) & mask;
+      }
+      return pos;
+    };
+
+    void grow() {
+      std::vector<Slot> old_slots = std::move(m_slots);
+      m_slots.assign(old_slots.size() * 2, Slot());
+      for (const Slot& old_slot : old_slots) {
+        if (old_slot.count != 0) {
+          Slot& slot = m_slots[find(old_slot.addr)];
+          slot = old_slot;
+        }
+      }
+    };
+};
+
+}        // namespace Ramulator
+
+#endif   // RAMULATOR_CONTROLLER_PENDING_WRITE_INDEX_H
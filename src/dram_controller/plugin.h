@@ -18,6 +18,20 @@ class IControllerPlugin {
 
   public:
     virtual void update(bool request_found, ReqBuffer::iterator& req_it) = 0;
+
+    // Earliest cycle at which update(false, ...) changes any state (0: no lookahead)
+    virtual Clk_t get_next_event_clk() { return 0; };
+    // Skip to the given cycle as if update(false, ...) was called every cycle
+    virtual void fast_forward(Clk_t clk) {};
+
+    // Sees a command applied by a functional access (no timing, e.g., the warm-up of sampled simulation)
+    virtual void functional_update(int command, const AddrVec_t& addr_vec) {
+      throw ConfigurationError("Plugin {} does not support functional accesses!", m_impl->get_name());
+    };
+    // Throws a ConfigurationError if functional_update() is not supported
+    virtual void check_functional_access() {
+      throw ConfigurationError("Plugin {} does not support functional accesses!", m_impl->get_name());
+    };
 };
 
 }        // namespace Ramulator
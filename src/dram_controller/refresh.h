@@ -14,6 +14,11 @@ class IRefreshManager {
 
   public:
     virtual void tick() = 0;
+
+    // Earliest cycle at which tick() sends refreshes (0: no lookahead, tick every cycle)
+    virtual Clk_t get_next_event_clk() { return 0; };
+    // Skip to the given cycle without sending any refresh
+    virtual void fast_forward(Clk_t clk) {};
 };
 
 }        // namespace Ramulator
@@ -17,6 +17,11 @@ class IRowPolicy {
   public:
     virtual void update(bool request_found, ReqBuffer::iterator& req_it) = 0;
     virtual void update_cap(int pch, int rank, int bg, int bk, uint64_t cap) = 0;
+
+    // Earliest cycle at which update(false, ...) changes any state (0: no lookahead)
+    virtual Clk_t get_next_event_clk() { return 0; };
+    // Skip to the given cycle as if update(false, ...) was called every cycle
+    virtual void fast_forward(Clk_t clk) {};
 };
 
 }        // namespace Ramulator
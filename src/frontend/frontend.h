@@ -19,6 +19,7 @@ class IFrontEnd : public Clocked<IFrontEnd>, public TopLevel<IFrontEnd> {
   protected:
     IMemorySystem* m_memory_system;
     uint m_clock_ratio = 1;
+    std::ostream* m_stats_stream = nullptr;   // Where the YAML statistics go (stdout if not set)
 
   public:
     virtual void connect_memory_system(IMemorySystem* memory_system) { 
@@ -31,18 +32,66 @@ class IFrontEnd : public Clocked<IFrontEnd>, public TopLevel<IFrontEnd> {
 
     virtual bool is_finished() = 0;
 
+    /**
+     * @brief    Whether the frontend runs sampled simulations (i.e., accepts a "sampling" group)
+     * 
+     */
+    virtual bool supports_sampling() { return false; };
+
+    /**
+     * @brief    Returns the earliest frontend cycle at which tick() may do any work
+     * 
+     * @details
+     * Used by the top-level loop to skip idle cycles. Any cycle that is not after the
+     * current one (e.g., the default 0) means the frontend must be ticked next cycle.
+     * std::numeric_limits<Clk_t>::max() means the frontend only waits on the memory system.
+     * 
+     */
+    virtual Clk_t get_next_event_clk() { return 0; };
+
+    /**
+     * @brief    Advances the frontend to the given cycle as if all ticks in between were idle
+     * 
+     */
+    virtual void fast_forward(Clk_t clk) {};
+
+    /**
+     * @brief    Recreates the callback of a request sent by the frontend that is restored from a checkpoint
+     * 
+     */
+    virtual std::function<void(Request&)> restore_callback(const Request& req) {
+      throw ConfigurationError("Frontend {} cannot restore the callbacks of in-flight requests!", m_impl->get_name());
+    };
+
     virtual void finalize() { 
       for (auto component : m_components) {
         component->finalize();
       }
       
       if(m_impl->get_name() != "GEM5") {
-        std::cout<<" imple: "<<m_impl->get_name()<<std::endl;
+        m_impl->report_stream()<<" imple: "<<m_impl->get_name()<<std::endl;
         YAML::Emitter emitter;
         emitter << YAML::BeginMap;
         m_impl->print_stats(emitter);
         emitter << YAML::EndMap;
-        std::cout << emitter.c_str() << std::endl;
+        (m_stats_stream ? *m_stats_stream : std::cout) << emitter.c_str() << std::endl;
+      }
+    };
+
+    /**
+     * @brief    Writes the YAML statistics to the given stream instead of stdout (e.g., one file per ramulator-sweep point)
+     * 
+     */
+    void set_stats_stream(std::ostream* stats_stream) { m_stats_stream = stats_stream; };
+
+    /**
+     * @brief    Writes the reports that myself and all my components print in finalize() to the given stream instead of stdout
+     * 
+     */
+    void redirect_reports(std::ostream* report_stream) {
+      m_impl->set_report_stream(report_stream);
+      for (auto component : m_components) {
+        component->set_report_stream(report_stream);
       }
     };
 
@@ -1,6 +1,9 @@
+#include <cmath>
 #include <filesystem>
 #include <iostream>
 #include <fstream>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 
@@ -28,7 +31,7 @@ class LoadStoreNCoreTrace : public IFrontEnd, public Implementation {
     // Per-core data structure
     struct CoreState {
       int core_id;
-      std::vector<Trace> trace;
+      std::shared_ptr<const std::vector<Trace>> trace;  // Shared (read-only) with the other instances using the same trace
       size_t curr_idx;
       size_t max_outstanding;
       uint64_t m_max_trace_inst;
@@ -37,6 +40,7 @@ class LoadStoreNCoreTrace : public IFrontEnd, public Implementation {
       bool wait_ndp_armed = false;  // WAIT_NDP: true after NDP observed non-IDLE
       size_t repeat_trace_count;
       size_t repeat_trace;
+      uint64_t timestamp_offset = 0;  // Cycles of the trace skipped by functional warm-up (sampled simulation)
 
       // Outstanding requests tracking
       struct OutstandingRequest {
@@ -71,6 +75,18 @@ class LoadStoreNCoreTrace : public IFrontEnd, public Implementation {
       double avg_read_latency() const {
         return completed_reads > 0 ? (double)total_read_latency / completed_reads : 0.0;
       }
+
+      uint64_t issue_cycle(const Trace& t) const {
+        return t.timestamp > timestamp_offset ? t.timestamp - timestamp_offset : 0;
+      }
+
+      void serialize(Archive& ar) {
+        ar & curr_idx & is_ndp_done & wait_ndp_armed & repeat_trace_count & timestamp_offset;
+        ar & outstanding_reads;
+        ar & total_read_requests & total_write_requests & completed_reads & total_read_latency;
+        ar & avg_outstanding_reads & reach_max_outstanding_reads & reach_controller_buffer;
+        ar & issued_rd & issued_wr;
+      }
     };
 
     std::vector<CoreState*> m_cores;
@@ -80,6 +96,38 @@ class LoadStoreNCoreTrace : public IFrontEnd, public Implementation {
     
     Logger_t m_logger;
     bool m_debug_mode = false;  // Debug mode flag
+    bool m_final_stats_printed = false;
+
+    // Sampled (SMARTS-style) simulation. In every sampling unit of m_sample_period requests, the first
+    // m_sample_warmup requests are simulated in detail to warm up the queues, the next m_sample_window
+    // requests are measured, and the rest only update the DRAM states functionally (no timing).
+    enum class SamplePhase { Warmup, Measure, Drain, Functional };
+    bool m_sampling = false;
+    uint64_t m_sample_period = 0;
+    uint64_t m_sample_warmup = 0;
+    uint64_t m_sample_window = 0;
+    SamplePhase m_sample_phase = SamplePhase::Warmup;
+    uint64_t m_phase_requests = 0;      // Requests sent in the current phase
+    uint64_t m_window_start_cycle = 0;
+    uint64_t m_window_start_reads = 0;
+    uint64_t m_window_start_read_latency = 0;
+    std::vector<double> m_window_read_latencies;  // Average read latency of each measurement window
+    std::vector<double> m_window_throughputs;     // Requests per cycle of each measurement window
+
+    static constexpr double CI_Z = 1.96;          // 95% confidence
+    size_t s_num_sample_windows = 0;
+    double s_sampled_avg_read_latency = 0;
+    double s_sampled_avg_read_latency_ci = 0;
+    double s_sampled_throughput = 0;
+    double s_sampled_throughput_ci = 0;
+
+    // Traces parsed in this process, so that simulations sharing a trace (e.g., the points of ramulator-sweep) parse it only once
+    struct SharedTrace {
+      std::once_flag loaded;
+      std::shared_ptr<const std::vector<Trace>> trace;
+    };
+    inline static std::mutex s_trace_cache_mutex;
+    inline static std::unordered_map<std::string, std::shared_ptr<SharedTrace>> s_trace_cache;
 
   public:
     void init() override {
@@ -132,9 +180,9 @@ class LoadStoreNCoreTrace : public IFrontEnd, public Implementation {
                                     .required();
           
           m_logger->info("Loading trace for Core {} from {} ...", core_id, trace_path);
-          load_trace(trace_path, core->trace);
+          core->trace = get_shared_trace(trace_path);
           m_logger->info("Core {}: Loaded {} trace lines, MSHR size = {}", 
-                        core_id, core->trace.size(), mshr_size);
+                        core_id, core->trace->size(), mshr_size);
         } catch (const std::exception& e) {
           delete core;
           throw ConfigurationError("Failed to load trace for core {}: {}", core_id, e.what());
@@ -145,6 +193,25 @@ class LoadStoreNCoreTrace : public IFrontEnd, public Implementation {
         stat_interval = 100000;
       }
 
+      if (m_config["sampling"]) {
+        m_sampling = true;
+        m_sample_period = param_group("sampling").param<uint64_t>("period").desc("Number of requests in each sampling unit.").required();
+        m_sample_window = param_group("sampling").param<uint64_t>("window").desc("Number of requests measured in each sampling unit.").required();
+        m_sample_warmup = param_group("sampling").param<uint64_t>("warmup").desc("Number of requests simulated in detail before each measurement window.").default_val(0);
+        if (m_sample_window == 0 || m_sample_warmup + m_sample_window > m_sample_period) {
+          throw ConfigurationError("Sampling window ({}) must be positive and fit in the period ({}) together with the warm-up ({})!", 
+                                   m_sample_window, m_sample_period, m_sample_warmup);
+        }
+        m_logger->info("Sampled simulation: period {}, warm-up {}, window {} requests", m_sample_period, m_sample_warmup, m_sample_window);
+
+        register_stat(s_num_sample_windows).name("num_sample_windows");
+        register_stat(s_sampled_avg_read_latency).name("sampled_avg_read_latency");
+        register_stat(s_sampled_avg_read_latency_ci).name("sampled_avg_read_latency_ci95").desc("Half-width of the 95% confidence interval.");
+        register_stat(s_sampled_throughput).name("sampled_throughput").desc("Requests per cycle.");
+        register_stat(s_sampled_throughput_ci).name("sampled_throughput_ci95").desc("Half-width of the 95% confidence interval.");
+        start_sample_phase(SamplePhase::Warmup);
+      }
+
       m_logger->info("All {} cores initialized successfully", m_num_cores);
     };
 
@@ -154,9 +221,23 @@ class LoadStoreNCoreTrace : public IFrontEnd, public Implementation {
       }
     }
 
+    void setup(IFrontEnd* frontend, IMemorySystem* memory_system) override {
+      // Reject a memory system that cannot be warmed up functionally before the first window, not after it
+      if (m_sampling) {
+        memory_system->check_functional_access();
+      }
+    };
+
+    bool supports_sampling() override { return true; };
+
     void tick() override {
+      RAMULATOR_PROFILE_SCOPE();
       m_current_cycle++;
 
+      if (m_sampling) {
+        update_sample_phase();
+      }
+
       // Try to issue requests from each core
       bool is_ndp_done = m_memory_system->is_ndp_finished();
       for (auto core : m_cores) {
@@ -170,6 +251,76 @@ class LoadStoreNCoreTrace : public IFrontEnd, public Implementation {
       }
     };
 
+    Clk_t get_next_event_clk() override {
+      Clk_t now = m_current_cycle;
+      // Waiting for the memory system to drain, or about to apply the functional requests
+      if (m_sampling && (m_sample_phase == SamplePhase::Drain || m_sample_phase == SamplePhase::Functional)) {
+        return now + 1;
+      }
+      // The next progress report
+      Clk_t next_clk = (m_current_cycle / stat_interval + 1) * stat_interval;
+
+      for (auto core : m_cores) {
+        // About to repeat the trace (conservatively ignores the NDP status)
+        if ((core->curr_idx >= core->trace->size() || core->curr_idx >= core->m_max_trace_inst) &&
+            core->outstanding_reads.empty() && core->repeat_trace_count < core->repeat_trace) {
+          return now + 1;
+        }
+
+        // Blocked by a full MSHR or the end of the trace: only a completed read (i.e., the memory system) can unblock it
+        if (core->curr_idx >= core->trace->size() ||
+            core->outstanding_reads.size() >= core->max_outstanding ||
+            core->m_max_trace_inst <= core->curr_idx) {
+          continue;
+        }
+
+        const Trace& t = (*core->trace)[core->curr_idx];
+        if (t.is_wait_ndp || core->issue_cycle(t) <= (uint64_t)(now + 1)) {
+          return now + 1;
+        }
+        next_clk = std::min(next_clk, (Clk_t)core->issue_cycle(t));
+      }
+
+      return next_clk;
+    };
+
+    void fast_forward(Clk_t clk) override {
+      if (clk <= (Clk_t)m_current_cycle) {
+        return;
+      }
+      uint64_t num_idle_cycles = clk - m_current_cycle;
+      m_current_cycle = clk;
+
+      for (auto core : m_cores) {
+        core->avg_outstanding_reads += num_idle_cycles * core->outstanding_reads.size();
+        if(core->outstanding_reads.size() >= core->max_outstanding)
+          core->reach_max_outstanding_reads += num_idle_cycles;
+      }
+    };
+
+    void serialize(Archive& ar) override {
+      // The traces themselves are reloaded from the configuration, only the cursors are saved
+      ar & m_current_cycle & m_next_request_id & m_final_stats_printed;
+      ar & m_sample_phase & m_phase_requests;
+      ar & m_window_start_cycle & m_window_start_reads & m_window_start_read_latency;
+      ar & m_window_read_latencies & m_window_throughputs;
+      for (auto core : m_cores) {
+        core->serialize(ar);
+      }
+    };
+
+    std::function<void(Request&)> restore_callback(const Request& req) override {
+      int req_id = req.callback_id;
+      for (auto core : m_cores) {
+        if (core->outstanding_reads.contains(req_id)) {
+          return [this, core, req_id](Request& completed_req) {
+            this->on_read_complete(core, req_id, completed_req);
+          };
+        }
+      }
+      throw ConfigurationError("No core is waiting for the restored READ request {}!", req_id);
+    };
+
   private:
     void try_issue_requests(CoreState* core) {
       // Try to issue as many requests as possible from this core
@@ -177,17 +328,17 @@ class LoadStoreNCoreTrace : public IFrontEnd, public Implementation {
       if(core->outstanding_reads.size() >= core->max_outstanding)
         core->reach_max_outstanding_reads += 1;
 
-      if ((core->curr_idx >= core->trace.size() || core->curr_idx >= core->m_max_trace_inst) && core->outstanding_reads.empty() && 
+      if ((core->curr_idx >= core->trace->size() || core->curr_idx >= core->m_max_trace_inst) && core->outstanding_reads.empty() && 
           (!core->is_ndp_trace || (core->is_ndp_trace && core->is_ndp_done)) && core->repeat_trace_count < core->repeat_trace) {
         core->repeat_trace_count+=1;
         if(core->repeat_trace_count < core->repeat_trace) core->curr_idx = 0; 
       }
 
-      while (core->curr_idx < core->trace.size() &&
+      while (core->curr_idx < core->trace->size() &&
              core->outstanding_reads.size() < core->max_outstanding &&
              core->m_max_trace_inst > core->curr_idx) {
 
-        const Trace& t = core->trace[core->curr_idx];
+        const Trace& t = (*core->trace)[core->curr_idx];
 
         // WAIT_NDP: block until NDP starts (non-IDLE), then completes (IDLE again)
         // Two-phase: (1) wait for NDP to become non-IDLE (armed), (2) wait for IDLE + drain
@@ -208,10 +359,15 @@ class LoadStoreNCoreTrace : public IFrontEnd, public Implementation {
         }
 
         // Check if it's time to issue this request
-        if (t.timestamp > m_current_cycle) {
+        if (core->issue_cycle(t) > m_current_cycle) {
           break;  // Too early for this request
         }
 
+        // Only the warm-up and measurement phases send requests to the memory system
+        if (m_sampling && m_sample_phase != SamplePhase::Warmup && m_sample_phase != SamplePhase::Measure) {
+          break;
+        }
+
         // Create request
         Request req = Request(t.addr, t.is_write ? Request::Type::Write : Request::Type::Read);
         
@@ -230,6 +386,7 @@ class LoadStoreNCoreTrace : public IFrontEnd, public Implementation {
           req.callback = [this, core, req_id](Request& completed_req) {
             this->on_read_complete(core, req_id, completed_req);
           };
+          req.callback_id = req_id;
         }
         
         // Try to send the request
@@ -260,6 +417,9 @@ class LoadStoreNCoreTrace : public IFrontEnd, public Implementation {
           }
           
           core->curr_idx++;
+          if (m_sampling) {
+            on_sampled_request();
+          }
         } else {
           core->reach_controller_buffer+=1;
           break;  // Memory system busy, try next cycle
@@ -288,7 +448,171 @@ class LoadStoreNCoreTrace : public IFrontEnd, public Implementation {
       }
     }
 
-    void load_trace(const std::string& file_path_str, std::vector<Trace>& trace_vec) {
+    void start_sample_phase(SamplePhase phase) {
+      m_sample_phase = phase;
+      m_phase_requests = 0;
+      if (phase == SamplePhase::Warmup && m_sample_warmup == 0) {
+        start_sample_phase(SamplePhase::Measure);
+      } else if (phase == SamplePhase::Measure) {
+        m_window_start_cycle = m_current_cycle;
+        m_window_start_reads = 0;
+        m_window_start_read_latency = 0;
+        for (auto core : m_cores) {
+          m_window_start_reads += core->completed_reads;
+          m_window_start_read_latency += core->total_read_latency;
+        }
+      }
+    }
+
+    void on_sampled_request() {
+      m_phase_requests++;
+      if (m_sample_phase == SamplePhase::Warmup && m_phase_requests >= m_sample_warmup) {
+        start_sample_phase(SamplePhase::Measure);
+      } else if (m_sample_phase == SamplePhase::Measure && m_phase_requests >= m_sample_window) {
+        start_sample_phase(SamplePhase::Drain);
+      }
+    }
+
+    void update_sample_phase() {
+      if (m_sample_phase == SamplePhase::Drain) {
+        // The window ends when all its requests are served, so that it includes their whole latency
+        for (auto core : m_cores) {
+          if (!core->outstanding_reads.empty()) {
+            return;
+          }
+        }
+        if (!m_memory_system->is_finished()) {
+          return;
+        }
+        close_sample_window();
+        start_sample_phase(SamplePhase::Functional);
+      }
+
+      if (m_sample_phase == SamplePhase::Functional) {
+        apply_functional_requests(m_sample_period - m_sample_warmup - m_sample_window);
+        start_sample_phase(SamplePhase::Warmup);
+      }
+    }
+
+    void close_sample_window() {
+      uint64_t num_reads = 0;
+      uint64_t read_latency = 0;
+      for (auto core : m_cores) {
+        num_reads += core->completed_reads;
+        read_latency += core->total_read_latency;
+      }
+      num_reads -= m_window_start_reads;
+      read_latency -= m_window_start_read_latency;
+
+      if (num_reads > 0) {
+        m_window_read_latencies.push_back((double)read_latency / num_reads);
+      }
+      uint64_t num_cycles = std::max<uint64_t>(m_current_cycle - m_window_start_cycle, 1);
+      m_window_throughputs.push_back((double)m_sample_window / num_cycles);
+
+      s_num_sample_windows = m_window_throughputs.size();
+      estimate(m_window_read_latencies, s_sampled_avg_read_latency, s_sampled_avg_read_latency_ci);
+      estimate(m_window_throughputs, s_sampled_throughput, s_sampled_throughput_ci);
+    }
+
+    /**
+     * @brief    Sample mean and the half-width of its confidence interval
+     * 
+     */
+    static void estimate(const std::vector<double>& samples, double& mean, double& ci) {
+      mean = 0;
+      ci = 0;
+      if (samples.empty()) {
+        return;
+      }
+      for (double sample : samples) {
+        mean += sample;
+      }
+      mean /= samples.size();
+      if (samples.size() < 2) {
+        return;
+      }
+      double variance = 0;
+      for (double sample : samples) {
+        variance += (sample - mean) * (sample - mean);
+      }
+      variance /= (samples.size() - 1);
+      ci = CI_Z * std::sqrt(variance / samples.size());
+    }
+
+    /**
+     * @brief    Fast-forwards the traces (round-robin over the cores), only updating the DRAM states.
+     * @details
+     * The cycles spanned by the skipped trace entries are removed from the later timestamps.
+     * 
+     */
+    void apply_functional_requests(uint64_t num_requests) {
+      std::vector<uint64_t> skip_start(m_cores.size(), 0);
+      for (size_t i = 0; i < m_cores.size(); i++) {
+        CoreState* core = m_cores[i];
+        if (core->curr_idx < core->trace->size()) {
+          skip_start[i] = (*core->trace)[core->curr_idx].timestamp;
+        }
+      }
+
+      uint64_t num_applied = 0;
+      bool is_progress = true;
+      while (num_applied < num_requests && is_progress) {
+        is_progress = false;
+        for (auto core : m_cores) {
+          if (num_applied >= num_requests) {
+            break;
+          }
+          if (core->curr_idx >= core->trace->size() || core->curr_idx >= core->m_max_trace_inst) {
+            continue;
+          }
+          const Trace& t = (*core->trace)[core->curr_idx];
+          if (!t.is_wait_ndp) {
+            Request req = Request(t.addr, t.is_write ? Request::Type::Write : Request::Type::Read);
+            m_memory_system->functional_access(req);
+            num_applied++;
+          }
+          core->curr_idx++;
+          is_progress = true;
+        }
+      }
+
+      for (size_t i = 0; i < m_cores.size(); i++) {
+        CoreState* core = m_cores[i];
+        if (core->curr_idx < core->trace->size()) {
+          uint64_t skip_end = (*core->trace)[core->curr_idx].timestamp;
+          if (skip_end > skip_start[i]) {
+            core->timestamp_offset += skip_end - skip_start[i];
+          }
+        }
+      }
+    }
+
+    /**
+     * @brief    Returns the parsed trace, parsing it only if no other instance in this process has done so yet.
+     * 
+     */
+    static std::shared_ptr<const std::vector<Trace>> get_shared_trace(const std::string& file_path_str) {
+      std::shared_ptr<SharedTrace> shared_trace;
+      {
+        std::lock_guard<std::mutex> lock(s_trace_cache_mutex);
+        auto& entry = s_trace_cache[fs::weakly_canonical(file_path_str).string()];
+        if (!entry) {
+          entry = std::make_shared<SharedTrace>();
+        }
+        shared_trace = entry;
+      }
+
+      // Other traces can be parsed concurrently; a failed parse is retried by the next caller
+      std::call_once(shared_trace->loaded, [&]() {
+        auto trace = std::make_shared<std::vector<Trace>>();
+        load_trace(file_path_str, *trace);
+        shared_trace->trace = std::move(trace);
+      });
+      return shared_trace->trace;
+    }
+
+    static void load_trace(const std::string& file_path_str, std::vector<Trace>& trace_vec) {
       fs::path trace_path(file_path_str);
       if (!fs::exists(trace_path)) {
         throw ConfigurationError("Trace {} does not exist!", file_path_str);
@@ -400,7 +724,7 @@ class LoadStoreNCoreTrace : public IFrontEnd, public Implementation {
         m_logger->info("  Core {}: {}/{} issued (RD:{}, WR:{}), outstanding_reads:{}, avg_rd_latency={:.1f} cycles, Issued Read:{}, Issued Write:{}", 
                       core->core_id, 
                       core->curr_idx, 
-                      core->trace.size(),
+                      core->trace->size(),
                       core->total_read_requests,
                       core->total_write_requests,
                       core->avg_outstanding_reads/stat_interval,
@@ -436,9 +760,8 @@ class LoadStoreNCoreTrace : public IFrontEnd, public Implementation {
     }
 
     void print_final_statistics() {
-      static bool printed = false;
-      if (printed) return;
-      printed = true;
+      if (m_final_stats_printed) return;
+      m_final_stats_printed = true;
       
       m_logger->info("=== Final Statistics ===");
       m_logger->info("Total simulation cycles: {}", m_current_cycle);
@@ -463,6 +786,13 @@ class LoadStoreNCoreTrace : public IFrontEnd, public Implementation {
       
       m_logger->info("Overall: Total_Reads={}, Total_Writes={}, Completed_Reads={}", 
                     total_reads, total_writes, total_completed_reads);
+
+      if (m_sampling) {
+        m_logger->info("Sampled: Windows={}, Avg_Read_Latency={:.2f} +/- {:.2f} cycles, Throughput={:.4f} +/- {:.4f} requests/cycle (95% CI)",
+                      s_num_sample_windows,
+                      s_sampled_avg_read_latency, s_sampled_avg_read_latency_ci,
+                      s_sampled_throughput, s_sampled_throughput_ci);
+      }
     }
 };
 
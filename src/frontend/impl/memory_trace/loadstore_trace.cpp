@@ -42,6 +42,7 @@ class LoadStoreTrace : public IFrontEnd, public Implementation {
 
 
     void tick() override {
+      RAMULATOR_PROFILE_SCOPE();
       if((m_trace_count < m_trace_length)) {
         if(m_trace_count == elapsed_tick*(m_trace_length/50)) {
           m_logger->info("Trace-Mode Progress [{}/{}]", m_trace_count,m_trace_length);
@@ -64,6 +65,19 @@ class LoadStoreTrace : public IFrontEnd, public Implementation {
     };
 
 
+    Clk_t get_next_event_clk() override {
+      // Once the whole trace is sent, we only wait for the memory system to drain
+      if (m_trace_count < m_trace_length) {
+        return 0;
+      }
+      return std::numeric_limits<Clk_t>::max();
+    };
+
+    void serialize(Archive& ar) override {
+      ar & m_curr_trace_idx & m_trace_count & elapsed_tick;
+    };
+
+
   private:
     void init_trace(const std::string& file_path_str) {
       fs::path trace_path(file_path_str);
@@ -37,11 +37,16 @@ class ReadWriteTrace : public IFrontEnd, public Implementation {
 
 
     void tick() override {
+      RAMULATOR_PROFILE_SCOPE();
       const Trace& t = m_trace[m_curr_trace_idx];
       m_memory_system->send({t.addr_vec, t.is_write ? Request::Type::Write : Request::Type::Read});
       m_curr_trace_idx = (m_curr_trace_idx + 1) % m_trace_length;
     };
 
+    void serialize(Archive& ar) override {
+      ar & m_curr_trace_idx;
+    };
+
 
   private:
     void init_trace(const std::string& file_path_str) {
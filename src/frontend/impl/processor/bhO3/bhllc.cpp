@@ -323,10 +323,10 @@ void BHO3LLC::connect_memory_system(IMemorySystem* memory_system) {
   m_memory_system = memory_system;
   IDRAM* dram = static_cast<IBHMemorySystem*>(memory_system)->get_dram();
 
-  m_rank_level = dram->m_levels("rank");
-  m_bank_group_level = dram->m_levels("bankgroup");
-  m_bank_level = dram->m_levels("bank");
-  m_row_level = dram->m_levels("row");
+  m_rank_level = dram->m_ids.level.rank.required();
+  m_bank_group_level = dram->m_ids.level.bankgroup.required();
+  m_bank_level = dram->m_ids.level.bank.required();
+  m_row_level = dram->m_ids.level.row.required();
 
   m_num_ranks = dram->get_level_size("rank");
   m_num_banks_per_rank = dram->get_level_size("bankgroup") == -1 ? 
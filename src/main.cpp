@@ -7,6 +7,7 @@
 
 #include "base/base.h"
 #include "base/config.h"
+#include "base/simulation.h"
 #include "frontend/frontend.h"
 #include "memory_system/memory_system.h"
 #include "example/example_ifce.h"
@@ -21,6 +22,16 @@ int main(int argc, char* argv[]) {
   program.add_argument("-p", "--param").metavar("KEY=VALUE")
     .append()
     .help("Specify parameter to override in the configuration file. Repeat this option to change multiple parameters.");
+  program.add_argument("--checkpoint_at").metavar("CYCLE")
+    .help("Save a checkpoint of the simulated system at the given memory system cycle.");
+  program.add_argument("--checkpoint_file").metavar("path-to-checkpoint")
+    .default_value(std::string("ramulator2.ckpt"))
+    .help("Path to the checkpoint file to save.");
+  program.add_argument("--exit_after_checkpoint")
+    .default_value(false).implicit_value(true)
+    .help("Exit after saving the checkpoint instead of continuing the simulation.");
+  program.add_argument("-r", "--restore").metavar("path-to-checkpoint")
+    .help("Restore the simulated system from a checkpoint (created with the same configuration) before simulating.");
 
   try {
     program.parse_args(argc, argv);
@@ -78,6 +89,7 @@ int main(int argc, char* argv[]) {
   } else if (use_yaml_file) {
     config = Ramulator::Config::parse_config_file(config_file_path, params);
   }
+  Ramulator::Profiler::configure(config);
 
   // Instaniate the frontend of the simulated system, this is one of the top-level objects in Ramulator 2.0.
   // It also recursively instaniate all components in the frontend.
@@ -92,28 +104,34 @@ int main(int argc, char* argv[]) {
   frontend->connect_memory_system(memory_system);
   memory_system->connect_frontend(frontend);
 
-  // Get the relative clock ratio between the frontend and memory system
-  int frontend_tick = frontend->get_clock_ratio();
-  int mem_tick = memory_system->get_clock_ratio();
-
-  int tick_mult = frontend_tick * mem_tick;
+  uint64_t step = 0;
+  if (auto arg = program.present<std::string>("--restore")) {
+    Ramulator::Checkpoint(*arg, frontend, memory_system, step).deserialize();
+    std::cout<<"Restored the checkpoint "<<*arg<<" at step "<<step<<std::endl;
+  }
 
   std::cout<<"Ramulator tick start!!"<<std::endl;
   auto sim_start = std::chrono::high_resolution_clock::now();
 
-  for (uint64_t i = 0;; i++) {
-    if (((i % tick_mult) % mem_tick) == 0) {
-      frontend->tick();
-    }
-
-    if (frontend->is_finished() || memory_system->is_host_stall_terminated()) {
-      break;
-    }
-
-    if ((i % tick_mult) % frontend_tick == 0) {
-      memory_system->tick();
+  bool is_finished = false;
+  if (auto arg = program.present<std::string>("--checkpoint_at")) {
+    // Checkpoint once the memory system has ticked the given number of cycles
+    uint64_t checkpoint_step = std::stoull(*arg) * frontend->get_clock_ratio();
+    is_finished = Ramulator::Simulation::run_until(frontend, memory_system, step, checkpoint_step);
+    if (!is_finished) {
+      std::string checkpoint_file = program.get<std::string>("--checkpoint_file");
+      Ramulator::Checkpoint(checkpoint_file, frontend, memory_system, step).serialize();
+      std::cout<<"Saved the checkpoint "<<checkpoint_file<<" at step "<<step<<std::endl;
+      if (program.get<bool>("--exit_after_checkpoint")) {
+        return 0;
+      }
+    } else {
+      spdlog::warn("The simulation finished before the checkpoint cycle!");
     }
   }
+  if (!is_finished) {
+    Ramulator::Simulation::run_until(frontend, memory_system, step);
+  }
 
   auto sim_end = std::chrono::high_resolution_clock::now();
   auto sim_duration = std::chrono::duration_cast<std::chrono::milliseconds>(sim_end - sim_start);
@@ -0,0 +1,122 @@
+#ifndef     RAMULATOR_MEMORYSYSTEM_CHANNEL_TICK_POOL_H
+#define     RAMULATOR_MEMORYSYSTEM_CHANNEL_TICK_POOL_H
+
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <thread>
+#include <vector>
+
+namespace Ramulator {
+
+/**
+ * @brief    A worker pool that ticks disjoint sets of channels in parallel, one cycle at a time.
+ * 
+ * @details
+ * Channel i is always ticked by worker (i % num_workers), and the calling thread acts as worker 0.
+ * run_cycle() starts a cycle by bumping a generation counter and returns only after every worker
+ * has ticked all of its channels (i.e., a lock-free spin barrier per cycle). The memory system is
+ * responsible for keeping anything shared between channels out of the parallel section.
+ * 
+ */
+class ChannelTickPool {
+  public:
+    ChannelTickPool(int num_channels, int num_workers, std::function<void(int)> tick_channel) :
+      m_num_channels(num_channels), m_num_workers(num_workers), m_tick_channel(std::move(tick_channel)) {
+      m_errors.resize(m_num_workers);
+      for (int worker_id = 1; worker_id < m_num_workers; worker_id++) {
+        m_workers.emplace_back(&ChannelTickPool::worker_loop, this, worker_id);
+      }
+    };
+
+    ~ChannelTickPool() {
+      m_stop.store(true, std::memory_order_release);
+      m_generation.fetch_add(1, std::memory_order_release);
+      for (auto& worker : m_workers) {
+        worker.join();
+      }
+    };
+
+    ChannelTickPool(const ChannelTickPool&) = delete;
+    ChannelTickPool& operator=(const ChannelTickPool&) = delete;
+
+    int get_num_workers() const { return m_num_workers; };
+
+    /**
+     * @brief    Ticks all channels for one cycle and waits for all workers to finish.
+     * 
+     */
+    void run_cycle() {
+      m_num_done.store(0, std::memory_order_relaxed);
+      m_generation.fetch_add(1, std::memory_order_release);
+
+      tick_channels(0);
+
+      while (m_num_done.load(std::memory_order_acquire) != m_num_workers - 1) {
+        backoff();
+      }
+
+      // Rethrow the first exception (in worker order) on the simulation thread
+      for (auto& error : m_errors) {
+        if (error) {
+          std::exception_ptr e = error;
+          error = nullptr;
+          std::rethrow_exception(e);
+        }
+      }
+    };
+
+  private:
+    void tick_channels(int worker_id) {
+      try {
+        for (int channel_id = worker_id; channel_id < m_num_channels; channel_id += m_num_workers) {
+          m_tick_channel(channel_id);
+        }
+      } catch (...) {
+        m_errors[worker_id] = std::current_exception();
+      }
+    };
+
+    void worker_loop(int worker_id) {
+      uint64_t generation = 0;
+      while (true) {
+        uint64_t next_generation;
+        while ((next_generation = m_generation.load(std::memory_order_acquire)) == generation) {
+          backoff();
+        }
+        generation = next_generation;
+        if (m_stop.load(std::memory_order_acquire)) {
+          return;
+        }
+        tick_channels(worker_id);
+        m_num_done.fetch_add(1, std::memory_order_release);
+      }
+    };
+
+    // Spin for a short while, then give up the core (e.g., when the host is oversubscribed)
+    static void backoff() {
+      thread_local int spins = 0;
+      if (++spins < 1024) {
+        return;
+      }
+      spins = 0;
+      std::this_thread::yield();
+    };
+
+  private:
+    int m_num_channels = 0;
+    int m_num_workers = 1;
+    std::function<void(int)> m_tick_channel;
+
+    std::vector<std::thread> m_workers;
+    std::vector<std::exception_ptr> m_errors;  // Per worker, so that workers never write to the same slot
+
+    alignas(64) std::atomic<uint64_t> m_generation{0};
+    alignas(64) std::atomic<int> m_num_done{0};
+    std::atomic<bool> m_stop{false};
+};
+
+}        // namespace Ramulator
+
+
+#endif   // RAMULATOR_MEMORYSYSTEM_CHANNEL_TICK_POOL_H
@@ -0,0 +1,157 @@
+#ifndef     RAMULATOR_MEMORYSYSTEM_CONVERGENCE_MONITOR_H
+#define     RAMULATOR_MEMORYSYSTEM_CONVERGENCE_MONITOR_H
+
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "base/type.h"
+#include "base/serialization.h"
+#include "base/exception.h"
+
+namespace Ramulator {
+
+/**
+ * @brief    Detects when the windowed performance metrics of a run stop changing
+ *
+ * @details
+ * The run is split into windows of (at least) window_cycles cycles. Every metric is a ratio of two
+ * cumulative counters (e.g., total read latency / number of reads), so its value in a window is the
+ * ratio of the counters' increments over the window. Each metric keeps the values of its last
+ * num_windows windows with samples. The run has converged once, for every metric, the relative
+ * standard error of the mean over these windows (stddev / sqrt(num_windows) / |mean|) is at most the
+ * tolerance. Only the recent windows count, so a phase change (e.g., after a warm-up) restarts the
+ * check instead of being averaged away by the earlier windows. A metric without samples in a window
+ * (e.g., no reads) skips the window, and a metric that never had any sample is ignored.
+ *
+ */
+class ConvergenceMonitor {
+  public:
+    struct Ratio {
+      double numerator;
+      double denominator;
+    };
+
+  private:
+    struct Metric {
+      std::string name;
+      Ratio last = {0.0, 0.0};        // The cumulative counters at the end of the previous window
+      std::vector<double> values;     // Ring buffer of the values of the last windows with samples
+      size_t next = 0;                // Ring buffer slot of the next window value
+
+      double mean() const {
+        double sum = 0.0;
+        for (double value : values) {
+          sum += value;
+        }
+        return values.empty() ? 0.0 : sum / values.size();
+      };
+    };
+
+    Clk_t m_window_cycles;
+    double m_tolerance;
+    int m_num_windows;
+
+    std::vector<Metric> m_metrics;
+    Clk_t m_next_window_clk;
+
+  public:
+    bool s_converged = false;
+    Clk_t s_converged_clk = -1;
+
+  public:
+    ConvergenceMonitor(Clk_t window_cycles, double tolerance, int num_windows, std::vector<std::string> metric_names) :
+      m_window_cycles(window_cycles), m_tolerance(tolerance), m_num_windows(num_windows), m_next_window_clk(window_cycles) {
+      if (m_window_cycles <= 0) {
+        throw ConfigurationError("Convergence window must be positive!");
+      }
+      if (m_num_windows < 2) {
+        throw ConfigurationError("Convergence num_windows must be at least 2!");
+      }
+      if (m_tolerance < 0.0) {
+        throw ConfigurationError("Convergence tolerance must not be negative!");
+      }
+      for (auto& name : metric_names) {
+        m_metrics.push_back({name});
+      }
+    };
+
+    bool is_window_end(Clk_t clk) const { return clk >= m_next_window_clk; };
+
+    /**
+     * @brief    Ends the window at the given cycle. Returns true once the run has converged.
+     *
+     * @param    clk            The current cycle.
+     * @param    counters       The cumulative counters of each metric, in the order of the metric names.
+     */
+    bool end_window(Clk_t clk, const std::vector<Ratio>& counters) {
+      m_next_window_clk = clk + m_window_cycles;
+      if (s_converged) {
+        return true;
+      }
+
+      for (size_t i = 0; i < m_metrics.size(); i++) {
+        Metric& metric = m_metrics[i];
+        double numerator = counters[i].numerator - metric.last.numerator;
+        double denominator = counters[i].denominator - metric.last.denominator;
+        metric.last = counters[i];
+        if (denominator <= 0.0) {
+          continue;
+        }
+
+        if (metric.values.size() < (size_t)m_num_windows) {
+          metric.values.push_back(numerator / denominator);
+        } else {
+          metric.values[metric.next] = numerator / denominator;
+        }
+        metric.next = (metric.next + 1) % m_num_windows;
+      }
+
+      bool is_stable = false;
+      for (auto& metric : m_metrics) {
+        if (metric.values.empty()) {
+          continue;
+        }
+        if (metric.values.size() < (size_t)m_num_windows) {
+          is_stable = false;
+          break;
+        }
+
+        double mean = metric.mean();
+        double sum_sq = 0.0;
+        for (double value : metric.values) {
+          sum_sq += (value - mean) * (value - mean);
+        }
+        double std_error = std::sqrt(sum_sq / (m_num_windows - 1) / m_num_windows);
+        if (std_error > m_tolerance * std::abs(mean)) {
+          is_stable = false;
+          break;
+        }
+        is_stable = true;
+      }
+
+      if (is_stable) {
+        s_converged = true;
+        s_converged_clk = clk;
+      }
+      return s_converged;
+    };
+
+    /**
+     * @brief    Returns the mean of the i-th metric over its last num_windows windows.
+     *
+     */
+    double get_mean(int i) const { return m_metrics[i].mean(); };
+
+    void serialize(Archive& ar) {
+      ar & m_next_window_clk & s_converged & s_converged_clk;
+      for (auto& metric : m_metrics) {
+        ar & metric.last.numerator & metric.last.denominator & metric.values & metric.next;
+      }
+    };
+};
+
+}        // namespace Ramulator
+
+#endif   // RAMULATOR_MEMORYSYSTEM_CONVERGENCE_MONITOR_H
@@ -159,11 +159,11 @@ class AsyncDIMMSystem final : public IMemorySystem, public Implementation {
       m_num_bankgroups = m_dram->get_level_size("bankgroup");
       m_num_banks     = m_dram->get_level_size("bank");
 
-      m_ch_addr_idx  = m_dram->m_levels("channel");
-      m_rk_addr_idx  = m_dram->m_levels("rank");
-      m_bg_addr_idx  = m_dram->m_levels("bankgroup");
-      m_bk_addr_idx  = m_dram->m_levels("bank");
-      m_row_addr_idx = m_dram->m_levels("row");
+      m_ch_addr_idx  = m_dram->m_ids.level.channel.required();
+      m_rk_addr_idx  = m_dram->m_ids.level.rank.required();
+      m_bg_addr_idx  = m_dram->m_ids.level.bankgroup.required();
+      m_bk_addr_idx  = m_dram->m_ids.level.bank.required();
+      m_row_addr_idx = m_dram->m_ids.level.row.required();
 
       m_debug_fsm_sync = param<bool>("debug_fsm_sync").default_val(false);
       m_debug_mode     = param<bool>("debug_mode").default_val(false);
@@ -270,6 +270,13 @@ class AsyncDIMMSystem final : public IMemorySystem, public Implementation {
         m_rank_state[ch].resize(m_num_ranks, SystemNMAState::HOST_MODE);
 
       m_clock_ratio = param<uint>("clock_ratio").required();
+      // The host and NMA controllers exchange interrupts and bypass requests within a cycle, so they are always ticked serially
+      if (param<int>("tick_threads").desc("Only 1 (serial) is supported by the AsyncDIMM system.").default_val(1) != 1) {
+        throw ConfigurationError("AsyncDIMM system does not support ticking the channels in parallel (tick_threads must be 1)!");
+      }
+      if (m_config["convergence"]) {
+        throw ConfigurationError("AsyncDIMM system does not support stopping on convergence!");
+      }
       m_concurrent_mode_enable = param<bool>("concurrent_mode_enable").default_val(false);
       if (m_concurrent_mode_enable)
         m_logger->info("  -- Concurrent Mode (Phase 3 OSR) ENABLED");
@@ -349,6 +356,47 @@ class AsyncDIMMSystem final : public IMemorySystem, public Implementation {
 
     void setup(IFrontEnd* frontend, IMemorySystem* memory_system) override { }
 
+    void serialize(Archive& ar) override {
+      ar & m_clk & m_fsm_sync_errors;
+      ar & m_last_host_send_clk & m_host_send_ever & m_host_stall_terminated;
+      ar & m_curr_trace_idx & m_next_request_id & m_wait_trace_done & m_trace_done & m_trace_exhausted_logged;
+      ar & m_nma_ever_started & m_trace_repeat_done & m_outstanding_reads & m_rank_state;
+
+      // The NMA controllers are not components, so they are saved with the system that owns them
+      for (auto& nma_controllers : m_nma_controllers) {
+        for (auto* nma_controller : nma_controllers) {
+          ar & *nma_controller;
+        }
+      }
+
+      // The latency histogram is mostly empty, so only the occupied bins are saved
+      std::map<uint32_t, uint64_t> occupied_bins;
+      for (uint32_t i = 0; i < NUM_BINS; i++) {
+        if (hist_[i] != 0) {
+          occupied_bins[i] = hist_[i];
+        }
+      }
+      ar & occupied_bins;
+      if (ar.is_loading()) {
+        hist_.fill(0);
+        for (const auto& [bin, count] : occupied_bins) {
+          hist_[bin] = count;
+        }
+      }
+      ar & total_reads_ & sum_lat_ & max_lat_ & overflow_;
+    };
+
+    std::function<void(Request&)> restore_callback(const Request& req) override {
+      // Reads of the trace core complete back to the memory system itself
+      if (req.is_trace_core_req) {
+        int req_id = req.callback_id;
+        return [this, req_id](Request& completed_req) {
+          this->on_read_complete(req_id, completed_req);
+        };
+      }
+      return nullptr;
+    };
+
     /**
      * send(): Route request to Host MC.
      *
@@ -380,6 +428,7 @@ class AsyncDIMMSystem final : public IMemorySystem, public Implementation {
     };
 
     void tick() override {
+      RAMULATOR_PROFILE_SCOPE();
       m_clk++;
 
       // Host stall detection: tcore backpressure → host can't send
@@ -447,7 +496,11 @@ class AsyncDIMMSystem final : public IMemorySystem, public Implementation {
     };
 
     float get_tCK() override {
-      return m_dram->m_timing_vals("tCK_ps") / 1000.0f;
+      return m_dram->m_timing_vals(m_dram->m_ids.timing.tCK_ps.required()) / 1000.0f;
+    }
+
+    Clk_t get_clk() override {
+      return m_clk;
     }
 
     bool is_finished() override {
@@ -493,10 +546,10 @@ class AsyncDIMMSystem final : public IMemorySystem, public Implementation {
         : (float)total_latency / (float)s_num_read_requests;
 
       // Bandwidth report (AsyncDIMM: Host<->NMA, NMA<->DRAM)
-      std::cout << "\n=== Memory System Bandwidth (GB/s) ===\n";
-      std::cout << "Assume: 512 bits/access, BW = bytes/ns\n\n";
+      report_stream() << "\n=== Memory System Bandwidth (GB/s) ===\n";
+      report_stream() << "Assume: 512 bits/access, BW = bytes/ns\n\n";
 
-      int tCK_ps = m_dram->m_timing_vals("tCK_ps");
+      int tCK_ps = m_dram->m_timing_vals(m_dram->m_ids.timing.tCK_ps.required());
 
       // Collect Host MC counters (Host<->NMA side)
       // Layout: [0] main bypass, [1] main offload, [2-4] NMA<->DRAM placeholders,
@@ -539,7 +592,7 @@ class AsyncDIMMSystem final : public IMemorySystem, public Implementation {
       uint64_t m4 = counters[4];                 // main NMA<->DRAM NMA (always 0)
 
       // ---- Main window (non-tcore only) ----
-      std::cout << "[Main window]\n";
+      report_stream() << "[Main window]\n";
       print_bw("Host <-> NMA",
           calc_bw_gbs(m0+m1, 1.0, m_clk, tCK_ps));
       print_bw("Host <-> NMA: Bypass",
@@ -556,7 +609,7 @@ class AsyncDIMMSystem final : public IMemorySystem, public Implementation {
           calc_bw_gbs(m4, 1.0, m_clk, tCK_ps));
 
       // ---- tcore window ----
-      std::cout << "\n[tcore window]\n";
+      report_stream() << "\n[tcore window]\n";
       print_bw("tcore Host <-> NMA",
           calc_bw_gbs(counters[5]+counters[6], 1.0, m_clk, tCK_ps));
       print_bw("tcore Host <-> NMA: Bypass",
@@ -572,7 +625,7 @@ class AsyncDIMMSystem final : public IMemorySystem, public Implementation {
       print_bw("tcore NMA <-> DRAM: NMA",
           calc_bw_gbs(counters[9], 1.0, m_clk, tCK_ps));
 
-      std::cout << std::endl;
+      report_stream() << std::endl;
 
       // NMA MC stats
       for (int ch = 0; ch < m_num_channels; ch++)
@@ -586,11 +639,11 @@ class AsyncDIMMSystem final : public IMemorySystem, public Implementation {
 
       // FSM sync summary
       if (m_debug_fsm_sync) {
-        std::cout << "\n=== AsyncDIMM FSM Sync Verification ===" << std::endl;
+        report_stream() << "\n=== AsyncDIMM FSM Sync Verification ===" << std::endl;
         if (m_fsm_sync_errors == 0)
-          std::cout << "PASS: FSMs in sync for " << m_clk << " cycles" << std::endl;
+          report_stream() << "PASS: FSMs in sync for " << m_clk << " cycles" << std::endl;
         else
-          std::cout << "FAIL: " << m_fsm_sync_errors << " FSM sync errors!" << std::endl;
+          report_stream() << "FAIL: " << m_fsm_sync_errors << " FSM sync errors!" << std::endl;
       }
 
       // Cleanup
@@ -849,6 +902,7 @@ class AsyncDIMMSystem final : public IMemorySystem, public Implementation {
           req.callback = [this, req_id](Request& completed_req) {
             this->on_read_complete(req_id, completed_req);
           };
+          req.callback_id = req_id;
         }
 
         req.is_trace_core_req = true;
@@ -1001,10 +1055,10 @@ class AsyncDIMMSystem final : public IMemorySystem, public Implementation {
       return bytes / time_ns;
     }
 
-    static inline void print_bw(const std::string& name, double bw) {
-      std::cout << std::left << std::setw(32) << name
-                << " : " << std::right << std::setw(10)
-                << std::fixed << std::setprecision(3) << bw << " GB/s\n";
+    void print_bw(const std::string& name, double bw) {
+      report_stream() << std::left << std::setw(32) << name
+                      << " : " << std::right << std::setw(10)
+                      << std::fixed << std::setprecision(3) << bw << " GB/s\n";
     }
 
     inline void record_latency(uint64_t lat) {
@@ -80,7 +80,7 @@ class BHDRAMSystem final : public IBHMemorySystem, public Implementation {
     };
 
     float get_tCK() override {
-      return m_dram->m_timing_vals("tCK_ps") / 1000.0f;
+      return m_dram->m_timing_vals(m_dram->m_ids.timing.tCK_ps.required()) / 1000.0f;
     }
 
     IDRAM* get_dram() override {
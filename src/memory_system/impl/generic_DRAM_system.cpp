@@ -1,4 +1,6 @@
 #include "memory_system/memory_system.h"
+#include "memory_system/channel_tick_pool.h"
+#include "memory_system/convergence_monitor.h"
 #include "translation/translation.h"
 #include "dram_controller/controller.h"
 #include "addr_mapper/addr_mapper.h"
@@ -22,6 +24,13 @@ class GenericDRAMSystem final : public IMemorySystem, public Implementation {
     IAddrMapper*  m_addr_mapper;
     std::vector<IDRAMController*> m_controllers;    
 
+    int m_tick_threads = 1;                         // Number of threads ticking the channels
+    std::unique_ptr<ChannelTickPool> m_tick_pool;   // Only created when the channels are ticked in parallel
+    bool m_replaying_callbacks = false;             // Set while the deferred callbacks of a parallel tick run
+
+    // Early termination once the read latency, bandwidth, and row-hit rate stop changing
+    std::unique_ptr<ConvergenceMonitor> m_convergence;
+
   public:
     Logger_t m_logger;
     
@@ -127,12 +136,33 @@ class GenericDRAMSystem final : public IMemorySystem, public Implementation {
 
       m_clock_ratio = param<uint>("clock_ratio").required();
 
+      m_tick_threads = param<int>("tick_threads").desc("Number of threads ticking the channels in parallel (1: serial).").default_val(1);
+      if (m_tick_threads > 1 && num_channels > 1) {
+        int num_workers = std::min(m_tick_threads, num_channels);
+        m_tick_pool = std::make_unique<ChannelTickPool>(num_channels, num_workers, [this](int channel_id) { m_controllers[channel_id]->tick(); });
+        m_dram->set_channel_parallel(true);
+        for (auto controller : m_controllers) {
+          controller->set_defer_callbacks(true);
+        }
+        m_logger->info(" Ticking {} channels with {} threads", num_channels, num_workers);
+      }
+
       register_stat(m_clk).name("memory_system_cycles");
       register_stat(s_num_read_requests).name("total_num_read_requests");
       register_stat(s_num_write_requests).name("total_num_write_requests");
       register_stat(s_num_other_requests).name("total_num_other_requests");
       register_stat(s_avg_read_latency).name("avg_host_read_latency");      
 
+      if (m_config["convergence"]) {
+        Clk_t window = param_group("convergence").param<Clk_t>("window").desc("Number of cycles in each measurement window.").default_val(10000);
+        double tolerance = param_group("convergence").param<double>("tolerance").desc("Maximum relative standard error of the metrics over the last num_windows windows.").default_val(0.01);
+        int num_windows = param_group("convergence").param<int>("num_windows").desc("Number of most recent windows the metrics are measured over.").default_val(5);
+        m_convergence = std::make_unique<ConvergenceMonitor>(window, tolerance, num_windows, std::vector<std::string>{"read_latency", "bandwidth", "row_hit_rate"});
+        register_stat(m_convergence->s_converged).name("converged").desc("Whether the run stopped early because the metrics converged.");
+        register_stat(m_convergence->s_converged_clk).name("converged_at_cycle");
+        m_logger->info(" Stopping on convergence (window: {} cycles, tolerance: {}, windows: {})", window, tolerance, num_windows);
+      }
+
       // NDP Trace Initialization
       m_trace_core_enable = param<bool>("trace_core_enable").desc("Enable Trace Simulation Core with Gem5").default_val(false);
       
@@ -158,7 +188,47 @@ class GenericDRAMSystem final : public IMemorySystem, public Implementation {
 
     void setup(IFrontEnd* frontend, IMemorySystem* memory_system) override { }
 
+    void serialize(Archive& ar) override {
+      ar & m_clk & m_host_access;
+      ar & m_last_host_send_clk & m_host_send_ever & m_host_stall_terminated;
+      ar & m_curr_trace_idx & m_next_request_id & m_wait_trace_done & m_outstanding_reads;
+
+      // The latency histogram is mostly empty, so only the occupied bins are saved
+      std::map<uint32_t, uint64_t> occupied_bins;
+      for (uint32_t i = 0; i < NUM_BINS; i++) {
+        if (hist_[i] != 0) {
+          occupied_bins[i] = hist_[i];
+        }
+      }
+      ar & occupied_bins;
+      if (ar.is_loading()) {
+        hist_.fill(0);
+        for (const auto& [bin, count] : occupied_bins) {
+          hist_[bin] = count;
+        }
+      }
+      ar & total_reads_ & sum_lat_ & max_lat_ & overflow_;
+      if (m_convergence) {
+        ar & *m_convergence;
+      }
+    };
+
+    std::function<void(Request&)> restore_callback(const Request& req) override {
+      // Reads of the trace core complete back to the memory system itself
+      if (req.is_trace_core_req) {
+        int req_id = req.callback_id;
+        return [this, req_id](Request& completed_req) {
+          this->on_read_complete(req_id, completed_req);
+        };
+      }
+      return nullptr;
+    };
+
     bool send(Request req) override {
+      if (m_replaying_callbacks) {
+        // In a serial tick, the later channels would still see this request in the current cycle
+        throw std::runtime_error("Sending requests from a request callback is not supported with tick_threads > 1!");
+      }
       m_addr_mapper->apply(req);
       int channel_id = req.addr_vec[0];
       if(!(req.is_trace_core_req)) {
@@ -219,7 +289,20 @@ class GenericDRAMSystem final : public IMemorySystem, public Implementation {
       return is_success;
     };
 
+    void functional_access(Request req) override {
+      m_addr_mapper->apply(req);
+      m_controllers[req.addr_vec[0]]->functional_access(req);
+    };
+
+    void check_functional_access() override {
+      m_dram->check_functional_access();
+      for (auto controller : m_controllers) {
+        controller->check_functional_access();
+      }
+    };
+
     void tick() override {
+      RAMULATOR_PROFILE_SCOPE();
       m_clk++;
       // Trace Mode :  Send Trace-based Request to DRAM System
       if(m_trace_core_enable && !m_host_access) try_issue_requests();
@@ -234,8 +317,18 @@ class GenericDRAMSystem final : public IMemorySystem, public Implementation {
       }
 
       m_dram->tick();
+      if (m_tick_pool) {
+        // Future actions and callbacks are replayed in channel order, as in a serial run
+        m_tick_pool->run_cycle();
+        m_dram->commit_future_actions();
+        m_replaying_callbacks = true;
+      }
       for (auto controller : m_controllers) {
-        controller->tick();
+        if (m_tick_pool) {
+          controller->run_deferred_callbacks();
+        } else {
+          controller->tick();
+        }
         while(1) {
           read_latency = controller->get_req_latency();
           if(read_latency == 0) {
@@ -245,10 +338,70 @@ class GenericDRAMSystem final : public IMemorySystem, public Implementation {
           }
         }
       }
+      m_replaying_callbacks = false;
+
+      if (m_convergence && m_convergence->is_window_end(m_clk)) {
+        update_convergence();
+      }
+    };
+
+    void update_convergence() {
+      // The same counters as calc_bw_gbs(): 512 bits per access over m_clk * tCK
+      uint64_t num_accesses = 0;
+      uint64_t num_row_hits = 0;
+      uint64_t num_row_accesses = 0;
+      for (auto controller : m_controllers) {
+        num_accesses += controller->get_counters()[0];
+        num_row_hits += controller->get_row_hit_counter();
+        num_row_accesses += controller->get_row_access_counter();
+      }
+      double time_ns = m_clk * (m_dram->m_timing_vals(m_dram->m_ids.timing.tCK_ps.required()) / 1000.0);
+
+      bool was_converged = m_convergence->s_converged;
+      bool is_converged = m_convergence->end_window(m_clk, {
+        {(double)sum_lat_, (double)total_reads_},
+        {num_accesses * 512.0 / 8.0, time_ns},
+        {(double)num_row_hits, (double)num_row_accesses},
+      });
+      if (is_converged && !was_converged) {
+        m_logger->info("Converged at cycle {} (read latency: {:.2f} cycles, bandwidth: {:.3f} GB/s, row-hit rate: {:.4f}) — terminating simulation.",
+                       m_clk, m_convergence->get_mean(0), m_convergence->get_mean(1), m_convergence->get_mean(2));
+      }
+    };
+
+    Clk_t get_next_event_clk() override {
+      // The trace core issues requests and checks for host stalls every cycle
+      if (m_trace_core_enable) {
+        return m_clk + 1;
+      }
+
+      Clk_t next_clk = m_dram->get_next_event_clk();
+      for (auto controller : m_controllers) {
+        if (next_clk <= m_clk + 1) {
+          break;
+        }
+        next_clk = std::min(next_clk, controller->get_next_event_clk());
+      }
+      return next_clk;
+    };
+
+    void fast_forward(Clk_t clk) override {
+      if (clk <= m_clk) {
+        return;
+      }
+      m_clk = clk;
+      m_dram->fast_forward(clk);
+      for (auto controller : m_controllers) {
+        controller->fast_forward(clk);
+      }
     };
 
     float get_tCK() override {
-      return m_dram->m_timing_vals("tCK_ps") / 1000.0f;
+      return m_dram->m_timing_vals(m_dram->m_ids.timing.tCK_ps.required()) / 1000.0f;
+    }
+
+    Clk_t get_clk() override {
+      return m_clk;
     }
 
     // const SpecDef& get_supported_requests() override {
@@ -282,12 +435,16 @@ class GenericDRAMSystem final : public IMemorySystem, public Implementation {
       return m_host_stall_terminated;
     }
 
+    bool is_converged() override {
+      return m_convergence && m_convergence->s_converged;
+    }
+
     virtual void mem_sys_finalize() override {
       size_t total_latency = 0;
       int num_channels = m_dram->get_level_size("channel");
       for (int i = 0; i < num_channels; i++) {
         total_latency+=m_controllers[i]->get_host_acces_latency();
-        std::cout<<"Latency : "<<total_latency<<std::endl;
+        report_stream()<<"Latency : "<<total_latency<<std::endl;
       } 
       
       // There is no normal read request, read latency is minus 1
@@ -303,8 +460,8 @@ class GenericDRAMSystem final : public IMemorySystem, public Implementation {
         }
       #endif        
 
-      std::cout << "\n=== Memory System Bandwidth (GB/s) ===\n";
-      std::cout << "Assume: 512 bits/access, BW = bytes/ns\n\n";      
+      report_stream() << "\n=== Memory System Bandwidth (GB/s) ===\n";
+      report_stream() << "Assume: 512 bits/access, BW = bytes/ns\n\n";      
 
       // 12 Counters per Memory Controller
       std::vector<uint64_t> counters;
@@ -319,14 +476,14 @@ class GenericDRAMSystem final : public IMemorySystem, public Implementation {
           throw std::runtime_error("Invalid Counter Number");
         }
       }          
-      int tCK_ps = m_dram->m_timing_vals("tCK_ps");
+      int tCK_ps = m_dram->m_timing_vals(m_dram->m_ids.timing.tCK_ps.required());
       // ---- Main window ----
-      std::cout << "[Main window]\n";      
+      report_stream() << "[Main window]\n";      
       print_bw("Host<->DB/DRAM",
           calc_bw_gbs(counters[0], 1.0, m_clk, tCK_ps));
 
       // ---- tcore window ----
-      std::cout << "\n[tcore window]\n";
+      report_stream() << "\n[tcore window]\n";
       print_bw("tcore Host<->DB/DRAM",
           calc_bw_gbs(counters[1], 1.0, m_clk, tCK_ps));      
 
@@ -470,6 +627,7 @@ class GenericDRAMSystem final : public IMemorySystem, public Implementation {
           req.callback = [this, req_id](Request& completed_req) {
             this->on_read_complete(req_id, completed_req);
           };
+          req.callback_id = req_id;
         }
         
         // Try to send the request
@@ -532,12 +690,12 @@ class GenericDRAMSystem final : public IMemorySystem, public Implementation {
         return bytes / time_ns; // GB/s
     }
 
-    static inline void print_bw(const std::string& name, double bw)
+    void print_bw(const std::string& name, double bw)
     {
-        std::cout << std::left << std::setw(32) << name
-                  << " : " << std::right << std::setw(10)
-                  << std::fixed << std::setprecision(3)
-                  << bw << " GB/s\n";
+        report_stream() << std::left << std::setw(32) << name
+                        << " : " << std::right << std::setw(10)
+                        << std::fixed << std::setprecision(3)
+                        << bw << " GB/s\n";
     }      
     
     inline void record_latency(uint64_t lat) {
@@ -1,4 +1,5 @@
 #include "memory_system/memory_system.h"
+#include "memory_system/channel_tick_pool.h"
 #include "translation/translation.h"
 #include "dram_controller/controller.h"
 #include "addr_mapper/addr_mapper.h"
@@ -33,6 +34,10 @@ class NDPDRAMSystem final : public IMemorySystem, public Implementation {
     IAddrMapper*  m_addr_mapper;
     std::vector<IDRAMController*> m_controllers;    
 
+    int m_tick_threads = 1;                         // Number of threads ticking the channels
+    std::unique_ptr<ChannelTickPool> m_tick_pool;   // Only created when the channels are ticked in parallel
+    bool m_replaying_callbacks = false;             // Set while the deferred callbacks of a parallel tick run
+
   public:
     size_t s_num_read_requests = 0;
     size_t s_num_write_requests = 0;
@@ -407,19 +412,19 @@ class NDPDRAMSystem final : public IMemorySystem, public Implementation {
       m_logger->info("  - Address Space (BG) of Control Reg of Host-Side NPU Ctrl: {}",ndp_ctrl_bg);
       m_logger->info("  - Address Space (BK) of Access Info Buf of Host-Side NPU Ctrl: {}",ndp_ctrl_buf_bk);
       m_logger->info("  - Address Space (BG) of Access Info Buf of Host-Side NPU Ctrl: {}",ndp_ctrl_buf_bg);    
-      row_addr_idx  = m_dram->m_levels("row");
-      bg_addr_idx   = m_dram->m_levels("bankgroup");
-      bk_addr_idx   = m_dram->m_levels("bank");
-      col_addr_idx  = m_dram->m_levels("column");
-      ch_addr_idx   = m_dram->m_levels("channel");
+      row_addr_idx  = m_dram->m_ids.level.row.required();
+      bg_addr_idx   = m_dram->m_ids.level.bankgroup.required();
+      bk_addr_idx   = m_dram->m_ids.level.bank.required();
+      col_addr_idx  = m_dram->m_ids.level.column.required();
+      ch_addr_idx   = m_dram->m_ids.level.channel.required();
 
       // Cache m_levels() results to avoid per-tick string hash lookups
-      lvl_channel_       = m_dram->m_levels("channel");
-      lvl_pseudochannel_ = m_dram->m_levels("pseudochannel");
-      lvl_bankgroup_     = m_dram->m_levels("bankgroup");
-      lvl_bank_          = m_dram->m_levels("bank");
-      lvl_row_           = m_dram->m_levels("row");
-      lvl_column_        = m_dram->m_levels("column");
+      lvl_channel_       = m_dram->m_ids.level.channel.required();
+      lvl_pseudochannel_ = m_dram->m_ids.level.pseudochannel.required();
+      lvl_bankgroup_     = m_dram->m_ids.level.bankgroup.required();
+      lvl_bank_          = m_dram->m_ids.level.bank.required();
+      lvl_row_           = m_dram->m_ids.level.row.required();
+      lvl_column_        = m_dram->m_ids.level.column.required();
 
       // Cache opcode constants to avoid per-tick std::map tree lookups
       OP_RD_ = m_ndp_access_inst_op.at("RD");
@@ -444,6 +449,20 @@ class NDPDRAMSystem final : public IMemorySystem, public Implementation {
         throw std::runtime_error("The number of channels must be even number!!!");
       }
       m_clock_ratio = param<uint>("clock_ratio").required();
+      if (m_config["convergence"]) {
+        throw ConfigurationError("NDP DRAM system does not support stopping on convergence!");
+      }
+
+      m_tick_threads = param<int>("tick_threads").desc("Number of threads ticking the channels in parallel (1: serial).").default_val(1);
+      if (m_tick_threads > 1 && num_channels > 1) {
+        int num_workers = std::min(m_tick_threads, num_channels);
+        m_tick_pool = std::make_unique<ChannelTickPool>(num_channels, num_workers, [this](int channel_id) { m_controllers[channel_id]->tick(); });
+        m_dram->set_channel_parallel(true);
+        for (auto controller : m_controllers) {
+          controller->set_defer_callbacks(true);
+        }
+        m_logger->info(" Ticking {} channels with {} threads", num_channels, num_workers);
+      }
 
       register_stat(m_clk).name("memory_system_cycles");
       register_stat(s_num_read_requests).name("total_num_read_requests");
@@ -607,7 +626,68 @@ class NDPDRAMSystem final : public IMemorySystem, public Implementation {
 
     void setup(IFrontEnd* frontend, IMemorySystem* memory_system) override { }
 
+    void serialize(Archive& ar) override {
+      ar & m_clk & m_host_access;
+      ar & m_last_host_send_clk & m_host_send_ever & m_host_stall_terminated;
+      ar & m_curr_trace_idx & m_next_request_id & m_wait_trace_done & m_outstanding_reads;
+
+      // HSNC state
+      ar & desc_store & pch_lvl_inst_buf & pch_lvl_inst_buf_tag & pch_lvl_inst_buf_valid & pch_lvl_inst_buf_lru;
+      ar & hsnc_base_reg & hsnc_loop_cnt_reg & pch_lvl_pc & pch_desc_count;
+      ar & pch_fetch_stall & pch_fetch_stall_col & pch_fetch_complete;
+      ar & desc_cache_hit_cnt & desc_cache_miss_cnt & desc_cache_evict_cnt;
+      ar & pch_lvl_hsnc_status & pch_lvl_polling & pch_lvl_hsnc_nl_addr_gen_slot & pch_lvl_hsnc_nl_addr_gen_slot_rr_idx;
+      ar & pch_lvl_hsnc_nl_addr_gen_wait_cnt & pch_lvl_hsnc_nl_addr_gen_wait_cycle;
+      ar & pch_lvl_hsnc_nl_addr_empty_cnt & pch_lvl_hsnc_nl_addr_wait_cnt;
+      ar & pch_hsnc_status_cnt & all_ndp_idle;
+      ar & hsnc_segments & hsnc_cur_seg & hsnc_seg_tracking & hsnc_seg_cnt;
+      #ifdef PCH_DEBUG
+      ar & pch_lvl_history;
+      #endif
+
+      // The latency histogram is mostly empty, so only the occupied bins are saved
+      std::map<uint32_t, uint64_t> occupied_bins;
+      for (uint32_t i = 0; i < NUM_BINS; i++) {
+        if (hist_[i] != 0) {
+          occupied_bins[i] = hist_[i];
+        }
+      }
+      ar & occupied_bins;
+      if (ar.is_loading()) {
+        hist_.fill(0);
+        for (const auto& [bin, count] : occupied_bins) {
+          hist_[bin] = count;
+        }
+      }
+      ar & total_reads_ & sum_lat_ & max_lat_ & overflow_;
+    };
+
+    std::function<void(Request&)> restore_callback(const Request& req) override {
+      if (!req.is_trace_core_req) {
+        return nullptr;
+      }
+      // Reads of the trace core complete back to the memory system itself
+      if (req.callback_id >= 0) {
+        int req_id = req.callback_id;
+        return [this, req_id](Request& completed_req) {
+          this->on_read_complete(req_id, completed_req);
+        };
+      }
+      // Otherwise it is a descriptor fetch, whose target is recovered from its address
+      int ch_id = req.addr_vec[lvl_channel_];
+      int dimm_id = ch_id / m_num_subch;
+      int pch_id = (ch_id % m_num_subch) * num_pseudochannel + req.addr_vec[lvl_pseudochannel_];
+      int col_addr = req.addr_vec[lvl_column_];
+      return [this, dimm_id, pch_id, col_addr](Request& completed_req) {
+        this->on_desc_fetch_complete(dimm_id, pch_id, col_addr);
+      };
+    };
+
     bool send(Request req) override {
+      if (m_replaying_callbacks) {
+        // In a serial tick, the later channels would still see this request in the current cycle
+        throw std::runtime_error("Sending requests from a request callback is not supported with tick_threads > 1!");
+      }
       m_addr_mapper->apply(req);
       
       bool is_success;      
@@ -677,6 +757,7 @@ class NDPDRAMSystem final : public IMemorySystem, public Implementation {
     };
 
     void tick() override {
+      RAMULATOR_PROFILE_SCOPE();
       m_clk++;
       // Trace Mode :  Send Trace-based Request to DRAM System
       if(m_trace_core_enable && !m_host_access) try_issue_requests();
@@ -690,9 +771,19 @@ class NDPDRAMSystem final : public IMemorySystem, public Implementation {
         m_host_stall_terminated = true;
       }
       m_dram->tick();
+      if (m_tick_pool) {
+        // Future actions and callbacks are replayed in channel order, as in a serial run
+        m_tick_pool->run_cycle();
+        m_dram->commit_future_actions();
+        m_replaying_callbacks = true;
+      }
 
       for (auto controller : m_controllers) {
-        controller->tick();
+        if (m_tick_pool) {
+          controller->run_deferred_callbacks();
+        } else {
+          controller->tick();
+        }
         while(1) {
           read_latency = controller->get_req_latency();
           if(read_latency == 0) {
@@ -702,6 +793,7 @@ class NDPDRAMSystem final : public IMemorySystem, public Implementation {
           }
         }
       }
+      m_replaying_callbacks = false;
 
       #ifdef PCH_DEBUG
         int error_pch;
@@ -1078,7 +1170,11 @@ class NDPDRAMSystem final : public IMemorySystem, public Implementation {
     };
 
     float get_tCK() override {
-      return m_dram->m_timing_vals("tCK_ps") / 1000.0f;
+      return m_dram->m_timing_vals(m_dram->m_ids.timing.tCK_ps.required()) / 1000.0f;
+    }
+
+    Clk_t get_clk() override {
+      return m_clk;
     }
 
     // const SpecDef& get_supported_requests() override {
@@ -1499,8 +1595,8 @@ class NDPDRAMSystem final : public IMemorySystem, public Implementation {
       else                          
         s_avg_read_latency = (float)total_latency/(float)s_num_read_requests;
 
-      std::cout << "\n=== Memory System Bandwidth (GB/s) ===\n";
-      std::cout << "Assume: 512 bits/access, BW = bytes/ns\n\n";      
+      report_stream() << "\n=== Memory System Bandwidth (GB/s) ===\n";
+      report_stream() << "Assume: 512 bits/access, BW = bytes/ns\n\n";      
 
       int dq_scaling = m_dram->get_dq_scaling();
       // 12 Counters per Memory Controller
@@ -1516,7 +1612,7 @@ class NDPDRAMSystem final : public IMemorySystem, public Implementation {
           throw std::runtime_error("Invalid Counter Number");
         }
       }          
-      int tCK_ps = m_dram->m_timing_vals("tCK_ps");
+      int tCK_ps = m_dram->m_timing_vals(m_dram->m_ids.timing.tCK_ps.required());
       // Separate main window = total - tcore (counters[0..5] include tcore)
       // When tcore is disabled, main = total, tcore = 0
       std::vector<uint64_t> main_counters(6, 0);
@@ -1531,7 +1627,7 @@ class NDPDRAMSystem final : public IMemorySystem, public Implementation {
       }
 
       // ---- Main window (non-tcore only) ----
-      std::cout << "[Main window]\n";
+      report_stream() << "[Main window]\n";
       print_bw("Host<->DB",
           calc_bw_gbs(main_counters[0]+main_counters[1]+main_counters[2], 1.0, m_clk, tCK_ps));
       print_bw("Host<->DB HOST",
@@ -1551,7 +1647,7 @@ class NDPDRAMSystem final : public IMemorySystem, public Implementation {
           calc_bw_gbs(main_counters[5], dq_scaling, m_clk, tCK_ps));
 
       // ---- tcore window ----
-      std::cout << "\n[tcore window]\n";
+      report_stream() << "\n[tcore window]\n";
       print_bw("tcore Host<->DB",
           calc_bw_gbs(counters[6]+counters[7]+counters[8], 1.0, m_clk, tCK_ps));      
       print_bw("tcore Host<->DB HOST",
@@ -1570,19 +1666,19 @@ class NDPDRAMSystem final : public IMemorySystem, public Implementation {
       print_bw("tcore DB<->DRAM NDP",
           calc_bw_gbs(counters[11], dq_scaling, m_clk, tCK_ps));
 
-      std::cout << std::endl;
+      report_stream() << std::endl;
 
       // HSNC Segment Tracking Report (only when enabled)
       if (m_seg_tracking_enable) {
         double tCK_ns = (double)tCK_ps / 1000.0;
-        std::cout<<"\n=== HSNC Segment Tracking Report (Host-side NDP Controller) ==="<<std::endl;
+        report_stream()<<"\n=== HSNC Segment Tracking Report (Host-side NDP Controller) ==="<<std::endl;
         for(int dimm_id=0;dimm_id<m_num_dimm;dimm_id++) {
           for(int pch_id=0;pch_id<(m_num_subch*num_pseudochannel);pch_id++) {
             auto& segs = hsnc_segments[dimm_id][pch_id];
             if (segs.empty()) continue;
-            std::cout<<"\n--- DIMM["<<dimm_id<<"] PCH["<<pch_id<<"] ("<<segs.size()<<" segments) ---"<<std::endl;
-            std::cout<<"  Seg | Type    |  RunStart  | DrainStart |    SegEnd  |  Total | Fetch | Drain"<<std::endl;
-            std::cout<<"------+---------+------------+------------+-----------+--------+-------+------"<<std::endl;
+            report_stream()<<"\n--- DIMM["<<dimm_id<<"] PCH["<<pch_id<<"] ("<<segs.size()<<" segments) ---"<<std::endl;
+            report_stream()<<"  Seg | Type    |  RunStart  | DrainStart |    SegEnd  |  Total | Fetch | Drain"<<std::endl;
+            report_stream()<<"------+---------+------------+------------+-----------+--------+-------+------"<<std::endl;
 
             Clk_t total_rd_cycles = 0, total_wr_cycles = 0, total_wait_cycles = 0;
             int rd_cnt = 0, wr_cnt = 0, wait_cnt = 0;
@@ -1591,15 +1687,15 @@ class NDPDRAMSystem final : public IMemorySystem, public Implementation {
               Clk_t total  = s.end - s.run_start;
               Clk_t fetch  = (s.drain_start > 0) ? (s.drain_start - s.run_start) : total;
               Clk_t drain  = (s.drain_start > 0) ? (s.end - s.drain_start) : 0;
-              std::cout<<"  "<<std::setw(3)<<s.seg_id<<" | "
-                       <<std::setw(7)<<std::left<<hsnc_seg_type_str(s.type)<<std::right<<" | "
-                       <<std::setw(10)<<s.run_start<<" | "
-                       <<std::setw(10)<<((s.drain_start > 0) ? std::to_string(s.drain_start) : "-")<<" | "
-                       <<std::setw(9)<<s.end<<" | "
-                       <<std::setw(6)<<total<<" | "
-                       <<std::setw(5)<<fetch<<" | "
-                       <<std::setw(5)<<drain
-                       <<std::endl;
+              report_stream()<<"  "<<std::setw(3)<<s.seg_id<<" | "
+                             <<std::setw(7)<<std::left<<hsnc_seg_type_str(s.type)<<std::right<<" | "
+                             <<std::setw(10)<<s.run_start<<" | "
+                             <<std::setw(10)<<((s.drain_start > 0) ? std::to_string(s.drain_start) : "-")<<" | "
+                             <<std::setw(9)<<s.end<<" | "
+                             <<std::setw(6)<<total<<" | "
+                             <<std::setw(5)<<fetch<<" | "
+                             <<std::setw(5)<<drain
+                             <<std::endl;
               switch(s.type) {
                 case HsncSegType::RD:   total_rd_cycles += total; rd_cnt++; break;
                 case HsncSegType::WR:   total_wr_cycles += total; wr_cnt++; break;
@@ -1607,39 +1703,39 @@ class NDPDRAMSystem final : public IMemorySystem, public Implementation {
                 default: break;
               }
             }
-            std::cout<<"------+---------+------------+------------+-----------+--------+-------+------"<<std::endl;
+            report_stream()<<"------+---------+------------+------------+-----------+--------+-------+------"<<std::endl;
             Clk_t first_start = segs.front().run_start;
             Clk_t last_end = segs.back().end;
             Clk_t total_span = last_end - first_start;
-            std::cout<<"  Total NDP span: "<<total_span<<" cycles ("
-                     <<(double)total_span * tCK_ns<<" ns)"<<std::endl;
+            report_stream()<<"  Total NDP span: "<<total_span<<" cycles ("
+                           <<(double)total_span * tCK_ns<<" ns)"<<std::endl;
             if (rd_cnt > 0)
-              std::cout<<"  RD segments:   "<<rd_cnt<<" segs, "<<total_rd_cycles<<" cycles (avg "<<(total_rd_cycles/rd_cnt)<<")"<<std::endl;
+              report_stream()<<"  RD segments:   "<<rd_cnt<<" segs, "<<total_rd_cycles<<" cycles (avg "<<(total_rd_cycles/rd_cnt)<<")"<<std::endl;
             if (wr_cnt > 0)
-              std::cout<<"  WR segments:   "<<wr_cnt<<" segs, "<<total_wr_cycles<<" cycles (avg "<<(total_wr_cycles/wr_cnt)<<")"<<std::endl;
+              report_stream()<<"  WR segments:   "<<wr_cnt<<" segs, "<<total_wr_cycles<<" cycles (avg "<<(total_wr_cycles/wr_cnt)<<")"<<std::endl;
             if (wait_cnt > 0)
-              std::cout<<"  WAIT segments: "<<wait_cnt<<" segs, "<<total_wait_cycles<<" cycles (avg "<<(total_wait_cycles/wait_cnt)<<")"<<std::endl;
+              report_stream()<<"  WAIT segments: "<<wait_cnt<<" segs, "<<total_wait_cycles<<" cycles (avg "<<(total_wait_cycles/wait_cnt)<<")"<<std::endl;
           }
         }
-        std::cout<<"=== End HSNC Segment Tracking Report ===\n"<<std::endl;
+        report_stream()<<"=== End HSNC Segment Tracking Report ===\n"<<std::endl;
       }
 
       // Descriptor Cache Summary
-      std::cout<<"\n=== Descriptor Cache Summary ==="<<std::endl;
+      report_stream()<<"\n=== Descriptor Cache Summary ==="<<std::endl;
       for(int dimm_id=0;dimm_id<m_num_dimm;dimm_id++) {
         for(int pch_id=0;pch_id<(m_num_subch*num_pseudochannel);pch_id++) {
           uint64_t hit   = desc_cache_hit_cnt[dimm_id][pch_id];
           uint64_t miss  = desc_cache_miss_cnt[dimm_id][pch_id];
           if(hit + miss == 0) continue;
           float hit_rate = (float)hit / (float)(hit + miss) * 100.0f;
-          std::cout<<"  DIMM["<<dimm_id<<"] PCH["<<pch_id<<"]: "
-                   <<"hit="<<hit<<" miss="<<miss
-                   <<" evict="<<desc_cache_evict_cnt[dimm_id][pch_id]
-                   <<" hit_rate="<<std::fixed<<std::setprecision(2)<<hit_rate<<"%"
-                   <<std::endl;
+          report_stream()<<"  DIMM["<<dimm_id<<"] PCH["<<pch_id<<"]: "
+                         <<"hit="<<hit<<" miss="<<miss
+                         <<" evict="<<desc_cache_evict_cnt[dimm_id][pch_id]
+                         <<" hit_rate="<<std::fixed<<std::setprecision(2)<<hit_rate<<"%"
+                         <<std::endl;
         }
       }
-      std::cout<<"=== End Descriptor Cache Summary ===\n"<<std::endl;
+      report_stream()<<"=== End Descriptor Cache Summary ===\n"<<std::endl;
 
       report();
 
@@ -1795,6 +1891,7 @@ class NDPDRAMSystem final : public IMemorySystem, public Implementation {
           req.callback = [this, req_id](Request& completed_req) {
             this->on_read_complete(req_id, completed_req);
           };
+          req.callback_id = req_id;
         }
         
         // Try to send the request
@@ -1858,12 +1955,12 @@ class NDPDRAMSystem final : public IMemorySystem, public Implementation {
         return bytes / time_ns; // GB/s
     }
 
-    static inline void print_bw(const std::string& name, double bw)
+    void print_bw(const std::string& name, double bw)
     {
-        std::cout << std::left << std::setw(32) << name
-                  << " : " << std::right << std::setw(10)
-                  << std::fixed << std::setprecision(3)
-                  << bw << " GB/s\n";
+        report_stream() << std::left << std::setw(32) << name
+                        << " : " << std::right << std::setw(10)
+                        << std::fixed << std::setprecision(3)
+                        << bw << " GB/s\n";
     }
     
     inline void record_latency(uint64_t lat) {
@@ -1,7 +1,10 @@
 #ifndef     RAMULATOR_MEMORYSYSTEM_MEMORY_H
 #define     RAMULATOR_MEMORYSYSTEM_MEMORY_H
 
+#include <algorithm>
+#include <deque>
 #include <map>
+#include <span>
 #include <vector>
 #include <string>
 #include <functional>
@@ -24,8 +27,10 @@ class IMemorySystem : public TopLevel<IMemorySystem> {
     std::string output_path = "ramulator2_simulation_result.yaml";
     std::string trace_path = "ramulator2.trace";
     bool use_gem5_frontend = false;
+    std::ostream* m_stats_stream = nullptr;   // Where the YAML statistics go (stdout if not set)
     int total_memory_capacity = 0;
     std::ofstream tout;
+    std::deque<Request> m_completions;        // Completed requests that were sent without a callback (see send(std::span<Request>))
     
   public:
     virtual void connect_frontend(IFrontEnd* frontend) { 
@@ -51,7 +56,7 @@ class IMemorySystem : public TopLevel<IMemorySystem> {
         std::ofstream fout(output_path);
         fout << emitter.c_str();
       } else {
-        std::cout << emitter.c_str() << std::endl;
+        (m_stats_stream ? *m_stats_stream : std::cout) << emitter.c_str() << std::endl;
       }
     };
 
@@ -64,12 +69,129 @@ class IMemorySystem : public TopLevel<IMemorySystem> {
      */
     virtual bool send(Request req) = 0;
 
+    /**
+     * @brief         Tries to send the requests in order, stopping at the first one that is rejected
+     * 
+     * @details
+     * For embedding (e.g., in gem5): the requests without a callback complete into the completion
+     * queue instead, which the host drains with drain_completions().
+     * 
+     * @param    reqs     The requests
+     * @return   size_t   The number of requests accepted (i.e., reqs[0, n) are accepted).
+     */
+    size_t send(std::span<Request> reqs) {
+      size_t num_accepted = 0;
+      for (const auto& req : reqs) {
+        Request sent_req = req;
+        if (!sent_req.callback) {
+          sent_req.callback = [this](Request& completed_req) { m_completions.push_back(completed_req); };
+        }
+        if (!send(std::move(sent_req))) {
+          break;
+        }
+        num_accepted++;
+      }
+      return num_accepted;
+    };
+
+    /**
+     * @brief         Moves the requests completed since the last call (in completion order) to the given vector
+     * 
+     * @return   size_t   The number of completed requests moved.
+     */
+    size_t drain_completions(std::vector<Request>& completions) {
+      size_t num_completions = m_completions.size();
+      for (auto& req : m_completions) {
+        completions.push_back(std::move(req));
+      }
+      m_completions.clear();
+      return num_completions;
+    };
+
+    /**
+     * @brief         Applies the request to the memory system functionally, i.e., without timing (e.g., to warm up the DRAM state in sampled simulation)
+     * 
+     */
+    virtual void functional_access(Request req) {
+      throw ConfigurationError("Memory system {} does not support functional accesses!", m_impl->get_name());
+    };
+
+    /**
+     * @brief         Throws a ConfigurationError if any part of the memory system does not support functional accesses
+     * 
+     */
+    virtual void check_functional_access() {
+      throw ConfigurationError("Memory system {} does not support functional accesses!", m_impl->get_name());
+    };
+
     /**
      * @brief         Ticks the memory system
      * 
      */
     virtual void tick() = 0;
 
+    /**
+     * @brief    Returns the earliest memory system cycle at which tick() may do any work
+     * 
+     * @details
+     * Used by the top-level loop to skip idle cycles. Any cycle that is not after the
+     * current one (e.g., the default 0) means the memory system must be ticked next cycle.
+     * 
+     */
+    virtual Clk_t get_next_event_clk() { return 0; };
+
+    /**
+     * @brief    Advances the memory system to the given cycle as if all ticks in between were idle
+     * 
+     */
+    virtual void fast_forward(Clk_t clk) {};
+
+    /**
+     * @brief    Returns the number of cycles the memory system has advanced
+     * 
+     */
+    virtual Clk_t get_clk() {
+      throw ConfigurationError("Memory system {} does not report its clock!", m_impl->get_name());
+    };
+
+    /**
+     * @brief    Advances the memory system to the given cycle, skipping the idle cycles in between
+     * 
+     * @details
+     * For embedding: the host calls this once per batch of cycles (e.g., before sending a request
+     * or when the memory system has work to do) instead of calling tick() every cycle.
+     * 
+     */
+    void tick_until(Clk_t clk) {
+      while (get_clk() < clk) {
+        // The tick() of the next event cycle does the work, the cycles before it are idle
+        Clk_t idle_until = std::min(get_next_event_clk() - 1, clk);
+        if (idle_until > get_clk()) {
+          fast_forward(idle_until);
+          continue;
+        }
+        tick();
+      }
+    };
+
+    /**
+     * @brief    Advances the memory system by n cycles, skipping the idle cycles in between
+     * 
+     */
+    void tick_n(Clk_t n) { tick_until(get_clk() + n); };
+
+    /**
+     * @brief    Recreates the callback of an in-flight request that is restored from a checkpoint
+     * 
+     * @details
+     * Memory systems that send requests themselves override this. Returns nullptr if the request
+     * comes from the frontend, i.e., the frontend recreates the callback.
+     * 
+     */
+    virtual std::function<void(Request&)> restore_callback(const Request& req) {
+      return nullptr;
+    };
+
     /**
      * @brief    Returns 
      * 
@@ -94,6 +216,23 @@ class IMemorySystem : public TopLevel<IMemorySystem> {
       use_gem5_frontend = true;
     };    
 
+    /**
+     * @brief    Writes the YAML statistics to the given stream instead of stdout (e.g., one file per ramulator-sweep point)
+     * 
+     */
+    void set_stats_stream(std::ostream* stats_stream) { m_stats_stream = stats_stream; };
+
+    /**
+     * @brief    Writes the reports that myself and all my components print in finalize() to the given stream instead of stdout
+     * 
+     */
+    void redirect_reports(std::ostream* report_stream) {
+      m_impl->set_report_stream(report_stream);
+      for (auto component : m_components) {
+        component->set_report_stream(report_stream);
+      }
+    };
+
     virtual int check_dram_capcity(int dram_capacity) {
       // Check DRAM Capacity is same with configuration 
       if((total_memory_capacity != 0) && (dram_capacity == total_memory_capacity)) return 1;
@@ -109,6 +248,9 @@ class IMemorySystem : public TopLevel<IMemorySystem> {
     // Check if host stall was detected (tcore backpressure termination)
     virtual bool is_host_stall_terminated() { return false; }
 
+    // Check if the performance metrics have converged (the run can stop early)
+    virtual bool is_converged() { return false; }
+
     // finalize memory system itself 
     virtual void mem_sys_finalize() = 0;
 };
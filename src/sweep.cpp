@@ -0,0 +1,194 @@
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+#include <argparse/argparse.hpp>
+#include <spdlog/spdlog.h>
+
+#include "base/base.h"
+#include "base/config.h"
+#include "base/simulation.h"
+#include "frontend/frontend.h"
+#include "memory_system/memory_system.h"
+
+namespace fs = std::filesystem;
+
+/**
+ * @brief    Expands "KEY=V1,V2,..." options into the cartesian product of "KEY=Vi" overrides.
+ * 
+ */
+std::vector<std::vector<std::string>> expand_grid(const std::vector<std::string>& axes) {
+  std::vector<std::vector<std::string>> points = {{}};
+  for (const auto& axis : axes) {
+    size_t eq_pos = axis.find('=');
+    if (eq_pos == std::string::npos) {
+      throw std::runtime_error(fmt::format("Invalid sweep parameter {} (expected KEY=V1,V2,...)!", axis));
+    }
+    std::string key = axis.substr(0, eq_pos);
+
+    std::vector<std::string> values;
+    std::stringstream ss(axis.substr(eq_pos + 1));
+    std::string value;
+    while (std::getline(ss, value, ',')) {
+      values.push_back(value);
+    }
+    if (values.empty()) {
+      throw std::runtime_error(fmt::format("Sweep parameter {} has no values!", key));
+    }
+
+    std::vector<std::vector<std::string>> expanded;
+    for (const auto& point : points) {
+      for (const auto& v : values) {
+        expanded.push_back(point);
+        expanded.back().push_back(key + "=" + v);
+      }
+    }
+    points = std::move(expanded);
+  }
+  return points;
+}
+
+/**
+ * @brief    Appends ".point_<id>" to the file name of every output path in the configuration, so that the points do not
+ *           overwrite each other's files (e.g., energy_trace_path -> energy.point_3.csv).
+ * 
+ */
+void suffix_output_paths(YAML::Node node, size_t point_id, bool is_plugin = false) {
+  // Output files written by the components. A plugin's "path" is an output, while a frontend's "path" is its input trace.
+  static const std::vector<std::string> output_keys = {"energy_trace_path", "lat_dump_path", "llc_serialization_filename"};
+
+  if (node.IsSequence()) {
+    for (auto child : node) {
+      suffix_output_paths(child, point_id, is_plugin);
+    }
+    return;
+  }
+  if (!node.IsMap()) {
+    return;
+  }
+  for (auto entry : node) {
+    std::string key = entry.first.as<std::string>();
+    if (entry.second.IsScalar() && ((is_plugin && key == "path") || std::find(output_keys.begin(), output_keys.end(), key) != output_keys.end())) {
+      fs::path path = entry.second.as<std::string>();
+      path.replace_filename(fmt::format("{}.point_{}{}", path.stem().string(), point_id, path.extension().string()));
+      entry.second = path.string();
+    } else {
+      suffix_output_paths(entry.second, point_id, key == "ControllerPlugin");
+    }
+  }
+}
+
+int main(int argc, char* argv[]) {
+  // Parse command line arguments
+  argparse::ArgumentParser program("Ramulator-Sweep", "2.0");
+  program.add_argument("-f", "--config_file").metavar("path-to-configuration-file")
+    .required()
+    .help("Path to the base YAML configuration file.");
+  program.add_argument("-p", "--param").metavar("KEY=V1,V2,...")
+    .append()
+    .help("Parameter to sweep over. Repeat this option to sweep over the cartesian product of multiple parameters.");
+  program.add_argument("-j", "--jobs").metavar("N")
+    .scan<'i', int>()
+    .default_value((int)std::max(1u, std::thread::hardware_concurrency()))
+    .help("Number of points simulated concurrently.");
+  program.add_argument("-o", "--output_dir").metavar("path-to-output-directory")
+    .default_value(std::string("sweep_results"))
+    .help("Directory of the statistics (point_<i>.yaml) and report (point_<i>.log) files of the points.");
+
+  try {
+    program.parse_args(argc, argv);
+  }
+  catch (const std::runtime_error& err) {
+    spdlog::error(err.what());
+    std::cerr << program;
+    std::exit(1);
+  }
+
+  std::vector<std::string> axes;
+  if (auto arg = program.present<std::vector<std::string>>("-p")) {
+    axes = *arg;
+  }
+
+  std::vector<std::vector<std::string>> points;
+  try {
+    points = expand_grid(axes);
+  } catch (const std::runtime_error& err) {
+    spdlog::error(err.what());
+    std::exit(1);
+  }
+
+  // Parse the base configuration once. Every point gets its own copy, since the YAML nodes are not thread-safe.
+  std::string config_file_path = program.get<std::string>("-f");
+  YAML::Node base_config = Ramulator::Config::parse_config_file(config_file_path, {});
+  // The profiler is process-wide, so only the base configuration can enable it
+  Ramulator::Profiler::configure(base_config);
+  std::vector<YAML::Node> configs;
+  for (size_t point_id = 0; point_id < points.size(); point_id++) {
+    YAML::Node config = YAML::Clone(base_config);
+    Ramulator::Config::Details::override_configs(config, points[point_id]);
+    suffix_output_paths(config, point_id);
+    configs.push_back(config);
+  }
+
+  fs::path output_dir = program.get<std::string>("-o");
+  fs::create_directories(output_dir);
+
+  int num_jobs = std::max(1, std::min(program.get<int>("-j"), (int)points.size()));
+  spdlog::info("Sweeping over {} points with {} jobs.", points.size(), num_jobs);
+
+  std::atomic<size_t> next_point{0};
+  std::atomic<int> num_failed{0};
+  auto run_points = [&]() {
+    size_t point_id;
+    while ((point_id = next_point.fetch_add(1)) < points.size()) {
+      std::string point_desc;
+      for (const auto& param : points[point_id]) {
+        point_desc += (point_desc.empty() ? "" : " ") + param;
+      }
+      fs::path stats_path = output_dir / fmt::format("point_{}.yaml", point_id);
+      fs::path report_path = output_dir / fmt::format("point_{}.log", point_id);
+      try {
+        // The frontends share the parsed traces (read-only), so each trace is only parsed once
+        auto frontend = Ramulator::Factory::create_frontend(configs[point_id]);
+        auto memory_system = Ramulator::Factory::create_memory_system(configs[point_id]);
+        frontend->connect_memory_system(memory_system);
+        memory_system->connect_frontend(frontend);
+
+        std::ofstream stats_file(stats_path);
+        stats_file << "# Overrides: " << point_desc << std::endl;
+        frontend->set_stats_stream(&stats_file);
+        memory_system->set_stats_stream(&stats_file);
+        // The reports printed in finalize (e.g., the DRAM power report) are not YAML, so they go to their own file
+        std::ofstream report_file(report_path);
+        frontend->redirect_reports(&report_file);
+        memory_system->redirect_reports(&report_file);
+
+        Ramulator::Simulation::run(frontend, memory_system);
+
+        frontend->finalize();
+        memory_system->finalize();
+        delete frontend;
+        delete memory_system;
+        spdlog::info("Point {} ({}) done: {}", point_id, point_desc, stats_path.string());
+      } catch (const std::exception& e) {
+        num_failed++;
+        spdlog::error("Point {} ({}) failed: {}", point_id, point_desc, e.what());
+      }
+    }
+  };
+
+  std::vector<std::thread> workers;
+  for (int i = 1; i < num_jobs; i++) {
+    workers.emplace_back(run_points);
+  }
+  run_points();
+  for (auto& worker : workers) {
+    worker.join();
+  }
+
+  return num_failed > 0 ? 1 : 0;
+}
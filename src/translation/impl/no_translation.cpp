@@ -19,6 +19,8 @@ class NoTranslation: public ITranslation, public Implementation {
       m_max_paddr = param<Addr_t>("max_addr").desc("Max physical address of the memory system.").required();
     };
 
+    void serialize(Archive& ar) override { };
+
     bool translate(Request& req) override {
       // We dont do any translation. Just wrap the vaddr around max_paddr.
       // Addr_t new_addr = (req.addr % m_max_paddr);
@@ -52,6 +52,12 @@ class RandomTranslation : public ITranslation, public Implementation {
       m_logger = Logging::create_logger("RandomTranslation");
     };
 
+    void serialize(Archive& ar) override {
+      ar & m_allocator_rng;
+      ar & m_free_physical_pages & m_num_free_physical_pages;
+      ar & m_translation & m_reserved_pages;
+    };
+
     bool translate(Request& req) override {
       Addr_t vpn = req.addr >> m_offsetbits;
 